@@ -0,0 +1,28 @@
+message("Configuring google benchmark library.")
+
+#   # Download and unpack google benchmark at configure time
+configure_file(cmake/CMakeLists.benchmark.txt.in ${CMAKE_CURRENT_BINARY_DIR}/benchmark-download/CMakeLists.txt)
+execute_process(COMMAND ${CMAKE_COMMAND} -G "${CMAKE_GENERATOR}" .
+  RESULT_VARIABLE result
+  WORKING_DIRECTORY ${CMAKE_CURRENT_BINARY_DIR}/benchmark-download )
+if(result)
+  message(FATAL_ERROR "CMake step for google benchmark failed: ${result}")
+endif()
+execute_process(COMMAND ${CMAKE_COMMAND} --build .
+  RESULT_VARIABLE result
+  WORKING_DIRECTORY ${CMAKE_CURRENT_BINARY_DIR}/benchmark-download )
+if(result)
+  message(FATAL_ERROR "Build step for google benchmark failed: ${result}")
+endif()
+
+# The benchmark library own tests are not needed (and would require gtest
+# to be found by its build)
+set(BENCHMARK_ENABLE_TESTING OFF CACHE BOOL "" FORCE)
+set(BENCHMARK_ENABLE_GTEST_TESTS OFF CACHE BOOL "" FORCE)
+set(BENCHMARK_ENABLE_INSTALL OFF CACHE BOOL "" FORCE)
+
+# Add google benchmark directly to our build. This defines
+# the benchmark::benchmark and benchmark::benchmark_main targets.
+add_subdirectory(${CMAKE_CURRENT_BINARY_DIR}/benchmark-src
+                 ${CMAKE_CURRENT_BINARY_DIR}/benchmark-build
+                 EXCLUDE_FROM_ALL)
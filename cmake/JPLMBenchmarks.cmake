@@ -0,0 +1,8 @@
+#uses the google benchmark library installed in the system, if any.
+#otherwise, it is downloaded from git (as done for googletest)
+find_package(benchmark QUIET)
+if (benchmark_FOUND)
+  message(STATUS "Using the google benchmark library found in the system")
+else (benchmark_FOUND)
+  include(ExternalGoogleBenchmark)
+endif (benchmark_FOUND)
@@ -39,11 +39,61 @@
  */
 
 #include <cstdlib>
+#include <filesystem>
 #include <string>
 #include "Lib/Common/JPLMCodecFactory.h"
 #include "Lib/Common/JPLMConfigurationFactory.h"
+#include "Lib/Part1/Common/UncompressedThumbnail.h"
 #include "Lib/Part1/Decoder/JPLFileFromStream.h"
+#include "Lib/Part1/Decoder/JPLThumbnailReader.h"
+#include "Lib/Utils/Image/ImageIO.h"
+#include "Lib/Utils/Stats/MemoryAccounting.h"
 #include "Lib/Utils/Stats/RunTimeStatistics.h"
+#include "Lib/Utils/Stats/TraceEvents.h"
+
+
+/**
+ * \brief      Writes the thumbnail of the input file, reading only the boxes
+ * that precede it.
+ *
+ * \details    Three channel thumbnails are written as a PPM file; otherwise,
+ * each channel is written as a PGX file. When the output path has no
+ * extension, it is taken as a directory.
+ *
+ * \return     False if the input file has no thumbnail.
+ */
+bool write_thumbnail(const JPLMDecoderConfiguration& configuration) {
+  auto reader = JPLThumbnailReader(configuration.get_input_filename());
+  auto thumbnail_box = reader.read_thumbnail_box();
+  if (!thumbnail_box) {
+    return false;
+  }
+  auto thumbnail = UncompressedThumbnail::get_image(*thumbnail_box);
+
+  auto output = std::filesystem::path(configuration.get_output_filename());
+  if (!output.has_extension()) {
+    std::filesystem::create_directories(output);
+    output /= "thumbnail";
+  }
+
+  const auto number_of_channels = thumbnail->get_number_of_channels();
+  if (number_of_channels == 3) {
+    ImageIO::imwrite(
+        *thumbnail, output.replace_extension(".ppm").string(), true);
+    return true;
+  }
+  for (auto c = decltype(number_of_channels){0}; c < number_of_channels;
+       ++c) {
+    auto channel_image = UndefinedImage<uint16_t>(
+        thumbnail->get_width(), thumbnail->get_height(), thumbnail->get_bpp());
+    channel_image.get_channel(0) = thumbnail->get_channel(c);
+    auto channel_filename = output;
+    channel_filename.replace_filename(
+        output.stem().string() + "_" + std::to_string(c) + ".pgx");
+    ImageIO::imwrite(channel_image, channel_filename.string(), true);
+  }
+  return true;
+}
 
 int main(int argc, char const* argv[]) {
   auto run_time_statistics = RunTimeStatistics();
@@ -57,8 +107,28 @@ int main(int argc, char const* argv[]) {
     std::cout << "Output: " << configuration->get_output_filename() << std::endl;
   }
 
-  auto jpl_file =
-      std::make_shared<JPLFileFromStream>(configuration->get_input_filename());
+  if (configuration->is_thumbnail_only()) {
+    if (!write_thumbnail(*configuration)) {
+      std::cerr << "The input file has no thumbnail." << std::endl;
+      exit(EXIT_FAILURE);
+    }
+    if (configuration->show_runtime_statistics()) {
+      run_time_statistics.show_statistics();
+    }
+    exit(EXIT_SUCCESS);
+  }
+
+  MemoryAccounting::set_budget(configuration->get_memory_budget());
+
+  if (!configuration->get_trace_filename().empty()) {
+    TraceEvents::start();
+  }
+
+  auto jpl_file = [&configuration]() {
+    const auto event = TraceEvents::ScopedEvent("read_file", "io");
+    return std::make_shared<JPLFileFromStream>(
+        configuration->get_input_filename());
+  }();
 
   auto decoders = JPLMCodecFactory::get_decoders(
       jpl_file, configuration->get_output_filename(), configuration);
@@ -66,9 +136,19 @@ int main(int argc, char const* argv[]) {
     decoder->run();
   }
 
+  if (!configuration->get_trace_filename().empty()) {
+    TraceEvents::stop();
+    TraceEvents::write(configuration->get_trace_filename());
+  }
+
   if (configuration->show_runtime_statistics()) {
     run_time_statistics.show_statistics();
   }
 
+  if (!configuration->get_runtime_statistics_filename().empty()) {
+    run_time_statistics.write_statistics(
+        configuration->get_runtime_statistics_filename());
+  }
+
   exit(EXIT_SUCCESS);
 }
\ No newline at end of file
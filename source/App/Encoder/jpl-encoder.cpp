@@ -40,16 +40,58 @@
 
 
 #include <cstdlib>
+#include <filesystem>
 #include <string>
 #include "Lib/Common/JPLMCodecFactory.h"
 #include "Lib/Common/JPLMConfigurationFactory.h"
+#include "Lib/Common/JPLMEncoderConfigurationLightField4DTransformMode.h"
+#include "Lib/Part2/Encoder/TransformMode/JPLM4DTransformModeLightFieldEncoder.h"
 #include "Lib/Utils/Stats/EncoderRunTimeStatistics.h"
+#include "Lib/Utils/Stats/MemoryAccounting.h"
+#include "Lib/Utils/Stats/StageInstrumentation.h"
+#include "Lib/Utils/Stats/TraceEvents.h"
+
+
+/**
+ * \brief      Writes the files of the lambdas after the first one, when the
+ * light field was encoded with several lambdas (--lambdas).
+ */
+void write_files_of_other_lambdas(JPLMCodec& encoder,
+    const JPLMEncoderConfigurationLightField4DTransformMode& configuration) {
+  auto& transform_mode_encoder =
+      dynamic_cast<JPLM4DTransformModeLightFieldEncoder<uint16_t>&>(encoder);
+  const auto& jpl_file = transform_mode_encoder.get_ref_to_jpl_file();
+  const auto number_of_lambdas = transform_mode_encoder.get_number_of_lambdas();
+  for (auto i = std::size_t(1); i < number_of_lambdas; ++i) {
+    transform_mode_encoder.select_lambda(i);
+    std::ofstream of_stream(
+        JPLMEncoderConfigurationLightField4DTransformMode::
+            get_filename_for_lambda(configuration.get_output_filename(),
+                transform_mode_encoder.get_lambda(i)),
+        std::ofstream::binary);
+    of_stream << jpl_file;
+  }
+  transform_mode_encoder.select_lambda(0);
+}
 
 
 int main(int argc, char const* argv[]) {
   auto configuration =
       JPLMConfigurationFactory::get_encoder_configuration(argc, argv);
-  std::fstream of_stream(configuration->get_output_filename(),
+  auto transform_mode_configuration = std::dynamic_pointer_cast<
+      JPLMEncoderConfigurationLightField4DTransformMode>(configuration);
+  const auto has_multiple_lambdas = transform_mode_configuration &&
+                                    transform_mode_configuration
+                                        ->has_multiple_lambdas();
+  //with several lambdas, the (first) output file also gets the lambda suffix
+  auto output_filename = configuration->get_output_filename();
+  if (has_multiple_lambdas) {
+    output_filename =
+        JPLMEncoderConfigurationLightField4DTransformMode::
+            get_filename_for_lambda(output_filename,
+                transform_mode_configuration->get_lambdas().front());
+  }
+  std::fstream of_stream(output_filename,
       std::fstream::binary | std::fstream::out | std::fstream::in |
           std::fstream::trunc);
 
@@ -57,6 +99,12 @@ int main(int argc, char const* argv[]) {
     std::cerr << "JPEG Pleno Model (JPLM) Encoder. \nVerbose mode \"on\"\n";
   }
 
+  MemoryAccounting::set_budget(configuration->get_memory_budget());
+
+  if (!configuration->get_trace_filename().empty()) {
+    TraceEvents::start();
+  }
+
   auto show_statistics = configuration->show_runtime_statistics();
   auto run_time_statistics = EncoderRunTimeStatistics(of_stream);
 
@@ -72,13 +120,38 @@ int main(int argc, char const* argv[]) {
     jpl_file.enable_catalog();
   }
 
-  of_stream << jpl_file;
+  {
+    JPLM_STAGE_TIMER(output);
+    const auto event = TraceEvents::ScopedEvent("write_file", "io");
+    of_stream << jpl_file;
+    if (has_multiple_lambdas) {
+      write_files_of_other_lambdas(*encoder, *transform_mode_configuration);
+    }
+  }
+
+  if (!configuration->get_trace_filename().empty()) {
+    TraceEvents::stop();
+    TraceEvents::write(configuration->get_trace_filename());
+  }
 
   if (show_statistics) {
     run_time_statistics.show_statistics();
   }
 
+  if (!configuration->get_runtime_statistics_filename().empty()) {
+    run_time_statistics.write_statistics(
+        configuration->get_runtime_statistics_filename());
+  }
+
   of_stream.close();
 
+  //the encoding is complete, thus there is nothing left to resume
+  if (transform_mode_configuration &&
+      (transform_mode_configuration->writes_checkpoints() ||
+          transform_mode_configuration->resumes())) {
+    std::filesystem::remove(
+        transform_mode_configuration->get_checkpoint_filename());
+  }
+
   exit(EXIT_SUCCESS);
 }
\ No newline at end of file
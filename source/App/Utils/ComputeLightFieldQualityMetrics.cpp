@@ -56,12 +56,25 @@
 #include "Lib/Utils/Image/Image.h"
 #include "Lib/Utils/Image/ImageMetrics.h"
 #include "Lib/Utils/Image/PixelMapFileIO.h"
+#include "Lib/Utils/Parallel/ParallelFor.h"
 
 // namespace ImageMetrics {
 // enum class Available { PSNR, MSE, SSE, MAX_ABS_ERROR };
 
 using Metric = ImageMetrics::Available;
 
+
+/**
+ * \brief      Checks if the metric is reported by the report options given
+ *             without a metric
+ *
+ * \details    SSIM and MS-SSIM are much more expensive than the error metrics
+ *             and need a minimum view size, so they must be asked by name.
+ */
+constexpr bool is_shown_by_default(Metric metric) {
+  return (metric != Metric::SSIM) && (metric != Metric::MS_SSIM);
+}
+
 enum class ReportType : uint16_t {
   NONE = 0,
   VIEW_CHANNELS = 1,
@@ -99,6 +112,11 @@ class ReportShowFlags {
     constexpr uint16_t type_as_int = magic_enum::enum_integer(type);
     return type_as_int & report_mask;
   }
+
+
+  bool has_any_report() const {
+    return report_mask != magic_enum::enum_integer(ReportType::NONE);
+  }
 };
 
 
@@ -117,6 +135,7 @@ class ComputeLightfieldQualityMetricsConfiguration : public BasicConfiguration {
 
   uint32_t number_of_rows_t;
   uint32_t number_of_columns_s;
+  std::size_t number_of_threads;
   ComputeLightfieldQualityMetricsConfiguration(
       int argc, char **argv, std::size_t level)
       : BasicConfiguration(argc, argv, level) {
@@ -183,7 +202,7 @@ class ComputeLightfieldQualityMetricsConfiguration : public BasicConfiguration {
     }
 
     this->add_cli_json_option({"--metric", "-m",
-        "Metric to be computed. "
+        "Metric whose reports are shown when no report option is given. "
         "Available metrics: " +
             available_metrics_string_stream.str(),
         [this](const nlohmann::json &conf) -> std::optional<std::string> {
@@ -209,7 +228,8 @@ class ComputeLightfieldQualityMetricsConfiguration : public BasicConfiguration {
 
     this->add_cli_json_option({"--show-report-view-channels", "-srvc",
         "Shows a view-by-view report for each channel. "
-        "Metric parameter is optional. If not set, all metrics will be shown. "
+        "Metric parameter is optional. If not set, all metrics but SSIM and "
+        "MS_SSIM will be shown. "
         "Available metrics: " +
             available_metrics_string_stream.str(),
         [this](const nlohmann::json &conf) -> std::optional<std::string> {
@@ -234,7 +254,8 @@ class ComputeLightfieldQualityMetricsConfiguration : public BasicConfiguration {
 
     this->add_cli_json_option({"--show-report-view-average", "-srva",
         "Shows a view-by-view report with the average of all channels. "
-        "Metric parameter is optional. If not set, all metrics will be shown. "
+        "Metric parameter is optional. If not set, all metrics but SSIM and "
+        "MS_SSIM will be shown. "
         "Available metrics: " +
             available_metrics_string_stream.str() +
             "The average PSNR is obtained after the average MSE.",
@@ -260,7 +281,8 @@ class ComputeLightfieldQualityMetricsConfiguration : public BasicConfiguration {
 
     this->add_cli_json_option({"--show-report-channel-average", "-srca",
         "Shows a channel-by-channel report with the average of all views. "
-        "Metric parameter is optional. If not set, all metrics will be shown. "
+        "Metric parameter is optional. If not set, all metrics but SSIM and "
+        "MS_SSIM will be shown. "
         "Available metrics: " +
             available_metrics_string_stream.str() +
             "The average PSNR is obtained after the average MSE.",
@@ -286,7 +308,8 @@ class ComputeLightfieldQualityMetricsConfiguration : public BasicConfiguration {
 
     this->add_cli_json_option({"--show-report-average", "-avg",
         "Summary. Shows a report with the average of all channels of all views."
-        "Metric parameter is optional. If not set, all metrics will be shown. "
+        "Metric parameter is optional. If not set, all metrics but SSIM and "
+        "MS_SSIM will be shown. "
         "Available metrics: " +
             available_metrics_string_stream.str() +
             "The average PSNR is obtained after the average MSE.",
@@ -309,7 +332,8 @@ class ComputeLightfieldQualityMetricsConfiguration : public BasicConfiguration {
 
     this->add_cli_json_option({"--show-report-all", "-all",
         "Show all reports for the metric passed as parameter. "
-        "Metric parameter is optional. If not set, all metrics will be shown. "
+        "Metric parameter is optional. If not set, all metrics but SSIM and "
+        "MS_SSIM will be shown. "
         "Available metrics: " +
             available_metrics_string_stream.str() +
             "The average PSNR is obtained after the average MSE.",
@@ -345,6 +369,19 @@ class ComputeLightfieldQualityMetricsConfiguration : public BasicConfiguration {
             },
             this->current_hierarchy_level,
             {[this]() -> std::string { return "3"; }}});
+
+    this->add_cli_json_option({"--number-of-threads", "-nt",
+        "Number of threads used to load and evaluate the views. "
+        "0 uses one thread per hardware thread.",
+        [this](const nlohmann::json &conf) -> std::optional<std::string> {
+          if (conf.contains("number-of-threads")) {
+            return std::to_string(conf["number-of-threads"].get<uint32_t>());
+          }
+          return std::nullopt;
+        },
+        [this](std::string arg) { this->number_of_threads = std::stoi(arg); },
+        this->current_hierarchy_level,
+        {[this]() -> std::string { return "0"; }}});
   }
 
  public:
@@ -353,12 +390,25 @@ class ComputeLightfieldQualityMetricsConfiguration : public BasicConfiguration {
             ComputeLightfieldQualityMetricsConfiguration::
                 current_hierarchy_level) {
     this->init(argc, argv);
+    //without any report option, all the reports of the chosen metric are shown
+    auto has_any_report = false;
+    for (const auto &it : reports) {
+      has_any_report = has_any_report || it.second.has_any_report();
+    }
+    if (!has_any_report) {
+      set_all_reports(metric);
+    }
   }
 
   uint16_t get_number_of_colour_channels() const {
     return number_of_colour_channels;
   }
 
+
+  std::size_t get_number_of_threads() const {
+    return number_of_threads;
+  }
+
   const ReportShowFlags &get_report(Metric metric) const {
     auto iter = reports.find(metric);
     if (iter != reports.end()) {
@@ -381,14 +431,18 @@ class ComputeLightfieldQualityMetricsConfiguration : public BasicConfiguration {
   template<ReportType type>
   void set_report() {
     for (auto metric : magic_enum::enum_values<Metric>()) {
-      set_report<type>(metric);
+      if (is_shown_by_default(metric)) {
+        set_report<type>(metric);
+      }
     }
   }
 
 
   void set_all_reports() {
     for (auto &it : reports) {
-      it.second.set_all_reports();
+      if (is_shown_by_default(it.first)) {
+        it.second.set_all_reports();
+      }
     }
   }
 
@@ -491,6 +545,52 @@ void show_view_channels_and_view_average_reports(
 }
 
 
+/**
+ * \brief      Metrics of each channel of a test view
+ */
+struct ViewQuality {
+  std::vector<ImageChannelUtils::ErrorStatistics> errors;
+  std::vector<double> structural_similarity;  //!< empty if not computed
+  std::vector<double> multiscale_structural_similarity;  //!< ditto
+};
+
+
+/**
+ * \brief      Computes the metrics of a test view, loading the images of both
+ *             views and releasing them afterwards
+ *
+ * \details    The errors are computed in a single pass; SSIM and MS-SSIM,
+ *             which are more expensive, only when requested. Each view is
+ *             handled by a single thread, so that the views of the light
+ *             fields may be evaluated concurrently.
+ */
+ViewQuality get_view_quality(View<uint16_t> &baseline_view,
+    View<uint16_t> &test_view, bool compute_ssim, bool compute_ms_ssim) {
+  for (auto *view : {&baseline_view, &test_view}) {
+    if (!view->has_image()) {
+      view->load_image();
+    }
+  }
+  const auto &baseline_image = *baseline_view.get_image_ptr();
+  const auto &test_image = *test_view.get_image_ptr();
+  ViewQuality quality;
+  quality.errors =
+      ImageMetrics::get_error_statistics(baseline_image, test_image);
+  if (compute_ssim) {
+    quality.structural_similarity =
+        ImageMetrics::get_structural_similarity(baseline_image, test_image);
+  }
+  if (compute_ms_ssim) {
+    quality.multiscale_structural_similarity =
+        ImageMetrics::get_multiscale_structural_similarity(
+            baseline_image, test_image);
+  }
+  baseline_view.release_image();
+  test_view.release_image();
+  return quality;
+}
+
+
 void compute_metric(
     const ComputeLightfieldQualityMetricsConfiguration &configuration) {
   const auto t_max = configuration.get_t();
@@ -520,52 +620,73 @@ void compute_metric(
   std::vector<double> mse_sum(n_channels, 0.0);
   std::vector<double> sse_sum(n_channels, 0.0);
   std::vector<std::size_t> max_error(n_channels, 0);
+  std::vector<double> ssim_sum(n_channels, 0.0);
+  std::vector<double> ms_ssim_sum(n_channels, 0.0);
 
 
   std::vector<samilton::ConsoleTable> channel_mse_table;
   std::vector<samilton::ConsoleTable> channel_psnr_table;
   std::vector<samilton::ConsoleTable> channel_max_abs_error_table;
   std::vector<samilton::ConsoleTable> channel_sse_table;
+  std::vector<samilton::ConsoleTable> channel_ssim_table;
+  std::vector<samilton::ConsoleTable> channel_ms_ssim_table;
 
   for (auto i = decltype(n_channels){0}; i < n_channels; ++i) {
     channel_mse_table.push_back(configuration.get_console_table());
     channel_psnr_table.push_back(configuration.get_console_table());
     channel_max_abs_error_table.push_back(configuration.get_console_table());
     channel_sse_table.push_back(configuration.get_console_table());
+    channel_ssim_table.push_back(configuration.get_console_table());
+    channel_ms_ssim_table.push_back(configuration.get_console_table());
   }
 
   auto average_psnr_table = configuration.get_console_table();
   auto average_mse_table = configuration.get_console_table();
   auto max_max_abs_error_table = configuration.get_console_table();
   auto average_sse_table = configuration.get_console_table();
+  auto average_ssim_table = configuration.get_console_table();
+  auto average_ms_ssim_table = configuration.get_console_table();
 
   auto precision = 2;
+  auto similarity_precision = 4;
 
   const auto &report_psnr = configuration.get_report(Metric::PSNR);
   const auto &report_mse = configuration.get_report(Metric::MSE);
   const auto &report_sse = configuration.get_report(Metric::SSE);
   const auto &report_max = configuration.get_report(Metric::MAX_ABS_ERROR);
+  const auto &report_ssim = configuration.get_report(Metric::SSIM);
+  const auto &report_ms_ssim = configuration.get_report(Metric::MS_SSIM);
+  const auto compute_ssim = report_ssim.has_any_report();
+  const auto compute_ms_ssim = report_ms_ssim.has_any_report();
+
+  // all the metrics of a view are computed in one pass and the views are
+  // distributed among the threads; the reports are then built in order
+  const auto number_of_views = static_cast<std::size_t>(t_max) * s_max;
+  std::vector<ViewQuality> view_qualities(number_of_views);
+  Parallel::parallel_for(0, number_of_views,
+      configuration.get_number_of_threads(), [&](auto i) {
+        const auto coordinate = std::make_pair(i / s_max, i % s_max);
+        view_qualities.at(i) =
+            get_view_quality(baseline_lightfield->get_view_at(coordinate),
+                test_lightfield->get_view_at(coordinate), compute_ssim,
+                compute_ms_ssim);
+      });
 
-  // auto printer = ImageMetrics::visitors::PSNRPrinter();
   for (auto t = decltype(t_max){0}; t < t_max; ++t) {
     for (auto s = decltype(s_max){0}; s < s_max; ++s) {
-      const auto &baseline_image = baseline_lightfield->get_image_at({t, s});
-      const auto &test_image = test_lightfield->get_image_at({t, s});
-
-      auto mses = ImageMetrics::get_mse(baseline_image, test_image);
-      auto sum_of_squared_errors =
-          ImageMetrics::get_sum_of_squared_errors(baseline_image, test_image);
-      auto max_abs_errors =
-          ImageMetrics::get_maximum_absolute_error(baseline_image, test_image);
-
+      const auto &quality =
+          view_qualities.at(static_cast<std::size_t>(t) * s_max + s);
+      const auto &statistics = quality.errors;
 
       double view_average_mse = 0.0;
       double view_average_sse = 0.0;
+      double view_average_ssim = 0.0;
+      double view_average_ms_ssim = 0.0;
       std::size_t view_max_abs_error = 0;
       for (auto i = decltype(n_channels){0}; i < n_channels; ++i) {
-        auto mse = mses.at(i);
-        auto max_abs_error = max_abs_errors.at(i);
-        auto sse = sum_of_squared_errors.at(i);
+        auto mse = statistics.at(i).mean_squared_error;
+        auto max_abs_error = statistics.at(i).maximum_absolute_error;
+        auto sse = statistics.at(i).sum_of_squared_errors;
         mse_sum.at(i) += mse;
         sse_sum.at(i) += sse;
         view_average_mse += mse;
@@ -603,6 +724,28 @@ void compute_metric(
         if (report_max.should_report<ReportType::VIEW_CHANNELS>()) {
           channel_max_abs_error_table.at(i)[t][s] = max_abs_error;
         }
+        if (compute_ssim) {
+          auto ssim = quality.structural_similarity.at(i);
+          ssim_sum.at(i) += ssim;
+          view_average_ssim += ssim;
+          if (report_ssim.should_report<ReportType::VIEW_CHANNELS>()) {
+            std::ostringstream str;
+            str << std::fixed << std::setprecision(similarity_precision)
+                << ssim;
+            channel_ssim_table.at(i)[t][s] = str.str();
+          }
+        }
+        if (compute_ms_ssim) {
+          auto ms_ssim = quality.multiscale_structural_similarity.at(i);
+          ms_ssim_sum.at(i) += ms_ssim;
+          view_average_ms_ssim += ms_ssim;
+          if (report_ms_ssim.should_report<ReportType::VIEW_CHANNELS>()) {
+            std::ostringstream str;
+            str << std::fixed << std::setprecision(similarity_precision)
+                << ms_ssim;
+            channel_ms_ssim_table.at(i)[t][s] = str.str();
+          }
+        }
       }
 
 
@@ -630,6 +773,20 @@ void compute_metric(
       if (report_max.should_report<ReportType::VIEW_AVERAGE>()) {
         max_max_abs_error_table[t][s] = view_max_abs_error;
       }
+      if (report_ssim.should_report<ReportType::VIEW_AVERAGE>()) {
+        view_average_ssim /= static_cast<double>(n_channels);
+        std::ostringstream str;
+        str << std::fixed << std::setprecision(similarity_precision)
+            << view_average_ssim;
+        average_ssim_table[t][s] = str.str();
+      }
+      if (report_ms_ssim.should_report<ReportType::VIEW_AVERAGE>()) {
+        view_average_ms_ssim /= static_cast<double>(n_channels);
+        std::ostringstream str;
+        str << std::fixed << std::setprecision(similarity_precision)
+            << view_average_ms_ssim;
+        average_ms_ssim_table[t][s] = str.str();
+      }
     }
   }
 
@@ -646,6 +803,12 @@ void compute_metric(
   show_view_channels_and_view_average_reports<Metric::PSNR>(
       configuration, n_channels, channel_psnr_table, average_psnr_table);
 
+  show_view_channels_and_view_average_reports<Metric::SSIM>(
+      configuration, n_channels, channel_ssim_table, average_ssim_table);
+
+  show_view_channels_and_view_average_reports<Metric::MS_SSIM>(
+      configuration, n_channels, channel_ms_ssim_table, average_ms_ssim_table);
+
 
   double sum_of_mses = 0.0;
   double sum_of_sses = 0.0;
@@ -687,6 +850,9 @@ void compute_metric(
       double psnr = ImageChannelUtils::get_peak_signal_to_noise_ratio(bpp, mse);
       channel_avgs.emplace(Metric::PSNR, psnr);
 
+      channel_avgs.emplace(Metric::SSIM, ssim_sum.at(i) / n_views);
+      channel_avgs.emplace(Metric::MS_SSIM, ms_ssim_sum.at(i) / n_views);
+
       line = 0;
       channel_estimates_table[line++][i + 1] = i;
 
@@ -738,6 +904,17 @@ void compute_metric(
       ImageChannelUtils::get_peak_signal_to_noise_ratio(bpp, average_mse);
   all_avgs.emplace(Metric::PSNR, psnr_of_average_mse);
 
+  auto get_average_over_channels = [n_channels, n_views](
+                                       const std::vector<double> &sums) {
+    auto sum = 0.0;
+    for (const auto channel_sum : sums) {
+      sum += channel_sum / n_views;
+    }
+    return sum / static_cast<double>(n_channels);
+  };
+  all_avgs.emplace(Metric::SSIM, get_average_over_channels(ssim_sum));
+  all_avgs.emplace(Metric::MS_SSIM, get_average_over_channels(ms_ssim_sum));
+
 
   if (configuration.has_report_of_type<ReportType::AVERAGE>()) {
     auto final_report_table = configuration.get_console_table();
@@ -41,10 +41,13 @@
 #include <filesystem>
 #include <iomanip>  //std::setw and std::setfill
 #include <iostream>
+#include <mutex>
+#include <vector>
 #include "Lib/Utils/BasicConfiguration/BasicConfiguration.h"
 #include "Lib/Utils/Image/ImageExceptions.h"
 #include "Lib/Utils/Image/ImageIO.h"
 #include "Lib/Utils/Image/PixelMapFileIO.h"
+#include "Lib/Utils/Parallel/ParallelFor.h"
 #include "cppitertools/product.hpp"
 #include "cppitertools/range.hpp"
 #include "tqdm-cpp/tqdm.hpp"
@@ -59,6 +62,7 @@ class Lenslet13x13ShifterConfiguration : public BasicConfiguration {
   std::string output;
   std::string direction;
   bool show_progress_bar_flag = false;
+  std::size_t number_of_threads = 0;
 
   Lenslet13x13ShifterConfiguration(int argc, char** argv, std::size_t level)
       : BasicConfiguration(argc, argv, level) {
@@ -129,6 +133,19 @@ class Lenslet13x13ShifterConfiguration : public BasicConfiguration {
         },
         this->current_hierarchy_level,
         {[this]() -> std::string { return "false"; }}});
+
+    this->add_cli_json_option({"--number-of-threads", "-nt",
+        "Number of views copied (or shifted) concurrently. "
+        "0 uses one thread per hardware thread.",
+        [this](const nlohmann::json& conf) -> std::optional<std::string> {
+          if (conf.contains("number-of-threads")) {
+            return std::to_string(conf["number-of-threads"].get<uint32_t>());
+          }
+          return std::nullopt;
+        },
+        [this](std::string arg) { this->number_of_threads = std::stoi(arg); },
+        this->current_hierarchy_level,
+        {[this]() -> std::string { return "0"; }}});
   }
 
  public:
@@ -160,6 +177,11 @@ class Lenslet13x13ShifterConfiguration : public BasicConfiguration {
   bool show_progress_bar() const {
     return show_progress_bar_flag;
   }
+
+
+  std::size_t get_number_of_threads() const {
+    return number_of_threads;
+  }
 };
 
 
@@ -220,8 +242,68 @@ bool are_input_and_output_paths_valid(
 }
 
 
+/**
+ * @brief      A view to be copied (or shifted, when shift is not zero) from
+ *             the input to the output directory
+ */
+struct ViewShiftJob {
+  std::string input_view_name;
+  std::string output_view_name;
+  int8_t shift;
+};
+
+
+void run_view_shift_job(const std::string& input_path,
+    const std::string& output_path, const ViewShiftJob& job) {
+  if (job.shift != 0) {
+    shift_view({input_path + job.input_view_name},
+        {output_path + job.output_view_name}, job.shift);
+  } else {
+    copy_view({input_path + job.input_view_name},
+        {output_path + job.output_view_name});
+  }
+}
+
+
+/**
+ * @brief      Runs the jobs using a bounded number of threads (views are
+ *             independent files)
+ */
+void run_view_shift_jobs(const std::string& input_path,
+    const std::string& output_path, const std::vector<ViewShiftJob>& jobs,
+    bool show_bar, std::size_t number_of_threads) {
+  if (show_bar) {
+    //the bar advances once per group of concurrently processed views
+    const auto group_size = Parallel::get_number_of_threads(number_of_threads);
+    std::vector<std::size_t> group_begins;
+    for (std::size_t i = 0; i < jobs.size(); i += group_size) {
+      group_begins.push_back(i);
+    }
+    for (auto&& group_begin : tq::tqdm(group_begins)) {
+      Parallel::parallel_for(group_begin,
+          std::min(group_begin + group_size, jobs.size()), number_of_threads,
+          [&](auto i) {
+            run_view_shift_job(input_path, output_path, jobs[i]);
+          });
+    }
+    return;
+  }
+
+  std::mutex output_mutex;
+  Parallel::parallel_for(0, jobs.size(), number_of_threads, [&](auto i) {
+    {
+      std::lock_guard<std::mutex> lock(output_mutex);
+      std::cout << (jobs[i].shift != 0 ? "Shifting view " : "Copying view ")
+                << jobs[i].input_view_name << '\n';
+    }
+    run_view_shift_job(input_path, output_path, jobs[i]);
+  });
+}
+
+
 void shift_for_encoding(const std::string& input_path,
-    const std::string& output_path, bool show_bar) {
+    const std::string& output_path, bool show_bar,
+    std::size_t number_of_threads) {
   auto initial_t = 1;
   auto initial_s = 1;
   auto final_t = initial_t + 13;
@@ -229,48 +311,28 @@ void shift_for_encoding(const std::string& input_path,
 
   auto t_range = iter::range(initial_t, final_t);
   auto s_range = iter::range(initial_s, final_s);
-  std::vector<std::tuple<int, int>> dimensions;
-
-  for (auto&& coordinate : iter::product(t_range, s_range)) {
-    dimensions.push_back(coordinate);
-  }
-
-  if (show_bar) {
-    for (auto&& [t, s] : tq::tqdm(dimensions)) {
-      auto input_view_name = get_view_name({t, s});
-      auto output_view_name = get_view_name({t - 1, s - 1});
-      if ((t == initial_t) || (t == final_t - 1)) {
-        if ((s == initial_s) || (s == final_s - 1)) {
-          shift_view({input_path + input_view_name},
-              {output_path + output_view_name}, 2);
-          continue;
-        }
-      }
-      copy_view(
-          {input_path + input_view_name}, {output_path + output_view_name});
-    }
-  } else {
-    for (auto&& [t, s] : dimensions) {
-      auto input_view_name = get_view_name({t, s});
-      auto output_view_name = get_view_name({t - 1, s - 1});
-      if ((t == initial_t) || (t == final_t - 1)) {
-        if ((s == initial_s) || (s == final_s - 1)) {
-          std::cout << "Shifting view " << input_view_name << '\n';
-          shift_view({input_path + input_view_name},
-              {output_path + output_view_name}, 2);
-          continue;
-        }
+  std::vector<ViewShiftJob> jobs;
+
+  for (auto&& [t, s] : iter::product(t_range, s_range)) {
+    auto input_view_name = get_view_name({t, s});
+    auto output_view_name = get_view_name({t - 1, s - 1});
+    int8_t shift = 0;
+    if ((t == initial_t) || (t == final_t - 1)) {
+      if ((s == initial_s) || (s == final_s - 1)) {
+        shift = 2;
       }
-      std::cout << "Copying view " << input_view_name << '\n';
-      copy_view(
-          {input_path + input_view_name}, {output_path + output_view_name});
     }
+    jobs.push_back({input_view_name, output_view_name, shift});
   }
+
+  run_view_shift_jobs(
+      input_path, output_path, jobs, show_bar, number_of_threads);
 }
 
 
 void shift_for_decoding(const std::string& input_path,
-    const std::string& output_path, bool show_bar) {
+    const std::string& output_path, bool show_bar,
+    std::size_t number_of_threads) {
   auto initial_t = 0;
   auto initial_s = 0;
   auto final_t = initial_t + 13;
@@ -279,44 +341,22 @@ void shift_for_decoding(const std::string& input_path,
 
   auto t_range = iter::range(initial_t, final_t);
   auto s_range = iter::range(initial_s, final_s);
-  std::vector<std::tuple<int, int>> dimensions;
-
-  for (auto&& coordinate : iter::product(t_range, s_range)) {
-    dimensions.push_back(coordinate);
-  }
-
-
-  if (show_bar) {
-    for (auto&& [t, s] : tq::tqdm(dimensions)) {
-      auto input_view_name = get_view_name({t, s});
-      auto output_view_name = get_view_name({t + 1, s + 1});
-      if ((t == initial_t) || (t == final_t - 1)) {
-        if ((s == initial_s) || (s == final_s - 1)) {
-          shift_view({input_path + input_view_name},
-              {output_path + output_view_name}, -2);
-          continue;
-        }
+  std::vector<ViewShiftJob> jobs;
+
+  for (auto&& [t, s] : iter::product(t_range, s_range)) {
+    auto input_view_name = get_view_name({t, s});
+    auto output_view_name = get_view_name({t + 1, s + 1});
+    int8_t shift = 0;
+    if ((t == initial_t) || (t == final_t - 1)) {
+      if ((s == initial_s) || (s == final_s - 1)) {
+        shift = -2;
       }
-      copy_view(
-          {input_path + input_view_name}, {output_path + output_view_name});
-    }
-  } else {
-    for (auto&& [t, s] : dimensions) {
-      auto input_view_name = get_view_name({t, s});
-      auto output_view_name = get_view_name({t + 1, s + 1});
-      if ((t == initial_t) || (t == final_t - 1)) {
-        if ((s == initial_s) || (s == final_s - 1)) {
-          std::cout << "Shifting view " << input_view_name << '\n';
-          shift_view({input_path + input_view_name},
-              {output_path + output_view_name}, -2);
-          continue;
-        }
-      }
-      std::cout << "Copying view " << input_view_name << '\n';
-      copy_view(
-          {input_path + input_view_name}, {output_path + output_view_name});
     }
+    jobs.push_back({input_view_name, output_view_name, shift});
   }
+
+  run_view_shift_jobs(
+      input_path, output_path, jobs, show_bar, number_of_threads);
 }
 
 
@@ -331,15 +371,16 @@ int main(int argc, char const* argv[]) {
   std::string output_path = configuration.get_output_filename();
   std::string direction = configuration.get_direction();
   bool show_bar = configuration.show_progress_bar();
+  auto number_of_threads = configuration.get_number_of_threads();
 
   if (!are_input_and_output_paths_valid(input_path, output_path)) {
     exit(1);
   }
 
   if (direction == "decode" || direction == "d" || direction == "decoding") {
-    shift_for_decoding(input_path, output_path, show_bar);
+    shift_for_decoding(input_path, output_path, show_bar, number_of_threads);
   } else {
-    shift_for_encoding(input_path, output_path, show_bar);
+    shift_for_encoding(input_path, output_path, show_bar, number_of_threads);
   }
 
   return 0;
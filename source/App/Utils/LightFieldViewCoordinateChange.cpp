@@ -51,10 +51,12 @@
 
 #include <filesystem>
 #include <iostream>
+#include <mutex>
 #include <vector>
 #include "Lib/Part2/Common/PPM3CharViewToFilename.h"
 #include "Lib/Utils/BasicConfiguration/BasicConfiguration.h"
 #include "Lib/Utils/Image/ImageExceptions.h"
+#include "Lib/Utils/Parallel/ParallelFor.h"
 
 
 class LightfieldCoordinateChangeConfiguration : public BasicConfiguration {
@@ -79,6 +81,8 @@ class LightfieldCoordinateChangeConfiguration : public BasicConfiguration {
   uint32_t output_step_t;
   uint32_t output_step_s;
 
+  std::size_t number_of_threads;
+
   /**
    * @brief      Constructs a new instance.
    *
@@ -293,6 +297,19 @@ class LightfieldCoordinateChangeConfiguration : public BasicConfiguration {
             },
             this->current_hierarchy_level,
             {[this]() -> std::string { return "1"; }}});
+
+    this->add_cli_json_option({"--number-of-threads", "-nt",
+        "Number of views copied concurrently. 0 uses one thread per "
+        "hardware thread.",
+        [this](const nlohmann::json& conf) -> std::optional<std::string> {
+          if (conf.contains("number-of-threads")) {
+            return std::to_string(conf["number-of-threads"].get<uint32_t>());
+          }
+          return std::nullopt;
+        },
+        [this](std::string arg) { this->number_of_threads = std::stoul(arg); },
+        this->current_hierarchy_level,
+        {[this]() -> std::string { return "0"; }}});
   }
 
 
@@ -420,6 +437,16 @@ class LightfieldCoordinateChangeConfiguration : public BasicConfiguration {
   std::pair<std::size_t, std::size_t> get_step_output() const {
     return {output_step_t, output_step_s};
   }
+
+
+  /**
+   * @brief      Gets the number of threads used to copy the views.
+   *
+   * @return     The number of threads (0 for one per hardware thread).
+   */
+  std::size_t get_number_of_threads() const {
+    return number_of_threads;
+  }
 };
 
 
@@ -491,21 +518,33 @@ void shift_coordinate_in_filenames(
   auto output_s = initial_output_s;
 
   auto name_translator = PPM3CharViewToFilename();
+  std::vector<std::pair<std::string, std::string>> input_and_output_names;
 
   for (auto t = initial_input_t; t < final_t; t += step_input_t) {
     for (auto s = initial_input_s; s < final_s; s += step_input_s) {
-      auto input_view_name = name_translator.view_position_to_filename({t, s});
-      auto output_view_name =
-          name_translator.view_position_to_filename({output_t, output_s});
-      std::cout << "Copying view " << input_view_name << '\n';
-      std::cout << "To view " << output_view_name << '\n';
-      copy_view(
-          {input_path + input_view_name}, {output_path + output_view_name});
+      input_and_output_names.emplace_back(
+          name_translator.view_position_to_filename({t, s}),
+          name_translator.view_position_to_filename({output_t, output_s}));
       output_s += step_output_s;
     }
     output_t += step_output_t;
     output_s = initial_output_s;
   }
+
+  //views are independent files, thus they are copied concurrently
+  std::mutex output_mutex;
+  Parallel::parallel_for(0, input_and_output_names.size(),
+      configuration.get_number_of_threads(), [&](auto i) {
+        const auto& [input_view_name, output_view_name] =
+            input_and_output_names[i];
+        {
+          std::lock_guard<std::mutex> lock(output_mutex);
+          std::cout << "Copying view " << input_view_name << '\n';
+          std::cout << "To view " << output_view_name << '\n';
+        }
+        copy_view(
+            {input_path + input_view_name}, {output_path + output_view_name});
+      });
 }
 
 
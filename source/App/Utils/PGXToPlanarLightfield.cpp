@@ -0,0 +1,198 @@
+/* The copyright in this software is being made available under the BSD
+ * License, included below. This software may be subject to other third party
+ * and contributor rights, including patent rights, and no such rights are
+ * granted under this license.
+ *
+ * Copyright (c) 2010-2019, ITU/ISO/IEC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *  * Neither the name of the ITU/ISO/IEC nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** \file     PGXToPlanarLightfield.cpp
+ *  \brief    Converts a light field stored as PGX views into a planar
+ *            light-field file (.plf)
+ *  \details  
+ *  \date     2026-10-19
+ */
+
+#include <filesystem>
+#include <iostream>
+#include "Lib/Part2/Common/PlanarLightfieldFile.h"
+#include "Lib/Part2/Common/ViewFromPGXFile.h"
+#include "Lib/Utils/BasicConfiguration/BasicConfiguration.h"
+
+
+class PGXToPlanarLightfieldConfiguration : public BasicConfiguration {
+ private:
+  static constexpr std::size_t current_hierarchy_level = 0;
+
+ protected:
+  std::string input;
+  std::string output;
+  std::size_t number_of_rows_t = 0;
+  std::size_t number_of_columns_s = 0;
+  std::size_t number_of_channels = 3;
+  PGXToPlanarLightfieldConfiguration(
+      int argc, char **argv, std::size_t level)
+      : BasicConfiguration(argc, argv, level) {
+  }
+
+
+  virtual void add_options() override {
+    BasicConfiguration::add_options();
+
+
+    this->add_cli_json_option({"--input", "-i",
+        "Input directory that contains one subdirectory with PGX files for "
+        "each channel.",
+        [this](const nlohmann::json &conf) -> std::optional<std::string> {
+          if (conf.contains("input")) {
+            return conf["input"].get<std::string>();
+          }
+          return std::nullopt;
+        },
+        [this]([[maybe_unused]] std::any v) {
+          this->input = std::any_cast<std::string>(v);
+        },
+        this->current_hierarchy_level});
+
+    this->add_cli_json_option({"--output", "-o",
+        "Output planar light-field filename (.plf).",
+        [this](const nlohmann::json &conf) -> std::optional<std::string> {
+          if (conf.contains("output")) {
+            return conf["output"].get<std::string>();
+          }
+          return std::nullopt;
+        },
+        [this]([[maybe_unused]] std::any v) {
+          this->output = std::any_cast<std::string>(v);
+        },
+        this->current_hierarchy_level});
+
+    this->add_cli_json_option({"--number_of_rows", "-t",
+        "Number of light-field view rows. Mandatory.",
+        [this](const nlohmann::json &conf) -> std::optional<std::string> {
+          if (conf.contains("number_of_rows")) {
+            return std::to_string(conf["number_of_rows"].get<uint32_t>());
+          }
+          return std::nullopt;
+        },
+        [this](std::string arg) { this->number_of_rows_t = std::stoi(arg); },
+        this->current_hierarchy_level});
+
+    this->add_cli_json_option({"--number_of_columns", "-s",
+        "Number of light-field view columns. Mandatory.",
+        [this](const nlohmann::json &conf) -> std::optional<std::string> {
+          if (conf.contains("number_of_columns")) {
+            return std::to_string(conf["number_of_columns"].get<uint32_t>());
+          }
+          return std::nullopt;
+        },
+        [this](std::string arg) { this->number_of_columns_s = std::stoi(arg); },
+        this->current_hierarchy_level});
+
+    this->add_cli_json_option({"--number_of_channels", "-nc",
+        "Number of colour channels (default: 3).",
+        [this](const nlohmann::json &conf) -> std::optional<std::string> {
+          if (conf.contains("number_of_channels")) {
+            return std::to_string(conf["number_of_channels"].get<uint32_t>());
+          }
+          return std::nullopt;
+        },
+        [this](std::string arg) { this->number_of_channels = std::stoi(arg); },
+        this->current_hierarchy_level});
+  }
+
+ public:
+  PGXToPlanarLightfieldConfiguration(int argc, char **argv)
+      : PGXToPlanarLightfieldConfiguration(argc, argv,
+            PGXToPlanarLightfieldConfiguration::current_hierarchy_level) {
+    this->init(argc, argv);
+  }
+
+
+  virtual ~PGXToPlanarLightfieldConfiguration() = default;
+
+
+  const std::string &get_input_filename() const {
+    return input;
+  }
+
+
+  const std::string &get_output_filename() const {
+    return output;
+  }
+
+
+  std::size_t get_number_of_rows_t() const {
+    return number_of_rows_t;
+  }
+
+
+  std::size_t get_number_of_columns_s() const {
+    return number_of_columns_s;
+  }
+
+
+  std::size_t get_number_of_channels() const {
+    return number_of_channels;
+  }
+};
+
+
+int main(int argc, char const *argv[]) {
+  auto configuration =
+      PGXToPlanarLightfieldConfiguration(argc, const_cast<char **>(argv));
+  if (configuration.is_help_mode()) {
+    exit(0);
+  }
+
+  const auto t_max = configuration.get_number_of_rows_t();
+  const auto s_max = configuration.get_number_of_columns_s();
+  const auto number_of_channels = configuration.get_number_of_channels();
+  if ((t_max == 0) || (s_max == 0)) {
+    std::cerr << "The number of rows and columns must be informed."
+              << std::endl;
+    exit(1);
+  }
+
+  const auto first_view = ViewFromPGXFile<uint16_t>(
+      configuration.get_input_filename(), {0, 0}, number_of_channels);
+  auto planar_file = PlanarLightfieldFile(configuration.get_output_filename(),
+      {t_max, s_max, first_view.get_height(), first_view.get_width()},
+      number_of_channels, first_view.get_bpp());
+
+  for (auto t = decltype(t_max){0}; t < t_max; ++t) {
+    for (auto s = decltype(s_max){0}; s < s_max; ++s) {
+      auto view = ViewFromPGXFile<uint16_t>(
+          configuration.get_input_filename(), {t, s}, number_of_channels);
+      view.load_image({view.get_width(), view.get_height()});
+      planar_file.write_view(t, s, *(view.get_image_ptr()));
+    }
+  }
+
+  return 0;
+}
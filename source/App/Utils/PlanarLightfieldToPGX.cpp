@@ -0,0 +1,148 @@
+/* The copyright in this software is being made available under the BSD
+ * License, included below. This software may be subject to other third party
+ * and contributor rights, including patent rights, and no such rights are
+ * granted under this license.
+ *
+ * Copyright (c) 2010-2019, ITU/ISO/IEC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *  * Neither the name of the ITU/ISO/IEC nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** \file     PlanarLightfieldToPGX.cpp
+ *  \brief    Converts a planar light-field file (.plf) into a light field
+ *            stored as PGX views
+ *  \details  
+ *  \date     2026-10-19
+ */
+
+#include <filesystem>
+#include <iostream>
+#include "Lib/Part2/Common/PlanarLightfieldFile.h"
+#include "Lib/Part2/Common/ViewFromPGXFile.h"
+#include "Lib/Utils/BasicConfiguration/BasicConfiguration.h"
+#include "Lib/Utils/Image/UndefinedImage.h"
+
+
+class PlanarLightfieldToPGXConfiguration : public BasicConfiguration {
+ private:
+  static constexpr std::size_t current_hierarchy_level = 0;
+
+ protected:
+  std::string input;
+  std::string output;
+  PlanarLightfieldToPGXConfiguration(
+      int argc, char **argv, std::size_t level)
+      : BasicConfiguration(argc, argv, level) {
+  }
+
+
+  virtual void add_options() override {
+    BasicConfiguration::add_options();
+
+
+    this->add_cli_json_option({"--input", "-i",
+        "Input planar light-field filename (.plf).",
+        [this](const nlohmann::json &conf) -> std::optional<std::string> {
+          if (conf.contains("input")) {
+            return conf["input"].get<std::string>();
+          }
+          return std::nullopt;
+        },
+        [this]([[maybe_unused]] std::any v) {
+          this->input = std::any_cast<std::string>(v);
+        },
+        this->current_hierarchy_level});
+
+    this->add_cli_json_option({"--output", "-o",
+        "Output directory. One subdirectory with PGX files is created for "
+        "each channel.",
+        [this](const nlohmann::json &conf) -> std::optional<std::string> {
+          if (conf.contains("output")) {
+            return conf["output"].get<std::string>();
+          }
+          return std::nullopt;
+        },
+        [this]([[maybe_unused]] std::any v) {
+          this->output = std::any_cast<std::string>(v);
+        },
+        this->current_hierarchy_level});
+  }
+
+ public:
+  PlanarLightfieldToPGXConfiguration(int argc, char **argv)
+      : PlanarLightfieldToPGXConfiguration(argc, argv,
+            PlanarLightfieldToPGXConfiguration::current_hierarchy_level) {
+    this->init(argc, argv);
+  }
+
+
+  virtual ~PlanarLightfieldToPGXConfiguration() = default;
+
+
+  const std::string &get_input_filename() const {
+    return input;
+  }
+
+
+  const std::string &get_output_filename() const {
+    return output;
+  }
+};
+
+
+int main(int argc, char const *argv[]) {
+  auto configuration =
+      PlanarLightfieldToPGXConfiguration(argc, const_cast<char **>(argv));
+  if (configuration.is_help_mode()) {
+    exit(0);
+  }
+
+  const auto planar_file =
+      PlanarLightfieldFile(configuration.get_input_filename());
+  const auto& dimension = planar_file.get_dimension();
+  const auto number_of_channels = planar_file.get_number_of_channels();
+  const auto output = std::filesystem::path(configuration.get_output_filename());
+
+  for (auto c = decltype(number_of_channels){0}; c < number_of_channels; ++c) {
+    std::filesystem::create_directories(output / std::to_string(c));
+  }
+
+  for (auto t = decltype(dimension.get_t()){0}; t < dimension.get_t(); ++t) {
+    for (auto s = decltype(dimension.get_s()){0}; s < dimension.get_s(); ++s) {
+      auto image = std::make_unique<UndefinedImage<uint16_t>>(dimension.get_u(),
+          dimension.get_v(), planar_file.get_bits_per_sample(),
+          number_of_channels);
+      planar_file.read_view(t, s, *image);
+      auto view = ViewFromPGXFile<uint16_t>(output.string(), {t, s},
+          dimension.get_v_and_u(), planar_file.get_bits_per_sample(),
+          number_of_channels);
+      view.set_image(std::move(image));
+      view.write_image(true);
+    }
+  }
+
+  return 0;
+}
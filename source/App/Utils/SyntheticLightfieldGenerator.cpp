@@ -0,0 +1,370 @@
+/* The copyright in this software is being made available under the BSD
+ * License, included below. This software may be subject to other third party
+ * and contributor rights, including patent rights, and no such rights are
+ * granted under this license.
+ *
+ * Copyright (c) 2010-2019, ITU/ISO/IEC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *  * Neither the name of the ITU/ISO/IEC nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** \file     SyntheticLightfieldGenerator.cpp
+ *  \brief    Generates synthetic light fields of any size, number of
+ *            channels and bit depth
+ *  \details  The views are written as PGX files (one subdirectory per
+ *            channel), as PPM files (three channels only) or to a planar
+ *            light-field file (.plf). The content (flat, gradient, noise, a
+ *            textured plane or textured and flat planes with parallax) is
+ *            described in SyntheticLightfield.h.
+ *  \date     2026-10-19
+ */
+
+#include <filesystem>
+#include <iostream>
+#include <mutex>
+#include "Lib/Part2/Common/PGX3CharViewToFilename.h"
+#include "Lib/Part2/Common/PPM3CharViewToFilename.h"
+#include "Lib/Part2/Common/PlanarLightfieldFile.h"
+#include "Lib/Part2/Common/SyntheticLightfield.h"
+#include "Lib/Utils/BasicConfiguration/BasicConfiguration.h"
+#include "Lib/Utils/Image/ImageIO.h"
+#include "Lib/Utils/Image/ImageUtils.h"
+#include "Lib/Utils/Image/RGBImage.h"
+#include "Lib/Utils/Image/UndefinedImage.h"
+#include "Lib/Utils/Parallel/ParallelFor.h"
+
+
+class SyntheticLightfieldGeneratorConfiguration : public BasicConfiguration {
+ private:
+  static constexpr std::size_t current_hierarchy_level = 0;
+
+ protected:
+  std::string output;
+  std::string format;
+  std::size_t number_of_rows_t = 0;
+  std::size_t number_of_columns_s = 0;
+  std::size_t height_v = 0;
+  std::size_t width_u = 0;
+  std::size_t number_of_channels = 3;
+  std::size_t bits_per_sample = 10;
+  std::string content;
+  std::string disparities;
+  double noise_amplitude = 0.01;
+  uint32_t seed = 0;
+  std::size_t number_of_threads = 0;
+
+  SyntheticLightfieldGeneratorConfiguration(
+      int argc, char **argv, std::size_t level)
+      : BasicConfiguration(argc, argv, level) {
+  }
+
+
+  void add_size_option(const std::string &long_name,
+      const std::string &short_name, const std::string &description,
+      std::size_t &destination) {
+    const auto key = long_name.substr(2);
+    this->add_cli_json_option({long_name, short_name, description,
+        [key](const nlohmann::json &conf) -> std::optional<std::string> {
+          if (conf.contains(key)) {
+            return std::to_string(conf[key].get<uint32_t>());
+          }
+          return std::nullopt;
+        },
+        [&destination](std::string arg) { destination = std::stoul(arg); },
+        this->current_hierarchy_level});
+  }
+
+
+  virtual void add_options() override {
+    BasicConfiguration::add_options();
+
+    this->add_cli_json_option({"--output", "-o",
+        "Output directory (pgx and ppm formats) or planar light-field "
+        "filename (plf format). Mandatory.",
+        [this](const nlohmann::json &conf) -> std::optional<std::string> {
+          if (conf.contains("output")) {
+            return conf["output"].get<std::string>();
+          }
+          return std::nullopt;
+        },
+        [this](std::string arg) { this->output = arg; },
+        this->current_hierarchy_level});
+
+    this->add_cli_json_option({"--format", "-f",
+        "Output format: pgx (one subdirectory per channel), ppm (three "
+        "channels only) or plf (planar light-field file).",
+        [this](const nlohmann::json &conf) -> std::optional<std::string> {
+          if (conf.contains("format")) {
+            return conf["format"].get<std::string>();
+          }
+          return std::nullopt;
+        },
+        [this](std::string arg) { this->format = arg; },
+        this->current_hierarchy_level,
+        {[this]() -> std::string { return "pgx"; }}});
+
+    add_size_option("--number_of_rows", "-t",
+        "Number of light-field view rows. Mandatory.", number_of_rows_t);
+    add_size_option("--number_of_columns", "-s",
+        "Number of light-field view columns. Mandatory.",
+        number_of_columns_s);
+    add_size_option(
+        "--view_height", "-v", "Height of the views. Mandatory.", height_v);
+    add_size_option(
+        "--view_width", "-u", "Width of the views. Mandatory.", width_u);
+
+    this->add_cli_json_option({"--number_of_channels", "-nc",
+        "Number of colour channels.",
+        [this](const nlohmann::json &conf) -> std::optional<std::string> {
+          if (conf.contains("number_of_channels")) {
+            return std::to_string(conf["number_of_channels"].get<uint32_t>());
+          }
+          return std::nullopt;
+        },
+        [this](std::string arg) { this->number_of_channels = std::stoul(arg); },
+        this->current_hierarchy_level,
+        {[this]() -> std::string { return "3"; }}});
+
+    this->add_cli_json_option({"--bits_per_sample", "-bps",
+        "Bits per sample, from 1 to 16.",
+        [this](const nlohmann::json &conf) -> std::optional<std::string> {
+          if (conf.contains("bits_per_sample")) {
+            return std::to_string(conf["bits_per_sample"].get<uint32_t>());
+          }
+          return std::nullopt;
+        },
+        [this](std::string arg) { this->bits_per_sample = std::stoul(arg); },
+        this->current_hierarchy_level,
+        {[this]() -> std::string { return "10"; }}});
+
+    this->add_cli_json_option({"--content", "-content",
+        "Content of the light field: flat, gradient, noise, texture (a "
+        "textured plane at the first disparity) or planes (textured and flat "
+        "planes at all disparities, with occlusions).",
+        [this](const nlohmann::json &conf) -> std::optional<std::string> {
+          if (conf.contains("content")) {
+            return conf["content"].get<std::string>();
+          }
+          return std::nullopt;
+        },
+        [this](std::string arg) { this->content = arg; },
+        this->current_hierarchy_level,
+        {[this]() -> std::string { return "planes"; }}});
+
+    this->add_cli_json_option({"--disparities", "-d",
+        "Comma separated disparities (in pixels per view) of the planes, "
+        "from back to front.",
+        [this](const nlohmann::json &conf) -> std::optional<std::string> {
+          if (conf.contains("disparities")) {
+            return conf["disparities"].get<std::string>();
+          }
+          return std::nullopt;
+        },
+        [this](std::string arg) { this->disparities = arg; },
+        this->current_hierarchy_level,
+        {[this]() -> std::string { return "-0.5,0.5,1.5"; }}});
+
+    this->add_cli_json_option({"--noise", "-n",
+        "Amplitude of the additive noise, relative to the maximum sample "
+        "value.",
+        [this](const nlohmann::json &conf) -> std::optional<std::string> {
+          if (conf.contains("noise")) {
+            return std::to_string(conf["noise"].get<double>());
+          }
+          return std::nullopt;
+        },
+        [this](std::string arg) { this->noise_amplitude = std::stod(arg); },
+        this->current_hierarchy_level,
+        {[this]() -> std::string { return "0.01"; }}});
+
+    this->add_cli_json_option({"--seed", "-seed",
+        "Seed of the content.",
+        [this](const nlohmann::json &conf) -> std::optional<std::string> {
+          if (conf.contains("seed")) {
+            return std::to_string(conf["seed"].get<uint32_t>());
+          }
+          return std::nullopt;
+        },
+        [this](std::string arg) { this->seed = std::stoul(arg); },
+        this->current_hierarchy_level,
+        {[this]() -> std::string { return "0"; }}});
+
+    this->add_cli_json_option({"--number-of-threads", "-nt",
+        "Number of views generated concurrently. "
+        "0 uses one thread per hardware thread.",
+        [this](const nlohmann::json &conf) -> std::optional<std::string> {
+          if (conf.contains("number-of-threads")) {
+            return std::to_string(conf["number-of-threads"].get<uint32_t>());
+          }
+          return std::nullopt;
+        },
+        [this](std::string arg) { this->number_of_threads = std::stoul(arg); },
+        this->current_hierarchy_level,
+        {[this]() -> std::string { return "0"; }}});
+  }
+
+ public:
+  SyntheticLightfieldGeneratorConfiguration(int argc, char **argv)
+      : SyntheticLightfieldGeneratorConfiguration(
+            argc, argv, current_hierarchy_level) {
+    this->init(argc, argv);
+  }
+
+
+  virtual ~SyntheticLightfieldGeneratorConfiguration() = default;
+
+
+  const std::string &get_output_filename() const {
+    return output;
+  }
+
+
+  const std::string &get_format() const {
+    return format;
+  }
+
+
+  bool has_valid_dimension() const {
+    return (number_of_rows_t != 0) && (number_of_columns_s != 0) &&
+           (height_v != 0) && (width_u != 0);
+  }
+
+
+  SyntheticLightfieldParameters get_parameters() const {
+    auto parameters = SyntheticLightfieldParameters{
+        {number_of_rows_t, number_of_columns_s, height_v, width_u}};
+    parameters.number_of_channels = number_of_channels;
+    parameters.bits_per_sample = bits_per_sample;
+    parameters.content = get_synthetic_lightfield_content(content);
+    parameters.disparities = get_synthetic_lightfield_disparities(disparities);
+    parameters.noise_amplitude = noise_amplitude;
+    parameters.seed = seed;
+    return parameters;
+  }
+
+
+  std::size_t get_number_of_threads() const {
+    return number_of_threads;
+  }
+};
+
+
+void write_pgx_view(const std::filesystem::path &output_path,
+    const std::pair<std::size_t, std::size_t> &position,
+    const UndefinedImage<uint16_t> &view) {
+  const auto filename =
+      PGX3CharViewToFilename().view_position_to_filename(position);
+  auto channels = ImageUtils::get_splitting_of(view);
+  for (auto c = std::size_t(0); c < channels.size(); ++c) {
+    ImageIO::imwrite(*(channels[c]),
+        (output_path / std::to_string(c) / filename).string(), true);
+  }
+}
+
+
+void write_ppm_view(const std::filesystem::path &output_path,
+    const std::pair<std::size_t, std::size_t> &position,
+    const UndefinedImage<uint16_t> &view) {
+  auto image =
+      RGBImage<uint16_t>(view.get_width(), view.get_height(), view.get_bpp());
+  for (auto c = 0; c < 3; ++c) {
+    image.get_channel(c) = view.get_channel(c);
+  }
+  ImageIO::imwrite(image,
+      (output_path / PPM3CharViewToFilename().view_position_to_filename(
+                         position))
+          .string(),
+      true);
+}
+
+
+int main(int argc, char const *argv[]) {
+  auto configuration = SyntheticLightfieldGeneratorConfiguration(
+      argc, const_cast<char **>(argv));
+  if (configuration.is_help_mode()) {
+    exit(0);
+  }
+
+  if (!configuration.has_valid_dimension() ||
+      configuration.get_output_filename().empty()) {
+    std::cerr << "The output and the light-field dimension (-t, -s, -v and "
+                 "-u) must be informed."
+              << std::endl;
+    exit(1);
+  }
+
+  const auto &format = configuration.get_format();
+  if ((format != "pgx") && (format != "ppm") && (format != "plf")) {
+    std::cerr << "Unknown output format " << format
+              << " (expected pgx, ppm or plf)." << std::endl;
+    exit(1);
+  }
+
+  const auto generator = SyntheticLightfield(configuration.get_parameters());
+  const auto &parameters = generator.get_parameters();
+  const auto &dimension = parameters.dimension;
+  if ((format == "ppm") && (parameters.number_of_channels != 3)) {
+    std::cerr << "The ppm format requires three channels." << std::endl;
+    exit(1);
+  }
+
+  const auto output_path =
+      std::filesystem::path(configuration.get_output_filename());
+  auto planar_file = std::unique_ptr<PlanarLightfieldFile>();
+  if (format == "plf") {
+    planar_file = std::make_unique<PlanarLightfieldFile>(output_path.string(),
+        dimension, parameters.number_of_channels, parameters.bits_per_sample);
+  } else if (format == "pgx") {
+    for (auto c = std::size_t(0); c < parameters.number_of_channels; ++c) {
+      std::filesystem::create_directories(output_path / std::to_string(c));
+    }
+  } else {
+    std::filesystem::create_directories(output_path);
+  }
+
+  //views are generated concurrently; the planar file is written in turns
+  std::mutex planar_file_mutex;
+  const auto number_of_views_in_s = dimension.get_s();
+  Parallel::parallel_for(0, dimension.get_number_of_views_per_lightfield(),
+      configuration.get_number_of_threads(), [&](auto i) {
+        const auto position =
+            std::make_pair(i / number_of_views_in_s, i % number_of_views_in_s);
+        auto view = UndefinedImage<uint16_t>(dimension.get_u(),
+            dimension.get_v(), parameters.bits_per_sample,
+            parameters.number_of_channels);
+        generator.fill_view(position, view);
+        if (format == "pgx") {
+          write_pgx_view(output_path, position, view);
+        } else if (format == "ppm") {
+          write_ppm_view(output_path, position, view);
+        } else {
+          std::lock_guard<std::mutex> lock(planar_file_mutex);
+          planar_file->write_view(position.first, position.second, view);
+        }
+      });
+
+  return 0;
+}
@@ -0,0 +1,186 @@
+/* The copyright in this software is being made available under the BSD
+ * License, included below. This software may be subject to other third party
+ * and contributor rights, including patent rights, and no such rights are
+ * granted under this license.
+ *
+ * Copyright (c) 2010-2019, ITU/ISO/IEC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *  * Neither the name of the ITU/ISO/IEC nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** \file     BenchmarkData.cpp
+ *  \brief    Deterministic synthetic data used by the jplm-bench benchmarks.
+ *  \details  
+ *  \date     2026-10-19
+ */
+
+#include "Benchmarks/BenchmarkData.h"
+#include <filesystem>
+#include <random>
+#include "Lib/Part2/Common/SyntheticLightfield.h"
+
+
+namespace BenchmarkData {
+
+
+namespace {
+
+//fixed seed, so that every run uses the same data
+constexpr auto seed = std::mt19937::result_type(20261019);
+
+
+std::vector<char*> get_argv(std::vector<std::string>& arguments) {
+  auto argv = std::vector<char*>();
+  argv.reserve(arguments.size());
+  for (auto& argument : arguments) {
+    argv.push_back(const_cast<char*>(argument.c_str()));
+  }
+  return argv;
+}
+
+}  // namespace
+
+
+std::vector<uint16_t> get_light_field_samples(
+    const LightfieldDimension<std::size_t>& dimension,
+    std::size_t number_of_channels, std::size_t bits_per_sample) {
+  auto parameters = SyntheticLightfieldParameters{dimension};
+  parameters.number_of_channels = number_of_channels;
+  parameters.bits_per_sample = bits_per_sample;
+  return SyntheticLightfield(parameters).get_planar_samples();
+}
+
+
+Block4D get_block_4d(const LightfieldDimension<uint32_t>& dimension,
+    std::size_t bits_per_sample) {
+  auto parameters = SyntheticLightfieldParameters{
+      {dimension.get_t(), dimension.get_s(), dimension.get_v(),
+          dimension.get_u()}};
+  parameters.number_of_channels = 1;
+  parameters.bits_per_sample = bits_per_sample;
+  const auto generator = SyntheticLightfield(parameters);
+  const auto level_shift =
+      static_cast<block4DElementType>(1 << (bits_per_sample - 1));
+  auto block = Block4D(dimension);
+  for (auto t = uint32_t(0); t < dimension.get_t(); ++t) {
+    for (auto s = uint32_t(0); s < dimension.get_s(); ++s) {
+      for (auto v = uint32_t(0); v < dimension.get_v(); ++v) {
+        for (auto u = uint32_t(0); u < dimension.get_u(); ++u) {
+          block.set_pixel_at(
+              generator.get_sample(t, s, 0, v, u) - level_shift, t, s, v, u);
+        }
+      }
+    }
+  }
+  return block;
+}
+
+
+DCT4DCoefficientsRegistry get_transform_coefficients(
+    const LightfieldDimension<uint32_t>& maximal_transform_dimension) {
+  return DCT4DCoefficientsRegistry(
+      maximal_transform_dimension.as_tuple(), {1.0, 1.0, 1.0, 1.0});
+}
+
+
+void setup_hierarchical_4d_encoder(Hierarchical4DEncoder& encoder,
+    const LightfieldDimension<uint32_t>& maximal_transform_dimension,
+    std::size_t bits_per_sample) {
+  encoder.set_transform_dimension(maximal_transform_dimension);
+  encoder.create_temporary_buffer();
+  encoder.set_minimum_transform_dimension({1, 1, 4, 4});
+  encoder.set_lightfield_dimension(maximal_transform_dimension);
+  encoder.set_level_shift((1 << bits_per_sample) - 1);
+}
+
+
+void fill_image(Image<uint16_t>& image, std::size_t t, std::size_t s) {
+  auto parameters = SyntheticLightfieldParameters{
+      {t + 1, s + 1, image.get_height(), image.get_width()}};
+  parameters.number_of_channels = image.get_number_of_channels();
+  parameters.bits_per_sample = image.get_bpp();
+  SyntheticLightfield(parameters).fill_view({t, s}, image);
+}
+
+
+std::vector<bool> get_bits(
+    std::size_t number_of_bits, double probability_of_zero) {
+  auto generator = std::mt19937(seed);
+  auto distribution = std::bernoulli_distribution(1.0 - probability_of_zero);
+  auto bits = std::vector<bool>();
+  bits.reserve(number_of_bits);
+  for (auto i = std::size_t(0); i < number_of_bits; ++i) {
+    bits.push_back(distribution(generator));
+  }
+  return bits;
+}
+
+
+std::shared_ptr<JPLMEncoderConfigurationLightField4DTransformMode>
+get_encoder_configuration(const LightfieldDimension<std::size_t>& dimension,
+    std::size_t number_of_channels, double lambda,
+    const LightfieldDimension<uint32_t>& maximal_transform_dimension,
+    const std::vector<std::string>& extra_arguments) {
+  const auto& [max_t, max_s, max_v, max_u] = maximal_transform_dimension;
+  auto arguments = std::vector<std::string>({"", "--part", "2", "--type",
+      "0", "--enum-cs", "YCbCr_2", "-t", std::to_string(dimension.get_t()),
+      "-s", std::to_string(dimension.get_s()), "-v",
+      std::to_string(dimension.get_v()), "-u",
+      std::to_string(dimension.get_u()), "-nc",
+      std::to_string(number_of_channels), "--lambda", std::to_string(lambda),
+      "--transform_size_maximum_inter_view_vertical", std::to_string(max_t),
+      "--transform_size_maximum_inter_view_horizontal", std::to_string(max_s),
+      "--transform_size_maximum_intra_view_vertical", std::to_string(max_v),
+      "--transform_size_maximum_intra_view_horizontal", std::to_string(max_u),
+      "--transform_size_minimum_inter_view_vertical", "1",
+      "--transform_size_minimum_inter_view_horizontal", "1",
+      "--transform_size_minimum_intra_view_vertical", "4",
+      "--transform_size_minimum_intra_view_horizontal", "4"});
+  arguments.insert(
+      arguments.end(), extra_arguments.begin(), extra_arguments.end());
+  auto argv = get_argv(arguments);
+  return std::make_shared<JPLMEncoderConfigurationLightField4DTransformMode>(
+      static_cast<int>(argv.size()), argv.data());
+}
+
+
+std::shared_ptr<JPLMDecoderConfiguration> get_decoder_configuration() {
+  auto arguments = std::vector<std::string>({""});
+  auto argv = get_argv(arguments);
+  return std::make_shared<JPLMDecoderConfiguration>(
+      static_cast<int>(argv.size()), argv.data());
+}
+
+
+std::string get_temporary_filename(const std::string& name) {
+  const auto directory =
+      std::filesystem::temp_directory_path() / "jplm_benchmarks";
+  std::filesystem::create_directories(directory);
+  return (directory / name).string();
+}
+
+
+}  // namespace BenchmarkData
@@ -0,0 +1,143 @@
+/* The copyright in this software is being made available under the BSD
+ * License, included below. This software may be subject to other third party
+ * and contributor rights, including patent rights, and no such rights are
+ * granted under this license.
+ *
+ * Copyright (c) 2010-2019, ITU/ISO/IEC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *  * Neither the name of the ITU/ISO/IEC nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** \file     BenchmarkData.h
+ *  \brief    Deterministic synthetic data used by the jplm-bench benchmarks.
+ *  \details  All data is generated by SyntheticLightfield (no resource files
+ *            or network access are needed), so that every run of a benchmark
+ *            processes exactly the same samples.
+ *  \date     2026-10-19
+ */
+
+#ifndef JPLM_BENCHMARKS_BENCHMARKDATA_H__
+#define JPLM_BENCHMARKS_BENCHMARKDATA_H__
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+#include "Lib/Common/JPLMDecoderConfiguration.h"
+#include "Lib/Common/JPLMEncoderConfigurationLightField4DTransformMode.h"
+#include "Lib/Part2/Common/LightfieldDimension.h"
+#include "Lib/Part2/Common/TransformMode/Block4D.h"
+#include "Lib/Part2/Common/TransformMode/DCT4DCoefficientsRegistry.h"
+#include "Lib/Part2/Encoder/TransformMode/Hierarchical4DEncoder.h"
+#include "Lib/Utils/Image/Image.h"
+
+
+namespace BenchmarkData {
+
+
+/**
+ * \brief      Gets the samples of a synthetic light field (textured and flat
+ * planes with parallax), in the planar (t, s, c, v, u) order used by
+ * LightfieldMemoryIO::from_planar_buffer.
+ */
+std::vector<uint16_t> get_light_field_samples(
+    const LightfieldDimension<std::size_t>& dimension,
+    std::size_t number_of_channels, std::size_t bits_per_sample);
+
+
+/**
+ * \brief      Gets a 4D block with the (level shifted) samples of the first
+ * channel of the synthetic light field.
+ */
+Block4D get_block_4d(const LightfieldDimension<uint32_t>& dimension,
+    std::size_t bits_per_sample);
+
+
+/**
+ * \brief      Gets the forward and inverse DCT coefficients (with unitary
+ * gains) for transforms up to the given dimension.
+ */
+DCT4DCoefficientsRegistry get_transform_coefficients(
+    const LightfieldDimension<uint32_t>& maximal_transform_dimension);
+
+
+/**
+ * \brief      Sets up the hierarchical 4D encoder as done by the 4D transform
+ * mode encoder, for a light field whose size equals the transform dimension
+ * and for the minimal transform dimension used by get_encoder_configuration.
+ */
+void setup_hierarchical_4d_encoder(Hierarchical4DEncoder& encoder,
+    const LightfieldDimension<uint32_t>& maximal_transform_dimension,
+    std::size_t bits_per_sample);
+
+
+/**
+ * \brief      Fills all channels of an image with the samples of the view
+ * (t, s) of the synthetic light field.
+ */
+void fill_image(Image<uint16_t>& image, std::size_t t = 0, std::size_t s = 0);
+
+
+/**
+ * \brief      Gets a sequence of pseudo-random bits, in which the probability
+ * of a zero is probability_of_zero.
+ */
+std::vector<bool> get_bits(
+    std::size_t number_of_bits, double probability_of_zero);
+
+
+/**
+ * \brief      Gets the configuration of a 4D transform mode encoder of the
+ * light field with the given dimension.
+ *
+ * \param[in]  maximal_transform_dimension  The maximal transform dimension,
+ *                                          also used as the 4D block size
+ * \param[in]  extra_arguments  Further command line options of the encoder
+ */
+std::shared_ptr<JPLMEncoderConfigurationLightField4DTransformMode>
+get_encoder_configuration(const LightfieldDimension<std::size_t>& dimension,
+    std::size_t number_of_channels, double lambda,
+    const LightfieldDimension<uint32_t>& maximal_transform_dimension,
+    const std::vector<std::string>& extra_arguments = {});
+
+
+/**
+ * \brief      Gets the configuration of a decoder (whose input and output
+ * paths are not used by the in-memory decoding).
+ */
+std::shared_ptr<JPLMDecoderConfiguration> get_decoder_configuration();
+
+
+/**
+ * \brief      Gets a path in the temporary directory for files written by the
+ * benchmarks (the directory is created if needed).
+ */
+std::string get_temporary_filename(const std::string& name);
+
+
+}  // namespace BenchmarkData
+
+#endif /* end of include guard: JPLM_BENCHMARKS_BENCHMARKDATA_H__ */
@@ -0,0 +1,187 @@
+/* The copyright in this software is being made available under the BSD
+ * License, included below. This software may be subject to other third party
+ * and contributor rights, including patent rights, and no such rights are
+ * granted under this license.
+ *
+ * Copyright (c) 2010-2019, ITU/ISO/IEC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *  * Neither the name of the ITU/ISO/IEC nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** \file     JPLMMemoryCodecBenchmarks.cpp
+ *  \brief    Encoding and decoding benchmarks of whole light fields.
+ *  \details  Synthetic light fields of parametric size (t, s, v, u) with
+ *            three 10 bit channels are encoded and decoded in memory, with a
+ *            5x5x31x31 maximal transform size (clipped to the light field
+ *            size). The rate of the encoded light field (in bits per pixel)
+ *            is reported as a counter, and the encoders also report the
+ *            PSNR of the decoded light field.
+ *  \date     2026-10-19
+ */
+
+#include <algorithm>
+#include <cmath>
+#include "Benchmarks/BenchmarkData.h"
+#include "Lib/Common/JPLMMemoryCodec.h"
+#include "benchmark/benchmark.h"
+
+
+namespace {
+
+constexpr auto bits_per_sample = std::size_t(10);
+constexpr auto number_of_channels = std::size_t(3);
+constexpr auto lambda = 1000.0;
+
+
+struct LightFieldCodingSetup {
+  LightfieldDimension<std::size_t> dimension;
+  std::vector<uint16_t> samples;
+  std::shared_ptr<JPLMEncoderConfigurationLightField4DTransformMode>
+      configuration;
+};
+
+
+LightFieldCodingSetup get_setup(const benchmark::State& state,
+    const std::vector<std::string>& extra_arguments = {}) {
+  const auto dimension = LightfieldDimension<std::size_t>(
+      static_cast<std::size_t>(state.range(0)),
+      static_cast<std::size_t>(state.range(1)),
+      static_cast<std::size_t>(state.range(2)),
+      static_cast<std::size_t>(state.range(3)));
+  const auto get_transform_size = [](auto size, uint32_t maximum) {
+    return std::min(static_cast<uint32_t>(size), maximum);
+  };
+  const auto maximal_transform_dimension = LightfieldDimension<uint32_t>(
+      get_transform_size(dimension.get_t(), 5),
+      get_transform_size(dimension.get_s(), 5),
+      get_transform_size(dimension.get_v(), 31),
+      get_transform_size(dimension.get_u(), 31));
+  return {dimension,
+      BenchmarkData::get_light_field_samples(
+          dimension, number_of_channels, bits_per_sample),
+      BenchmarkData::get_encoder_configuration(dimension, number_of_channels,
+          lambda, maximal_transform_dimension, extra_arguments)};
+}
+
+
+std::shared_ptr<LightfieldMemoryIO<uint16_t>> get_input(
+    const LightFieldCodingSetup& setup) {
+  return LightfieldMemoryIO<uint16_t>::from_planar_buffer(setup.samples.data(),
+      setup.dimension, number_of_channels, bits_per_sample);
+}
+
+
+void set_counters(benchmark::State& state,
+    const LightFieldCodingSetup& setup, std::size_t encoded_size) {
+  const auto number_of_pixels =
+      setup.dimension.get_number_of_pixels_per_lightfield();
+  state.SetItemsProcessed(state.iterations() * number_of_pixels);
+  state.counters["bpp"] =
+      static_cast<double>(8 * encoded_size) / number_of_pixels;
+}
+
+
+double get_psnr(
+    const LightFieldCodingSetup& setup, const std::vector<std::byte>& bytes) {
+  const auto decoded = JPLMMemoryCodec::decode_light_field(
+      bytes.data(), bytes.size(), BenchmarkData::get_decoder_configuration());
+  auto squared_error = 0.0;
+  for (auto i = std::size_t(0); i < setup.samples.size(); ++i) {
+    const auto error = static_cast<double>(decoded.samples[i]) -
+                       static_cast<double>(setup.samples[i]);
+    squared_error += error * error;
+  }
+  const auto mse = squared_error / static_cast<double>(setup.samples.size());
+  const auto peak = static_cast<double>((1 << bits_per_sample) - 1);
+  return 10.0 * std::log10(peak * peak / mse);
+}
+
+
+void add_light_field_sizes(benchmark::internal::Benchmark* benchmark) {
+  benchmark->ArgNames({"t", "s", "v", "u"});
+  benchmark->Args({3, 3, 64, 64});
+  benchmark->Args({5, 5, 128, 128});
+  benchmark->Unit(benchmark::kMillisecond);
+}
+
+}  // namespace
+
+
+static void BM_JPLMMemoryCodecEncode(benchmark::State& state) {
+  const auto setup = get_setup(state);
+  auto bytes = std::vector<std::byte>();
+  for (auto _ : state) {
+    bytes = JPLMMemoryCodec::encode_light_field(
+        setup.configuration, get_input(setup));
+  }
+  set_counters(state, setup, bytes.size());
+  state.counters["psnr"] = get_psnr(setup, bytes);
+}
+BENCHMARK(BM_JPLMMemoryCodecEncode)->Apply(add_light_field_sizes);
+
+
+//the rate increase (in percent) and PSNR loss (in dB) of the approximate
+//partition search are reported relative to the double precision one
+static void BM_JPLMMemoryCodecEncodeSinglePrecisionSearch(
+    benchmark::State& state) {
+  const auto setup =
+      get_setup(state, {"--single-precision-partition-search", "true"});
+  auto bytes = std::vector<std::byte>();
+  for (auto _ : state) {
+    bytes = JPLMMemoryCodec::encode_light_field(
+        setup.configuration, get_input(setup));
+  }
+  set_counters(state, setup, bytes.size());
+  const auto psnr = get_psnr(setup, bytes);
+  state.counters["psnr"] = psnr;
+
+  const auto reference_setup = get_setup(state);
+  const auto reference_bytes = JPLMMemoryCodec::encode_light_field(
+      reference_setup.configuration, get_input(reference_setup));
+  state.counters["bpp_increase_percent"] =
+      100.0 * (static_cast<double>(bytes.size()) /
+                  static_cast<double>(reference_bytes.size()) -
+                  1.0);
+  state.counters["psnr_loss"] =
+      get_psnr(reference_setup, reference_bytes) - psnr;
+}
+BENCHMARK(BM_JPLMMemoryCodecEncodeSinglePrecisionSearch)
+    ->Apply(add_light_field_sizes);
+
+
+static void BM_JPLMMemoryCodecDecode(benchmark::State& state) {
+  const auto setup = get_setup(state);
+  const auto bytes = JPLMMemoryCodec::encode_light_field(
+      setup.configuration, get_input(setup));
+  const auto configuration = BenchmarkData::get_decoder_configuration();
+  for (auto _ : state) {
+    auto decoded = JPLMMemoryCodec::decode_light_field(
+        bytes.data(), bytes.size(), configuration);
+    benchmark::DoNotOptimize(decoded.samples.data());
+  }
+  set_counters(state, setup, bytes.size());
+}
+BENCHMARK(BM_JPLMMemoryCodecDecode)->Apply(add_light_field_sizes);
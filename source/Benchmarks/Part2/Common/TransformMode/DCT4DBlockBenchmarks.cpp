@@ -0,0 +1,130 @@
+/* The copyright in this software is being made available under the BSD
+ * License, included below. This software may be subject to other third party
+ * and contributor rights, including patent rights, and no such rights are
+ * granted under this license.
+ *
+ * Copyright (c) 2010-2019, ITU/ISO/IEC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *  * Neither the name of the ITU/ISO/IEC nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** \file     DCT4DBlockBenchmarks.cpp
+ *  \brief    Benchmarks of the forward and inverse 4D DCT.
+ *  \details  The block sizes (t, s, v, u) are the ones of typical lenslet
+ *            (13x13 views) and wide baseline (5x5 views) configurations.
+ *  \date     2026-10-19
+ */
+
+#include <algorithm>
+#include <cstdlib>
+#include "Benchmarks/BenchmarkData.h"
+#include "Lib/Part2/Common/TransformMode/DCT4DBlock.h"
+#include "benchmark/benchmark.h"
+
+
+namespace {
+
+constexpr auto bits_per_sample = std::size_t(10);
+
+
+LightfieldDimension<uint32_t> get_dimension(const benchmark::State& state) {
+  return {static_cast<uint32_t>(state.range(0)),
+      static_cast<uint32_t>(state.range(1)),
+      static_cast<uint32_t>(state.range(2)),
+      static_cast<uint32_t>(state.range(3))};
+}
+
+
+void add_block_sizes(benchmark::internal::Benchmark* benchmark) {
+  benchmark->ArgNames({"t", "s", "v", "u"});
+  benchmark->Args({1, 1, 8, 8});
+  benchmark->Args({5, 5, 16, 16});
+  benchmark->Args({5, 5, 31, 31});
+  benchmark->Args({13, 13, 31, 31});
+}
+
+}  // namespace
+
+
+static void BM_DCT4DBlockForward(benchmark::State& state) {
+  const auto dimension = get_dimension(state);
+  const auto coefficients =
+      BenchmarkData::get_transform_coefficients(dimension);
+  const auto block = BenchmarkData::get_block_4d(dimension, bits_per_sample);
+  for (auto _ : state) {
+    auto transformed = DCT4DBlock(block, coefficients);
+    benchmark::DoNotOptimize(transformed.get_coefficients_mult());
+  }
+  state.SetItemsProcessed(
+      state.iterations() * block.get_number_of_elements());
+}
+BENCHMARK(BM_DCT4DBlockForward)->Apply(add_block_sizes);
+
+
+//the largest difference to the double precision coefficients is reported
+static void BM_DCT4DBlockForwardSinglePrecision(benchmark::State& state) {
+  const auto dimension = get_dimension(state);
+  const auto coefficients =
+      BenchmarkData::get_transform_coefficients(dimension);
+  const auto block = BenchmarkData::get_block_4d(dimension, bits_per_sample);
+  for (auto _ : state) {
+    auto transformed = DCT4DBlock(
+        block, coefficients, TransformPrecision::single_precision);
+    benchmark::DoNotOptimize(transformed.get_coefficients_mult());
+  }
+  state.SetItemsProcessed(
+      state.iterations() * block.get_number_of_elements());
+
+  const auto reference =
+      DCT4DBlock(block, coefficients).generate_copy_in_block();
+  const auto approximation =
+      DCT4DBlock(block, coefficients, TransformPrecision::single_precision)
+          .generate_copy_in_block();
+  auto maximal_difference = block4DElementType{0};
+  for (auto i = std::size_t{0}; i < block.get_number_of_elements(); ++i) {
+    maximal_difference = std::max(maximal_difference,
+        std::abs(reference.mPixelData[i] - approximation.mPixelData[i]));
+  }
+  state.counters["max_abs_difference"] =
+      static_cast<double>(maximal_difference);
+}
+BENCHMARK(BM_DCT4DBlockForwardSinglePrecision)->Apply(add_block_sizes);
+
+
+static void BM_DCT4DBlockInverse(benchmark::State& state) {
+  const auto dimension = get_dimension(state);
+  const auto coefficients =
+      BenchmarkData::get_transform_coefficients(dimension);
+  const auto block = BenchmarkData::get_block_4d(dimension, bits_per_sample);
+  auto transformed = DCT4DBlock(block, coefficients);
+  for (auto _ : state) {
+    auto inverse = transformed.inverse(coefficients);
+    benchmark::DoNotOptimize(inverse.mPixelData);
+  }
+  state.SetItemsProcessed(
+      state.iterations() * block.get_number_of_elements());
+}
+BENCHMARK(BM_DCT4DBlockInverse)->Apply(add_block_sizes);
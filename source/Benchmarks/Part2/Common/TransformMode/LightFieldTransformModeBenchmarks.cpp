@@ -0,0 +1,89 @@
+/* The copyright in this software is being made available under the BSD
+ * License, included below. This software may be subject to other third party
+ * and contributor rights, including patent rights, and no such rights are
+ * granted under this license.
+ *
+ * Copyright (c) 2010-2019, ITU/ISO/IEC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *  * Neither the name of the ITU/ISO/IEC nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** \file     LightFieldTransformModeBenchmarks.cpp
+ *  \brief    Benchmark of the gathering of 4D blocks from a light field.
+ *  \details  All 4D blocks of a light field held in memory are gathered, so
+ *            that both inner and border blocks (which are padded) are
+ *            measured. The views are loaded before the timed loop.
+ *  \date     2026-10-19
+ */
+
+#include "Benchmarks/BenchmarkData.h"
+#include "Lib/Part2/Common/LightfieldMemoryIO.h"
+#include "Lib/Part2/Common/TransformMode/LightFieldTransformMode.h"
+#include "benchmark/benchmark.h"
+
+
+namespace {
+
+constexpr auto bits_per_sample = std::size_t(10);
+constexpr auto number_of_channels = std::size_t(3);
+
+}  // namespace
+
+
+static void BM_LightFieldTransformModeGetBlock4DFrom(benchmark::State& state) {
+  const auto dimension = LightfieldDimension<std::size_t>(5, 5,
+      static_cast<std::size_t>(state.range(0)),
+      static_cast<std::size_t>(state.range(1)));
+  const auto block_size = LightfieldDimension<uint32_t>(
+      5, 5, static_cast<uint32_t>(state.range(2)),
+      static_cast<uint32_t>(state.range(2)));
+  const auto samples = BenchmarkData::get_light_field_samples(
+      dimension, number_of_channels, bits_per_sample);
+  auto light_field = LightFieldTransformMode<uint16_t>(
+      LightfieldMemoryIO<uint16_t>::from_planar_buffer(
+          samples.data(), dimension, number_of_channels, bits_per_sample));
+  const auto level_shift = -(1 << (bits_per_sample - 1));
+  light_field.get_block_4D_from(0, {0, 0, 0, 0}, block_size, level_shift);
+
+  for (auto _ : state) {
+    for (auto v = uint32_t(0); v < dimension.get_v();
+         v += block_size.get_v()) {
+      for (auto u = uint32_t(0); u < dimension.get_u();
+           u += block_size.get_u()) {
+        auto block = light_field.get_block_4D_from(
+            0, {0, 0, v, u}, block_size, level_shift);
+        benchmark::DoNotOptimize(block.mPixelData);
+      }
+    }
+  }
+  state.SetItemsProcessed(state.iterations() *
+                          dimension.get_number_of_pixels_per_lightfield());
+}
+BENCHMARK(BM_LightFieldTransformModeGetBlock4DFrom)
+    ->ArgNames({"v", "u", "block"})
+    ->Args({128, 128, 16})
+    ->Args({128, 128, 31})
+    ->Args({434, 625, 31});
@@ -0,0 +1,109 @@
+/* The copyright in this software is being made available under the BSD
+ * License, included below. This software may be subject to other third party
+ * and contributor rights, including patent rights, and no such rights are
+ * granted under this license.
+ *
+ * Copyright (c) 2010-2019, ITU/ISO/IEC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *  * Neither the name of the ITU/ISO/IEC nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** \file     ABACBenchmarks.cpp
+ *  \brief    Benchmarks of the adaptive binary arithmetic encoder and decoder.
+ *  \details  The symbols are pseudo-random bits whose probability of being
+ *            zero is given (in percent) as the benchmark argument. A single
+ *            adaptive model is used, being updated after each bit as done by
+ *            the hierarchical 4D codec.
+ *  \date     2026-10-19
+ */
+
+#include "Benchmarks/BenchmarkData.h"
+#include "Lib/Part2/Decoder/TransformMode/ABACDecoder.h"
+#include "Lib/Part2/Encoder/TransformMode/ABACEncoder.h"
+#include "benchmark/benchmark.h"
+
+
+namespace {
+
+constexpr auto number_of_bits = std::size_t(1) << 20;
+
+
+void encode(ABACEncoder& encoder, const std::vector<bool>& bits) {
+  auto model = ProbabilityModel();
+  for (const auto bit : bits) {
+    encoder.encode_bit(bit, model);
+    model.update(bit);
+  }
+  encoder.flush_byte();
+}
+
+
+void add_probabilities_of_zero(benchmark::internal::Benchmark* benchmark) {
+  benchmark->ArgName("p0_percent");
+  benchmark->Arg(50);
+  benchmark->Arg(90);
+  benchmark->Arg(99);
+}
+
+}  // namespace
+
+
+static void BM_ABACEncoder(benchmark::State& state) {
+  const auto bits =
+      BenchmarkData::get_bits(number_of_bits, state.range(0) / 100.0);
+  for (auto _ : state) {
+    auto encoder = ABACEncoder();
+    encode(encoder, bits);
+    benchmark::DoNotOptimize(encoder.get_ref_to_codestream_code().size());
+  }
+  state.SetItemsProcessed(state.iterations() * number_of_bits);
+}
+BENCHMARK(BM_ABACEncoder)->Apply(add_probabilities_of_zero);
+
+
+static void BM_ABACDecoder(benchmark::State& state) {
+  const auto bits =
+      BenchmarkData::get_bits(number_of_bits, state.range(0) / 100.0);
+  auto encoder = ABACEncoder();
+  encode(encoder, bits);
+  const auto& codestream_code = encoder.get_ref_to_codestream_code();
+
+  for (auto _ : state) {
+    codestream_code.rewind(codestream_code.get_current_position());
+    auto decoder = ABACDecoder(codestream_code);
+    decoder.start();
+    auto model = ProbabilityModel();
+    auto number_of_ones = std::size_t(0);
+    for (auto i = std::size_t(0); i < number_of_bits; ++i) {
+      const auto bit = decoder.decode_bit(model);
+      model.update(bit);
+      number_of_ones += bit;
+    }
+    benchmark::DoNotOptimize(number_of_ones);
+  }
+  state.SetItemsProcessed(state.iterations() * number_of_bits);
+}
+BENCHMARK(BM_ABACDecoder)->Apply(add_probabilities_of_zero);
@@ -0,0 +1,102 @@
+/* The copyright in this software is being made available under the BSD
+ * License, included below. This software may be subject to other third party
+ * and contributor rights, including patent rights, and no such rights are
+ * granted under this license.
+ *
+ * Copyright (c) 2010-2019, ITU/ISO/IEC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *  * Neither the name of the ITU/ISO/IEC nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** \file     Hierarchical4DEncoderBenchmarks.cpp
+ *  \brief    Benchmark of the rate-distortion optimization of the
+ *            hexadeca-tree.
+ *  \details  The hexadeca-tree of the DCT of a single (whole) 4D block is
+ *            optimized, as done for each node of the transform partition.
+ *  \date     2026-10-19
+ */
+
+#include "Benchmarks/BenchmarkData.h"
+#include "Lib/Part2/Common/TransformMode/DCT4DBlock.h"
+#include "Lib/Part2/Encoder/TransformMode/Hierarchical4DEncoder.h"
+#include "benchmark/benchmark.h"
+
+
+namespace {
+
+constexpr auto bits_per_sample = std::size_t(10);
+
+}  // namespace
+
+
+static void BM_Hierarchical4DEncoderRDOptimizeHexadecatree(
+    benchmark::State& state) {
+  const auto dimension = LightfieldDimension<uint32_t>(
+      static_cast<uint32_t>(state.range(0)),
+      static_cast<uint32_t>(state.range(1)),
+      static_cast<uint32_t>(state.range(2)),
+      static_cast<uint32_t>(state.range(3)));
+  const auto lambda = static_cast<double>(state.range(4));
+  const auto coefficients =
+      BenchmarkData::get_transform_coefficients(dimension);
+
+  auto encoder = Hierarchical4DEncoder();
+  BenchmarkData::setup_hierarchical_4d_encoder(
+      encoder, dimension, bits_per_sample);
+
+  auto block = BenchmarkData::get_block_4d(dimension, bits_per_sample);
+  auto transformed = DCT4DBlock(block, coefficients);
+  transformed.swap_data_with_block(block);
+  encoder.mSubbandLF = block;
+
+  const auto scaled_lambda =
+      lambda * encoder.get_number_of_elements_in_transform();
+  encoder.load_optimizer_state();
+  encoder.set_inferior_bit_plane(encoder.get_optimum_bit_plane(scaled_lambda));
+  encoder.load_optimizer_state();
+  const auto initial_model = encoder.optimization_probability_models;
+  const auto lengths = std::make_tuple(static_cast<int>(block.mlength_t),
+      static_cast<int>(block.mlength_s), static_cast<int>(block.mlength_v),
+      static_cast<int>(block.mlength_u));
+
+  for (auto _ : state) {
+    encoder.hexadecatree_flags.clear();
+    encoder.set_optimization_model(initial_model);
+    auto rd_cost = encoder.rd_optimize_hexadecatree({0, 0, 0, 0}, lengths,
+        scaled_lambda, encoder.get_superior_bit_plane(),
+        encoder.hexadecatree_flags);
+    benchmark::DoNotOptimize(rd_cost);
+  }
+  state.SetItemsProcessed(
+      state.iterations() * block.get_number_of_elements());
+}
+BENCHMARK(BM_Hierarchical4DEncoderRDOptimizeHexadecatree)
+    ->ArgNames({"t", "s", "v", "u", "lambda"})
+    ->Args({1, 1, 16, 16, 1000})
+    ->Args({5, 5, 16, 16, 1000})
+    ->Args({5, 5, 31, 31, 1000})
+    ->Args({5, 5, 31, 31, 100000})
+    ->Args({13, 13, 31, 31, 1000});
@@ -0,0 +1,106 @@
+/* The copyright in this software is being made available under the BSD
+ * License, included below. This software may be subject to other third party
+ * and contributor rights, including patent rights, and no such rights are
+ * granted under this license.
+ *
+ * Copyright (c) 2010-2019, ITU/ISO/IEC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *  * Neither the name of the ITU/ISO/IEC nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** \file     TransformPartitionBenchmarks.cpp
+ *  \brief    Benchmark of the rate-distortion optimization of the transform
+ *            partition of a 4D block.
+ *  \details  This is the search done by the encoder for each 4D block (of a
+ *            single channel), including the DCTs of all evaluated partitions.
+ *            The cost of the chosen partition is reported as a counter, and
+ *            the searches with single precision candidate transforms report
+ *            whether they chose the same partition of the double precision
+ *            search.
+ *  \date     2026-10-19
+ */
+
+#include "Benchmarks/BenchmarkData.h"
+#include "Lib/Part2/Encoder/TransformMode/TransformPartition.h"
+#include "benchmark/benchmark.h"
+
+
+namespace {
+
+constexpr auto bits_per_sample = std::size_t(10);
+
+}  // namespace
+
+
+static void BM_TransformPartitionRDOptimizeTransform(benchmark::State& state) {
+  const auto dimension = LightfieldDimension<uint32_t>(
+      static_cast<uint32_t>(state.range(0)),
+      static_cast<uint32_t>(state.range(1)),
+      static_cast<uint32_t>(state.range(2)),
+      static_cast<uint32_t>(state.range(3)));
+  const auto lambda = static_cast<double>(state.range(4));
+  const auto precision = state.range(5) ? TransformPrecision::single_precision
+                                        : TransformPrecision::double_precision;
+  const auto coefficients =
+      BenchmarkData::get_transform_coefficients(dimension);
+
+  auto encoder = Hierarchical4DEncoder();
+  BenchmarkData::setup_hierarchical_4d_encoder(
+      encoder, dimension, bits_per_sample);
+  auto transform_partition = TransformPartition(1, 1, 4, 4);
+  transform_partition.set_dct_coefficients(&coefficients);
+  transform_partition.mPartitionData.set_dimension(dimension);
+
+  auto block = BenchmarkData::get_block_4d(dimension, bits_per_sample);
+  auto rd_cost = RDCostResult(0.0, 0.0, 0.0, 0.0);
+  transform_partition.set_search_precision(precision);
+  for (auto _ : state) {
+    rd_cost =
+        transform_partition.rd_optimize_transform(block, encoder, lambda);
+    benchmark::DoNotOptimize(rd_cost);
+  }
+  state.SetItemsProcessed(
+      state.iterations() * block.get_number_of_elements());
+  state.counters["j_cost"] = rd_cost.get_j_cost();
+
+  if (precision != TransformPrecision::double_precision) {
+    const auto partition_code = transform_partition.get_partition_code();
+    transform_partition.set_search_precision(
+        TransformPrecision::double_precision);
+    transform_partition.rd_optimize_transform(block, encoder, lambda);
+    state.counters["same_partition"] =
+        partition_code == transform_partition.get_partition_code() ? 1 : 0;
+  }
+}
+BENCHMARK(BM_TransformPartitionRDOptimizeTransform)
+    ->ArgNames({"t", "s", "v", "u", "lambda", "single"})
+    ->Args({1, 1, 16, 16, 1000, 0})
+    ->Args({5, 5, 16, 16, 1000, 0})
+    ->Args({5, 5, 31, 31, 1000, 0})
+    ->Args({5, 5, 31, 31, 1000, 1})
+    ->Args({5, 5, 31, 31, 100000, 0})
+    ->Args({5, 5, 31, 31, 100000, 1})
+    ->Unit(benchmark::kMillisecond);
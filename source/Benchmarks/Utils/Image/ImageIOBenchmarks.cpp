@@ -0,0 +1,132 @@
+/* The copyright in this software is being made available under the BSD
+ * License, included below. This software may be subject to other third party
+ * and contributor rights, including patent rights, and no such rights are
+ * granted under this license.
+ *
+ * Copyright (c) 2010-2019, ITU/ISO/IEC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *  * Neither the name of the ITU/ISO/IEC nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** \file     ImageIOBenchmarks.cpp
+ *  \brief    Benchmarks of reading and writing PPM and PGX image files.
+ *  \details  The files are written to (and read from) the temporary
+ *            directory. The argument is the image size (width and height).
+ *  \date     2026-10-19
+ */
+
+#include <filesystem>
+#include "Benchmarks/BenchmarkData.h"
+#include "Lib/Utils/Image/ImageIO.h"
+#include "Lib/Utils/Image/RGBImage.h"
+#include "Lib/Utils/Image/UndefinedImage.h"
+#include "benchmark/benchmark.h"
+
+
+namespace {
+
+constexpr auto bits_per_sample = std::size_t(10);
+
+
+void add_image_sizes(benchmark::internal::Benchmark* benchmark) {
+  benchmark->ArgNames({"width", "height"});
+  benchmark->Args({128, 128});
+  benchmark->Args({625, 434});
+  benchmark->Args({1920, 1080});
+}
+
+
+RGBImage<uint16_t> get_rgb_image(const benchmark::State& state) {
+  auto image = RGBImage<uint16_t>(state.range(0), state.range(1),
+      bits_per_sample);
+  BenchmarkData::fill_image(image);
+  return image;
+}
+
+
+UndefinedImage<uint16_t> get_undefined_image(const benchmark::State& state) {
+  auto image = UndefinedImage<uint16_t>(state.range(0), state.range(1),
+      bits_per_sample, 1);
+  BenchmarkData::fill_image(image);
+  return image;
+}
+
+
+void set_bytes_processed(benchmark::State& state, const std::string& filename) {
+  state.SetBytesProcessed(
+      state.iterations() * std::filesystem::file_size(filename));
+  std::filesystem::remove(filename);
+}
+
+}  // namespace
+
+
+static void BM_ImageIOWritePPM(benchmark::State& state) {
+  const auto image = get_rgb_image(state);
+  const auto filename = BenchmarkData::get_temporary_filename("write.ppm");
+  for (auto _ : state) {
+    ImageIO::imwrite(image, filename, true);
+  }
+  set_bytes_processed(state, filename);
+}
+BENCHMARK(BM_ImageIOWritePPM)->Apply(add_image_sizes);
+
+
+static void BM_ImageIOReadPPM(benchmark::State& state) {
+  const auto filename = BenchmarkData::get_temporary_filename("read.ppm");
+  ImageIO::imwrite(get_rgb_image(state), filename, true);
+  for (auto _ : state) {
+    auto image_file = ImageIO::open(filename);
+    auto image = ImageIO::read<RGBImage, uint16_t>(*image_file);
+    benchmark::DoNotOptimize(image->get_width());
+  }
+  set_bytes_processed(state, filename);
+}
+BENCHMARK(BM_ImageIOReadPPM)->Apply(add_image_sizes);
+
+
+static void BM_ImageIOWritePGX(benchmark::State& state) {
+  const auto image = get_undefined_image(state);
+  const auto filename = BenchmarkData::get_temporary_filename("write.pgx");
+  for (auto _ : state) {
+    ImageIO::imwrite(image, filename, true);
+  }
+  set_bytes_processed(state, filename);
+}
+BENCHMARK(BM_ImageIOWritePGX)->Apply(add_image_sizes);
+
+
+static void BM_ImageIOReadPGX(benchmark::State& state) {
+  const auto filename = BenchmarkData::get_temporary_filename("read.pgx");
+  ImageIO::imwrite(get_undefined_image(state), filename, true);
+  for (auto _ : state) {
+    auto image_file = ImageIO::open(filename);
+    auto image = ImageIO::read<UndefinedImage, uint16_t>(*image_file);
+    benchmark::DoNotOptimize(image->get_width());
+  }
+  set_bytes_processed(state, filename);
+}
+BENCHMARK(BM_ImageIOReadPGX)->Apply(add_image_sizes);
@@ -0,0 +1,145 @@
+/* The copyright in this software is being made available under the BSD
+ * License, included below. This software may be subject to other third party
+ * and contributor rights, including patent rights, and no such rights are
+ * granted under this license.
+ *
+ * Copyright (c) 2010-2019, ITU/ISO/IEC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *  * Neither the name of the ITU/ISO/IEC nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** \file     ImageMetricsBenchmarks.cpp
+ *  \brief    Benchmarks of the image quality metrics.
+ *  \details  The metrics are computed between a synthetic RGB image and a
+ *            distorted copy of it. The argument is the image size.
+ *  \date     2026-10-19
+ */
+
+#include "Benchmarks/BenchmarkData.h"
+#include "Lib/Utils/Image/ImageMetrics.h"
+#include "Lib/Utils/Image/RGBImage.h"
+#include "benchmark/benchmark.h"
+
+
+namespace {
+
+constexpr auto bits_per_sample = std::size_t(10);
+
+
+std::pair<RGBImage<uint16_t>, RGBImage<uint16_t>> get_images(
+    const benchmark::State& state) {
+  auto original = RGBImage<uint16_t>(state.range(0), state.range(1),
+      bits_per_sample);
+  BenchmarkData::fill_image(original);
+  auto distorted = original;
+  //the distortion is the synthetic content of another view
+  BenchmarkData::fill_image(distorted, 1, 1);
+  return {std::move(original), std::move(distorted)};
+}
+
+
+void add_image_sizes(benchmark::internal::Benchmark* benchmark) {
+  benchmark->ArgNames({"width", "height"});
+  benchmark->Args({625, 434});
+  benchmark->Args({1920, 1080});
+}
+
+}  // namespace
+
+
+static void BM_ImageMetricsPSNR(benchmark::State& state) {
+  const auto [original, distorted] = get_images(state);
+  for (auto _ : state) {
+    auto psnr =
+        ImageMetrics::get_peak_signal_to_noise_ratio(original, distorted);
+    benchmark::DoNotOptimize(psnr.data());
+  }
+  state.SetItemsProcessed(state.iterations() * 3 * state.range(0) *
+                          state.range(1));
+}
+BENCHMARK(BM_ImageMetricsPSNR)->Apply(add_image_sizes);
+
+
+static void BM_ImageMetricsMSE(benchmark::State& state) {
+  const auto [original, distorted] = get_images(state);
+  for (auto _ : state) {
+    auto mse = ImageMetrics::get_mse(original, distorted);
+    benchmark::DoNotOptimize(mse.data());
+  }
+  state.SetItemsProcessed(state.iterations() * 3 * state.range(0) *
+                          state.range(1));
+}
+BENCHMARK(BM_ImageMetricsMSE)->Apply(add_image_sizes);
+
+
+static void BM_ImageMetricsMaximumAbsoluteError(benchmark::State& state) {
+  const auto [original, distorted] = get_images(state);
+  for (auto _ : state) {
+    auto error =
+        ImageMetrics::get_maximum_absolute_error(original, distorted);
+    benchmark::DoNotOptimize(error.data());
+  }
+  state.SetItemsProcessed(state.iterations() * 3 * state.range(0) *
+                          state.range(1));
+}
+BENCHMARK(BM_ImageMetricsMaximumAbsoluteError)->Apply(add_image_sizes);
+
+
+static void BM_ImageMetricsErrorStatistics(benchmark::State& state) {
+  const auto [original, distorted] = get_images(state);
+  for (auto _ : state) {
+    auto statistics = ImageMetrics::get_error_statistics(original, distorted);
+    benchmark::DoNotOptimize(statistics.data());
+  }
+  state.SetItemsProcessed(state.iterations() * 3 * state.range(0) *
+                          state.range(1));
+}
+BENCHMARK(BM_ImageMetricsErrorStatistics)->Apply(add_image_sizes);
+
+
+static void BM_ImageMetricsSSIM(benchmark::State& state) {
+  const auto [original, distorted] = get_images(state);
+  for (auto _ : state) {
+    auto ssim = ImageMetrics::get_structural_similarity(original, distorted);
+    benchmark::DoNotOptimize(ssim.data());
+  }
+  state.SetItemsProcessed(state.iterations() * 3 * state.range(0) *
+                          state.range(1));
+}
+BENCHMARK(BM_ImageMetricsSSIM)->Apply(add_image_sizes);
+
+
+static void BM_ImageMetricsMSSSIM(benchmark::State& state) {
+  const auto [original, distorted] = get_images(state);
+  for (auto _ : state) {
+    auto ms_ssim =
+        ImageMetrics::get_multiscale_structural_similarity(original, distorted);
+    benchmark::DoNotOptimize(ms_ssim.data());
+  }
+  state.SetItemsProcessed(state.iterations() * 3 * state.range(0) *
+                          state.range(1));
+}
+BENCHMARK(BM_ImageMetricsMSSSIM)->Apply(add_image_sizes);
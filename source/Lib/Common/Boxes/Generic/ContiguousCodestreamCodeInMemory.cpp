@@ -46,20 +46,25 @@ uint64_t ContiguousCodestreamCodeInMemory::size() const noexcept {
 }
 
 
-ContiguousCodestreamCodeInMemory::ContiguousCodestreamCodeInMemory() {
+ContiguousCodestreamCodeInMemory::ContiguousCodestreamCodeInMemory()
+    : tracked_bytes(MemoryAccounting::Category::codestream) {
   bytes.reserve(100000);
+  update_tracked_bytes();
 }
 
 
 ContiguousCodestreamCodeInMemory::ContiguousCodestreamCodeInMemory(
-    uint64_t size) {
+    uint64_t size)
+    : tracked_bytes(MemoryAccounting::Category::codestream) {
   bytes.reserve(size);
+  update_tracked_bytes();
 }
 
 
 void ContiguousCodestreamCodeInMemory::push_byte(const std::byte byte) {
   bytes.emplace_back(byte);
   ++current_pos;
+  update_tracked_bytes();
 }
 
 
@@ -114,12 +119,12 @@ void ContiguousCodestreamCodeInMemory::insert_bytes(
     const std::vector<std::byte> &bytes_to_insert) {
   bytes.insert(bytes.begin() + initial_position, bytes_to_insert.begin(),
       bytes_to_insert.end());
+  update_tracked_bytes();
 }
 
 
 ContiguousCodestreamCodeInMemory *ContiguousCodestreamCodeInMemory::clone()
     const {
-  std::cout << "ContiguousCodestreamCodeInMemory::clone" << std::endl;
   return new ContiguousCodestreamCodeInMemory(*this);
 }
 
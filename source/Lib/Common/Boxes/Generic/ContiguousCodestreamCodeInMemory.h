@@ -44,12 +44,22 @@
 #include <iostream>
 #include <vector>
 #include "ContiguousCodestreamCode.h"
+#include "Lib/Utils/Stats/MemoryAccounting.h"
 
 
 class ContiguousCodestreamCodeInMemory : public ContiguousCodestreamCode {
  protected:
   std::vector<std::byte> bytes;
   mutable std::size_t current_pos = 0;
+  //! Accounts the capacity of bytes (as codestream or parsed_boxes)
+  MemoryAccounting::TrackedBytes tracked_bytes;
+
+
+  void update_tracked_bytes() {
+    if (tracked_bytes.get() != bytes.capacity()) {
+      tracked_bytes.set(bytes.capacity());
+    }
+  }
 
  public:
   uint64_t size() const noexcept override;
@@ -61,25 +71,33 @@ class ContiguousCodestreamCodeInMemory : public ContiguousCodestreamCode {
   explicit ContiguousCodestreamCodeInMemory(uint64_t size);
 
 
-  explicit ContiguousCodestreamCodeInMemory(const std::vector<std::byte>& bytes)
-      : bytes(bytes) {
+  explicit ContiguousCodestreamCodeInMemory(const std::vector<std::byte>& bytes,
+      MemoryAccounting::Category memory_category =
+          MemoryAccounting::Category::codestream)
+      : bytes(bytes), tracked_bytes(memory_category, this->bytes.capacity()) {
   }
 
 
-  explicit ContiguousCodestreamCodeInMemory(std::vector<std::byte>&& bytes)
-      : bytes(std::move(bytes)) {
+  explicit ContiguousCodestreamCodeInMemory(std::vector<std::byte>&& bytes,
+      MemoryAccounting::Category memory_category =
+          MemoryAccounting::Category::codestream)
+      : bytes(std::move(bytes)),
+        tracked_bytes(memory_category, this->bytes.capacity()) {
   }
 
 
   ContiguousCodestreamCodeInMemory(
       const ContiguousCodestreamCodeInMemory& other)
-      : bytes(other.bytes), current_pos(other.current_pos) {
+      : bytes(other.bytes), current_pos(other.current_pos),
+        tracked_bytes(other.tracked_bytes) {
     // std::cout << "copy of ContiguousCodestreamCodeInMemory " << std::endl;
+    update_tracked_bytes();
   }
 
 
   ContiguousCodestreamCodeInMemory(ContiguousCodestreamCodeInMemory&& other)
-      : bytes(std::move(other.bytes)), current_pos(other.current_pos) {
+      : bytes(std::move(other.bytes)), current_pos(other.current_pos),
+        tracked_bytes(std::move(other.tracked_bytes)) {
   }
 
 
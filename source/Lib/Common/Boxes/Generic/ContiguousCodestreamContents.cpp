@@ -59,7 +59,6 @@ uint64_t ContiguousCodestreamContents::size() const noexcept {
 
 
 ContiguousCodestreamContents *ContiguousCodestreamContents::clone() const {
-  std::cout << "ContiguousCodestreamContents clone" << std::endl;
   return new ContiguousCodestreamContents(*this);
 }
 
@@ -144,3 +144,18 @@ bool ImageHeaderContents::is_equal(const DBox &other) const {
   bool ImageHeaderContents::operator!=(const ImageHeaderContents &other) const {
     return !this->operator==(other);
   }
+
+
+std::vector<std::byte> ImageHeaderContents::get_bytes() const {
+  auto bytes = std::vector<std::byte>();
+  bytes.reserve(this->size());
+  BinaryTools::append_big_endian_bytes(bytes, height);
+  BinaryTools::append_big_endian_bytes(bytes, width);
+  BinaryTools::append_big_endian_bytes(bytes, nc);
+  BinaryTools::append_big_endian_bytes(bytes, bpc);
+  BinaryTools::append_big_endian_bytes(
+      bytes, static_cast<compression_type_data>(c));
+  BinaryTools::append_big_endian_bytes(bytes, UnkC);
+  BinaryTools::append_big_endian_bytes(bytes, IPR);
+  return bytes;
+}
@@ -45,6 +45,7 @@
 #include "CompressionTypeImage.h"
 #include "Lib/Common/Boxes/InMemoryDBox.h"
 #include "Lib/Part1/Common/CommonExceptions.h"
+#include "Lib/Utils/Stream/BinaryTools.h"
 
 
 class ImageHeaderContents : public InMemoryDBox {
@@ -109,6 +110,9 @@ class ImageHeaderContents : public InMemoryDBox {
 
 
   bool operator!=(const ImageHeaderContents& other) const;
+
+
+  std::vector<std::byte> get_bytes() const override;
 };
 
 
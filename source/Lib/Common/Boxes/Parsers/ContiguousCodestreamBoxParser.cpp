@@ -55,7 +55,8 @@ std::unique_ptr<Box> JPLMBoxParser::ContiguousCodestreamBoxParser::parse(
     assert(remaining_stream.get_length() == data_length);
     auto contiguous_codestream_code =
         std::make_unique<ContiguousCodestreamCodeInMemory>(
-            remaining_stream.get_n_bytes(data_length));
+            remaining_stream.get_n_bytes(data_length),
+            MemoryAccounting::Category::parsed_boxes);
     auto contiguous_codestream_contents =
         std::make_unique<ContiguousCodestreamContents>(
             std::move(contiguous_codestream_code));
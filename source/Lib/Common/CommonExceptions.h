@@ -42,6 +42,7 @@
 #ifndef JPLM_LIB_COMMON_COMMON_EXCEPTIONS_H
 #define JPLM_LIB_COMMON_COMMON_EXCEPTIONS_H
 
+#include <cstdint>
 #include <exception>
 #include <stdexcept>
 #include <string>
@@ -151,6 +152,75 @@ class UnknownCLIParameterException : public std::exception {
   }
 };
 
+
+
+class InvalidDownscaleFactorException : public std::exception {
+ private:
+  std::string msg;
+
+ public:
+  InvalidDownscaleFactorException(uint32_t factor)
+      : msg("Invalid downscale factor " + std::to_string(factor) +
+            ". The allowed factors are 1, 2, 4 and 8.") {
+  }
+
+  const char* what() const throw() {
+    return msg.c_str();
+  }
+};
+
+
+class InvalidLambdasException : public std::exception {
+ private:
+  std::string msg;
+
+ public:
+  InvalidLambdasException(const std::string& list)
+      : msg("Invalid list of lambdas \"" + list +
+            "\". Expected comma separated positive numbers.") {
+  }
+
+  const char* what() const throw() {
+    return msg.c_str();
+  }
+};
+
 }  // namespace JPLMConfigurationExceptions
 
+
+namespace JPLMMemoryCodecExceptions {
+
+
+class InconsistentNumberOfChannelsException : public std::exception {
+ private:
+  std::string msg;
+
+ public:
+  InconsistentNumberOfChannelsException(
+      std::size_t configured, std::size_t provided)
+      : msg("The configuration expects " + std::to_string(configured) +
+            " colour channels, but the light field in memory has " +
+            std::to_string(provided) + ".") {
+  }
+
+  const char* what() const throw() {
+    return msg.c_str();
+  }
+};
+
+
+class NoLightFieldCodestreamException : public std::exception {
+ private:
+  std::string msg = "The JPL file has no light field codestream.";
+
+ public:
+  NoLightFieldCodestreamException() = default;
+
+  const char* what() const throw() {
+    return msg.c_str();
+  }
+};
+
+}  // namespace JPLMMemoryCodecExceptions
+
 #endif  // JPLM_LIB_COMMON_COMMON_EXCEPTIONS_H
\ No newline at end of file
@@ -72,6 +72,56 @@ void JPLMConfiguration::add_options() {
       this->current_hierarchy_level,
       {[this]() -> std::string { return "false"; }}});
 
+  this->add_cli_json_option({"--runtime-statistics-file", "-timef",
+      "Writes the runtime statistics as JSON to the given file. When the "
+      "codec is built with -DJPLM_INSTRUMENTATION=ON, the statistics "
+      "include the time, calls and processed items of each stage, in total "
+      "and per thread (these are also shown by --show-runtime-statistics).",
+      [this](const nlohmann::json &conf) -> std::optional<std::string> {
+        if (conf.contains("runtime-statistics-file")) {
+          return conf["runtime-statistics-file"].get<std::string>();
+        }
+        return std::nullopt;
+      },
+      [this](std::string arg) { this->runtime_statistics_filename = arg; },
+      this->current_hierarchy_level,
+      {[this]() -> std::string { return ""; }}});
+
+  this->add_cli_json_option({"--trace-file", "-trace",
+      "Writes a timeline of the run (4D blocks, partition search nodes, view "
+      "loads/releases and codestream flushes, per thread) to the given file "
+      "in the Chrome trace-event format. It can be opened in "
+      "chrome://tracing or in https://ui.perfetto.dev.",
+      [this](const nlohmann::json &conf) -> std::optional<std::string> {
+        if (conf.contains("trace-file")) {
+          return conf["trace-file"].get<std::string>();
+        }
+        return std::nullopt;
+      },
+      [this](std::string arg) { this->trace_filename = arg; },
+      this->current_hierarchy_level,
+      {[this]() -> std::string { return ""; }}});
+
+  this->add_cli_json_option({"--memory-budget", "-mbudget",
+      "Sets a budget (in MiB) for the memory tracked in images, 4D blocks, "
+      "codestreams and parsed boxes. When it is exceeded, the view IO "
+      "policies release (and save, when decoding) the least recently loaded "
+      "views instead of keeping all of them in memory, at the cost of "
+      "loading them again when accessed. The current and peak values of the "
+      "tracked memory are reported with the runtime statistics. "
+      "0 (the default) means no budget.",
+      [this](const nlohmann::json &conf) -> std::optional<std::string> {
+        if (conf.contains("memory-budget")) {
+          return std::to_string(conf["memory-budget"].get<std::size_t>());
+        }
+        return std::nullopt;
+      },
+      [this](std::string arg) {
+        this->memory_budget_in_mebibytes = std::stoul(arg);
+      },
+      this->current_hierarchy_level,
+      {[this]() -> std::string { return "0"; }}});
+
   this->add_cli_json_option({"--show-progress-bar", "-progress",
       "Enables the display of a progress bar showing the percentage of "
       "completion, run time and expected finishing time.",
@@ -73,6 +73,9 @@ class JPLMConfiguration : public BasicConfiguration {
   std::string output = "";
   bool show_runtime_statistics_flag = false;
   bool show_progress_bar_flag = false;
+  std::string runtime_statistics_filename = "";
+  std::string trace_filename = "";
+  std::size_t memory_budget_in_mebibytes = 0;
 
   JPLMConfiguration(int argc, char **argv, std::size_t level);
   virtual void add_options() override;
@@ -90,6 +93,20 @@ class JPLMConfiguration : public BasicConfiguration {
   bool show_progress_bar() const {
     return show_progress_bar_flag;
   }
+  const std::string &get_runtime_statistics_filename() const {
+    return runtime_statistics_filename;
+  }
+  const std::string &get_trace_filename() const {
+    return trace_filename;
+  }
+  /**
+   * \brief      Gets the global memory budget (see MemoryAccounting)
+   *
+   * \return     The budget in bytes (0 if no budget was set).
+   */
+  std::size_t get_memory_budget() const {
+    return memory_budget_in_mebibytes * 1024 * 1024;
+  }
 };
 
 
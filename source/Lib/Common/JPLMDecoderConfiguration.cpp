@@ -97,7 +97,8 @@ void JPLMDecoderConfiguration::add_options() {
       },
       this->current_hierarchy_level});
   cli_options.push_back({"--output", "-o",
-      "Output directory containing the decoded plenoptic data",
+      "Output directory containing the decoded plenoptic data. For Part 2, "
+      "light field, the output may also be a planar light-field file (.plf).",
       [this]([[maybe_unused]] std::any v) {
         this->output = std::any_cast<std::string>(v);
       },
@@ -117,8 +118,110 @@ void JPLMDecoderConfiguration::add_options() {
       },
       this->current_hierarchy_level,
       {[this]() -> std::string { return "false"; }}});
+
+  this->add_cli_json_option({"--downscale", "-ds",
+      "Decodes a preview downscaled by the given factor (1, 2, 4 or 8) in "
+      "the intra-view dimensions. For the 4D transform mode, only the low "
+      "frequency coefficients of each transform block are inverse "
+      "transformed.",
+      [this](const nlohmann::json &conf) -> std::optional<std::string> {
+        if (conf.contains("downscale")) {
+          return std::to_string(conf["downscale"].get<uint32_t>());
+        }
+        return std::nullopt;
+      },
+      [this](std::string arg) {
+        this->downscale_factor = parse_downscale_factor(arg);
+      },
+      this->current_hierarchy_level,
+      {[this]() -> std::string { return "1"; }}});
+
+  this->add_cli_json_option({"--downscale-views", "-dsv",
+      "Downscale factor (1, 2, 4 or 8) in the view dimensions, used "
+      "together with --downscale.",
+      [this](const nlohmann::json &conf) -> std::optional<std::string> {
+        if (conf.contains("downscale-views")) {
+          return std::to_string(conf["downscale-views"].get<uint32_t>());
+        }
+        return std::nullopt;
+      },
+      [this](std::string arg) {
+        this->views_downscale_factor = parse_downscale_factor(arg);
+      },
+      this->current_hierarchy_level,
+      {[this]() -> std::string { return "1"; }}});
+
+  this->add_cli_json_option({"--truncate-bit-plane", "-tbp",
+      "Quick, lower quality decoding: lowest bit plane used to reconstruct "
+      "the coefficients of the 4D transform mode. The bit planes below it "
+      "are parsed, but discarded. 0 uses all encoded bit planes.",
+      [this](const nlohmann::json &conf) -> std::optional<std::string> {
+        if (conf.contains("truncate-bit-plane")) {
+          return std::to_string(conf["truncate-bit-plane"].get<uint32_t>());
+        }
+        return std::nullopt;
+      },
+      [this](std::string arg) {
+        this->minimum_reconstruction_bit_plane =
+            static_cast<uint8_t>(std::min<unsigned long>(
+                std::stoul(arg), std::numeric_limits<uint8_t>::max()));
+      },
+      this->current_hierarchy_level,
+      {[this]() -> std::string { return "0"; }}});
+
+  this->add_cli_json_option({"--thumbnail-only", "-tonly",
+      "Only extracts the thumbnail of the input JPL file, without parsing "
+      "its plenoptic codestreams. The output is a PPM file (or PGX, if the "
+      "thumbnail does not have three channels); if the output path is a "
+      "directory, the thumbnail is written into it.",
+      [this](const nlohmann::json &conf) -> std::optional<std::string> {
+        if (conf.contains("thumbnail-only")) {
+          return conf["thumbnail-only"].get<std::string>();
+        }
+        return std::nullopt;
+      },
+      [this](std::string arg) {
+        if (arg == "false") {
+          this->thumbnail_only = false;
+        } else {
+          this->thumbnail_only = true;
+        }
+      },
+      this->current_hierarchy_level,
+      {[this]() -> std::string { return "false"; }}});
+}
+
+
+uint32_t JPLMDecoderConfiguration::parse_downscale_factor(
+    const std::string &arg) {
+  auto factor = static_cast<uint32_t>(std::stoul(arg));
+  if (factor != 1 && factor != 2 && factor != 4 && factor != 8) {
+    throw JPLMConfigurationExceptions::InvalidDownscaleFactorException(factor);
+  }
+  return factor;
 }
 
 bool JPLMDecoderConfiguration::show_xml_box_with_catalog() const noexcept {
   return this->show_xml_box_with_catalog_;
-}
\ No newline at end of file
+}
+
+uint32_t JPLMDecoderConfiguration::get_downscale_factor() const noexcept {
+  return this->downscale_factor;
+}
+
+
+uint32_t JPLMDecoderConfiguration::get_views_downscale_factor() const
+    noexcept {
+  return this->views_downscale_factor;
+}
+
+
+uint8_t JPLMDecoderConfiguration::get_minimum_reconstruction_bit_plane() const
+    noexcept {
+  return this->minimum_reconstruction_bit_plane;
+}
+
+
+bool JPLMDecoderConfiguration::is_thumbnail_only() const noexcept {
+  return this->thumbnail_only;
+}
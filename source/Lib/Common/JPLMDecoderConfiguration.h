@@ -41,6 +41,8 @@
 #ifndef JPLMDECODERCONFIGURATION_H__
 #define JPLMDECODERCONFIGURATION_H__
 
+#include <limits>
+#include "Lib/Common/CommonExceptions.h"
 #include "Lib/Common/JPLMConfiguration.h"
 
 class JPLMDecoderConfiguration : public JPLMConfiguration {
@@ -49,6 +51,12 @@ class JPLMDecoderConfiguration : public JPLMConfiguration {
 
  protected:
   bool show_xml_box_with_catalog_ = false;
+  uint32_t downscale_factor = 1;
+  uint32_t views_downscale_factor = 1;
+  uint8_t minimum_reconstruction_bit_plane = 0;
+  bool thumbnail_only = false;
+
+  static uint32_t parse_downscale_factor(const std::string &arg);
 
   JPLMDecoderConfiguration(int argc, char **argv, std::size_t level);
   virtual void add_options() override;
@@ -58,6 +66,26 @@ class JPLMDecoderConfiguration : public JPLMConfiguration {
   virtual ~JPLMDecoderConfiguration() = default;
 
   bool show_xml_box_with_catalog() const noexcept;
+
+  /**
+   * \brief      Downscale factor of the intra-view dimensions (v and u)
+   */
+  uint32_t get_downscale_factor() const noexcept;
+
+  /**
+   * \brief      Downscale factor of the view dimensions (t and s)
+   */
+  uint32_t get_views_downscale_factor() const noexcept;
+
+  /**
+   * \brief      Lowest bit plane used to reconstruct transform coefficients
+   */
+  uint8_t get_minimum_reconstruction_bit_plane() const noexcept;
+
+  /**
+   * \brief      Determines if only the thumbnail shall be decoded
+   */
+  bool is_thumbnail_only() const noexcept;
 };
 
 #endif /* end of include guard: JPLMDECODERCONFIGURATION_H__ */
\ No newline at end of file
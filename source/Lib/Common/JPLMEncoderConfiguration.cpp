@@ -84,7 +84,8 @@ void JPLMEncoderConfiguration::add_options() {
       "(according to the JPEG Pleno Part). "
       "For Part 2, light field, the input is a directory containing a "
       "set of directories (one for each color channel). Each one of those "
-      "directories contains a set of views in PGX format.",
+      "directories contains a set of views in PGX format. Alternatively, "
+      "the input may be a planar light-field file (.plf).",
       [this](const nlohmann::json &conf) -> std::optional<std::string> {
         if (conf.contains("input")) {
           return conf["input"].get<std::string>();
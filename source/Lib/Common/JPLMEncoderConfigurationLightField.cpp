@@ -132,6 +132,41 @@ void JPLMEncoderConfigurationLightField::add_options() {
           this->current_hierarchy_level,
           {[this]() -> std::string { return "3"; }}});
 
+  this->add_cli_json_option({"--thumbnail-size", "-thumb",
+      "Inserts a thumbnail (uncompressed) in the generated JPL file, "
+      "downscaling it until its width and height are at most this size. "
+      "Zero (default) means that no thumbnail is inserted.",
+      [this](const json &conf) -> std::optional<std::string> {
+        if (conf.contains("thumbnail-size")) {
+          return std::to_string(conf["thumbnail-size"].get<uint32_t>());
+        }
+        return std::nullopt;
+      },
+      [this](std::string arg) { this->thumbnail_size = std::stoul(arg); },
+      this->current_hierarchy_level,
+      {[this]() -> std::string { return "0"; }}});
+
+
+  this->add_cli_json_option({"--thumbnail-mosaic", "-thumbm",
+      "Uses the mosaic of all views as thumbnail, instead of the central "
+      "view.",
+      [this](const json &conf) -> std::optional<std::string> {
+        if (conf.contains("thumbnail-mosaic")) {
+          return conf["thumbnail-mosaic"].get<std::string>();
+        }
+        return std::nullopt;
+      },
+      [this](std::string arg) {
+        if (arg == "false") {
+          this->thumbnail_mosaic = false;
+        } else {
+          this->thumbnail_mosaic = true;
+        }
+      },
+      this->current_hierarchy_level,
+      {[this]() -> std::string { return "false"; }}});
+
+
   this->add_cli_json_option({"--type", "-T",
       "Light-field codec type (mode). Available options are: " + 
       this->get_valid_enumerated_options_str<CompressionTypeLightField>(),
@@ -183,14 +218,19 @@ JPLMEncoderConfigurationLightField::JPLMEncoderConfigurationLightField(
 LightfieldIOConfiguration
 JPLMEncoderConfigurationLightField::get_lightfield_io_configurations() const {
   // \todo check this constants
-  auto dimension = LightfieldDimension<std::size_t>(
-      number_of_rows_t, number_of_columns_s, view_height_v, view_width_u);
-  auto config = LightfieldIOConfiguration(
-      input, dimension, {0, 0, 0, 0}, this->get_number_of_colour_channels());
+  auto config = LightfieldIOConfiguration(input, get_lightfield_dimension(),
+      {0, 0, 0, 0}, this->get_number_of_colour_channels());
   return config;
 }
 
 
+LightfieldDimension<std::size_t>
+JPLMEncoderConfigurationLightField::get_lightfield_dimension() const {
+  return LightfieldDimension<std::size_t>(
+      number_of_rows_t, number_of_columns_s, view_height_v, view_width_u);
+}
+
+
 CompressionTypeLightField JPLMEncoderConfigurationLightField::get_type() const {
   return type;
 }
@@ -250,3 +290,13 @@ uint16_t JPLMEncoderConfigurationLightField::get_number_of_colour_channels()
     const {
   return number_of_colour_channels;
 }
+
+
+uint32_t JPLMEncoderConfigurationLightField::get_thumbnail_size() const {
+  return thumbnail_size;
+}
+
+
+bool JPLMEncoderConfigurationLightField::is_thumbnail_a_mosaic() const {
+  return thumbnail_mosaic;
+}
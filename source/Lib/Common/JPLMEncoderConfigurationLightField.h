@@ -72,6 +72,8 @@ class JPLMEncoderConfigurationLightField : public JPLMEncoderConfiguration {
   EnumCS enum_cs = EnumCS::YCbCr_2;
   uint16_t number_of_colour_channels =
       3;  //<! \todo check the type of number of colour channels
+  uint32_t thumbnail_size = 0;  //<! 0 means that no thumbnail is inserted
+  bool thumbnail_mosaic = false;
 
   JPLMEncoderConfigurationLightField(int argc, char **argv, std::size_t level);
   void parse_number_of_rows_t(const nlohmann::json &conf);
@@ -83,6 +85,7 @@ class JPLMEncoderConfigurationLightField : public JPLMEncoderConfiguration {
  public:
   JPLMEncoderConfigurationLightField(int argc, char **argv);
   LightfieldIOConfiguration get_lightfield_io_configurations() const;
+  LightfieldDimension<std::size_t> get_lightfield_dimension() const;
   uint32_t get_number_of_rows_t() const;
   uint32_t get_number_of_columns_s() const;
   uint32_t get_view_height_v() const;
@@ -93,6 +96,20 @@ class JPLMEncoderConfigurationLightField : public JPLMEncoderConfiguration {
   EnumCS get_enum_cs() const;
   uint16_t get_number_of_colour_channels() const;
 
+  /**
+   * \brief      Gets the maximum width and height of the thumbnail to be
+   * inserted in the JPL file.
+   *
+   * \return     The thumbnail size, or 0 if no thumbnail shall be inserted.
+   */
+  uint32_t get_thumbnail_size() const;
+
+  /**
+   * \brief      Determines if the thumbnail is a mosaic of all views (instead
+   * of the central view).
+   */
+  bool is_thumbnail_a_mosaic() const;
+
   JpegPlenoProfileBrand get_profile() const {
     if (this->get_type() == CompressionTypeLightField::transform_mode) {
       return JpegPlenoProfileBrand::baseline_block_based_profile;
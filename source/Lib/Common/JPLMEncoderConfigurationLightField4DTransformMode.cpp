@@ -40,6 +40,9 @@
  */
 
 #include "Lib/Common/JPLMEncoderConfigurationLightField4DTransformMode.h"
+#include <filesystem>
+#include <sstream>
+#include "Lib/Common/CommonExceptions.h"
 
 
 void JPLMEncoderConfigurationLightField4DTransformMode::add_options() {
@@ -247,6 +250,69 @@ void JPLMEncoderConfigurationLightField4DTransformMode::add_options() {
       this->current_hierarchy_level,
       {[this]() -> std::string { return "1000.0"; }}});
 
+
+  this->add_cli_json_option({"--lambdas", "-ls",
+      "Comma separated Lagrangian multipliers. The light field is encoded "
+      "once for each of them, sharing the reading of the views and the 4D "
+      "transforms, and one file is written per lambda (the output filename "
+      "gets a _lambda_<value> suffix). Overrides --lambda.",
+      [this](const nlohmann::json &conf) -> std::optional<std::string> {
+        if (!conf.contains("lambdas")) {
+          return std::nullopt;
+        }
+        if (!conf["lambdas"].is_array()) {
+          return conf["lambdas"].get<std::string>();
+        }
+        auto list = std::string();
+        for (const auto &value : conf["lambdas"]) {
+          if (!list.empty()) {
+            list.push_back(',');
+          }
+          list += std::to_string(value.get<double>());
+        }
+        return list;
+      },
+      [this](std::string arg) { this->lambdas = get_lambdas_from_list(arg); },
+      this->current_hierarchy_level,
+      {[this]() -> std::string { return ""; }}});
+
+
+  this->add_cli_json_option({"--target-bpp", "-bpp",
+      "Target bitrate, in bits per pixel (of all channels, headers included). "
+      "The lambda is chosen by encoding a subsample of the 4D blocks with a "
+      "few lambdas (starting from --lambda) and overrides it. Zero disables "
+      "the rate control.",
+      [this](const nlohmann::json &conf) -> std::optional<std::string> {
+        if (conf.contains("target-bpp")) {
+          return std::to_string(conf["target-bpp"].get<double>());
+        }
+        return std::nullopt;
+      },
+      [this](std::string arg) { this->target_bpp = std::stod(arg); },
+      this->current_hierarchy_level,
+      {[this]() -> std::string { return "0"; }}});
+
+
+  this->add_cli_json_option({"--refine-lambda-per-row", "-rrow",
+      "With --target-bpp, corrects the lambda after each row of 4D blocks, "
+      "given the bytes actually spent, so that the remaining blocks "
+      "compensate the error of the calibration.",
+      [this](const nlohmann::json &conf) -> std::optional<std::string> {
+        if (conf.contains("refine-lambda-per-row")) {
+          return conf["refine-lambda-per-row"].get<std::string>();
+        }
+        return std::nullopt;
+      },
+      [this](std::string arg) {
+        if (arg == "false") {
+          this->refine_lambda_per_row_flag = false;
+        } else {
+          this->refine_lambda_per_row_flag = true;
+        }
+      },
+      this->current_hierarchy_level,
+      {[this]() -> std::string { return "false"; }}});
+
   this->add_cli_json_option({"--show-error-estimate", "-errorest",
       "Shows error estimates computed during RDO. Although close to the real "
       "error figures, they are only estimates (do not account for rounding "
@@ -288,8 +354,228 @@ void JPLMEncoderConfigurationLightField4DTransformMode::add_options() {
       },
       this->current_hierarchy_level,
       {[this]() -> std::string { return "false"; }}});
+
+
+  this->add_cli_json_option({"--trace-partition-depth", "-tdepth",
+      "When a trace file is written (--trace-file), the nodes of the "
+      "partition search with depth smaller than this value are recorded as "
+      "events (depth 0 is the 4D block itself).",
+      [this](const nlohmann::json &conf) -> std::optional<std::string> {
+        if (conf.contains("trace-partition-depth")) {
+          return std::to_string(conf["trace-partition-depth"].get<uint32_t>());
+        }
+        return std::nullopt;
+      },
+      [this](std::string arg) {
+        this->trace_partition_depth = std::stoul(arg);
+      },
+      this->current_hierarchy_level,
+      {[this]() -> std::string { return "2"; }}});
+
+
+  this->add_cli_json_option({"--partition-search-threads", "-psthreads",
+      "Number of threads of the partition search of each 4D block (0 for "
+      "one per hardware thread). With more than one, the alternatives of the "
+      "nodes (no split, spatial split and view split) are evaluated "
+      "concurrently. The result is the same of the single threaded search.",
+      [this](const nlohmann::json &conf) -> std::optional<std::string> {
+        if (conf.contains("partition-search-threads")) {
+          return std::to_string(
+              conf["partition-search-threads"].get<std::size_t>());
+        }
+        return std::nullopt;
+      },
+      [this](std::string arg) {
+        this->partition_search_threads = std::stoul(arg);
+      },
+      this->current_hierarchy_level,
+      {[this]() -> std::string { return "1"; }}});
+
+
+  this->add_cli_json_option({"--parallel-partition-depth", "-ppdepth",
+      "With --partition-search-threads, only the nodes of the partition "
+      "search with depth smaller than this value evaluate their alternatives "
+      "concurrently (depth 0 is the 4D block itself). Deeper nodes are too "
+      "small to pay for the tasks.",
+      [this](const nlohmann::json &conf) -> std::optional<std::string> {
+        if (conf.contains("parallel-partition-depth")) {
+          return std::to_string(
+              conf["parallel-partition-depth"].get<uint32_t>());
+        }
+        return std::nullopt;
+      },
+      [this](std::string arg) {
+        this->parallel_partition_depth = std::stoul(arg);
+      },
+      this->current_hierarchy_level,
+      {[this]() -> std::string { return "3"; }}});
+
+
+  this->add_cli_json_option({"--single-precision-partition-search",
+      "-spsearch",
+      "Computes the candidate transforms of the partition search in single "
+      "precision, which is faster but may choose a slightly worse partition. "
+      "The transforms of the chosen partition are computed again in double "
+      "precision before being coded.",
+      [this](const nlohmann::json &conf) -> std::optional<std::string> {
+        if (conf.contains("single-precision-partition-search")) {
+          return conf["single-precision-partition-search"].get<std::string>();
+        }
+        return std::nullopt;
+      },
+      [this](std::string arg) {
+        if (arg == "false") {
+          this->partition_search_precision =
+              TransformPrecision::double_precision;
+        } else {
+          this->partition_search_precision =
+              TransformPrecision::single_precision;
+        }
+      },
+      this->current_hierarchy_level,
+      {[this]() -> std::string { return "false"; }}});
+
+
+  this->add_cli_json_option({"--time-budget", "-tbudget",
+      "Wall-clock budget of the encoding, in seconds. The time left is split "
+      "across the remaining 4D blocks, and the partition search of each one "
+      "is limited to the deepest level that fits its share, given the times "
+      "measured in the previous blocks. Zero disables the time budget.",
+      [this](const nlohmann::json &conf) -> std::optional<std::string> {
+        if (conf.contains("time-budget")) {
+          return std::to_string(conf["time-budget"].get<double>());
+        }
+        return std::nullopt;
+      },
+      [this](std::string arg) { this->time_budget = std::stod(arg); },
+      this->current_hierarchy_level,
+      {[this]() -> std::string { return "0"; }}});
+
+
+  this->add_cli_json_option({"--checkpoint-interval", "-ckpt",
+      "Number of 4D blocks (of all channels) between checkpoints of the "
+      "encoding, written to the output file name followed by .checkpoint. "
+      "The checkpoint is removed once the output is written. Zero disables "
+      "the checkpoints.",
+      [this](const nlohmann::json &conf) -> std::optional<std::string> {
+        if (conf.contains("checkpoint-interval")) {
+          return std::to_string(
+              conf["checkpoint-interval"].get<std::size_t>());
+        }
+        return std::nullopt;
+      },
+      [this](std::string arg) {
+        this->checkpoint_interval = std::stoul(arg);
+      },
+      this->current_hierarchy_level,
+      {[this]() -> std::string { return "0"; }}});
+
+
+  this->add_cli_json_option({"--resume", "-resume",
+      "Continues the encoding from its checkpoint (see "
+      "--checkpoint-interval), if there is one, instead of starting from the "
+      "first 4D block. The options must be the ones of the interrupted "
+      "encoding.",
+      [this](const nlohmann::json &conf) -> std::optional<std::string> {
+        if (conf.contains("resume")) {
+          return conf["resume"].get<std::string>();
+        }
+        return std::nullopt;
+      },
+      [this](std::string arg) {
+        if (arg == "false") {
+          this->resume_flag = false;
+        } else {
+          this->resume_flag = true;
+        }
+      },
+      this->current_hierarchy_level,
+      {[this]() -> std::string { return "false"; }}});
+
+
+  this->add_cli_json_option({"--block-report", "-breport",
+      "Writes a per 4D block report (position, size, channel, bytes, "
+      "estimated SSE, partition code, inferior bit plane, number of "
+      "transform leaves and encoding time) to the given file. The report is "
+      "written as CSV if the file extension is .csv and as JSON otherwise.",
+      [this](const nlohmann::json &conf) -> std::optional<std::string> {
+        if (conf.contains("block-report")) {
+          return conf["block-report"].get<std::string>();
+        }
+        return std::nullopt;
+      },
+      [this](std::string arg) { this->block_report_filename = arg; },
+      this->current_hierarchy_level,
+      {[this]() -> std::string { return ""; }}});
+}
+
+const std::string &
+JPLMEncoderConfigurationLightField4DTransformMode::get_block_report_filename()
+    const noexcept {
+  return block_report_filename;
+}
+
+
+uint32_t JPLMEncoderConfigurationLightField4DTransformMode::
+    get_trace_partition_depth() const noexcept {
+  return trace_partition_depth;
+}
+
+
+std::size_t JPLMEncoderConfigurationLightField4DTransformMode::
+    get_partition_search_threads() const noexcept {
+  return partition_search_threads;
+}
+
+
+uint32_t JPLMEncoderConfigurationLightField4DTransformMode::
+    get_parallel_partition_depth() const noexcept {
+  return parallel_partition_depth;
+}
+
+
+TransformPrecision JPLMEncoderConfigurationLightField4DTransformMode::
+    get_partition_search_precision() const noexcept {
+  return partition_search_precision;
+}
+
+
+double JPLMEncoderConfigurationLightField4DTransformMode::get_time_budget()
+    const noexcept {
+  return time_budget;
+}
+
+
+bool JPLMEncoderConfigurationLightField4DTransformMode::has_time_budget()
+    const noexcept {
+  return time_budget > 0.0;
+}
+
+
+std::size_t JPLMEncoderConfigurationLightField4DTransformMode::
+    get_checkpoint_interval() const noexcept {
+  return checkpoint_interval;
 }
 
+
+bool JPLMEncoderConfigurationLightField4DTransformMode::writes_checkpoints()
+    const noexcept {
+  return checkpoint_interval > 0;
+}
+
+
+bool JPLMEncoderConfigurationLightField4DTransformMode::resumes()
+    const noexcept {
+  return resume_flag;
+}
+
+
+std::string JPLMEncoderConfigurationLightField4DTransformMode::
+    get_checkpoint_filename() const {
+  return get_output_filename() + ".checkpoint";
+}
+
+
 bool JPLMEncoderConfigurationLightField4DTransformMode::show_error_estimate()
     const noexcept {
   return show_estimated_error_flag;
@@ -317,6 +603,14 @@ JPLMEncoderConfigurationLightField4DTransformMode::
               current_hierarchy_level) {
   this->init(argc, argv);
   init_transform_size();  //<! \todo check if this may bring problems when this class is derived
+  if (has_target_bpp() && has_multiple_lambdas()) {
+    //each lambda of --lambdas would be overridden by the rate control
+    throw JPLMConfigurationExceptions::InconsistentOptionsException();
+  }
+  if (refines_lambda_per_row() && (writes_checkpoints() || resumes())) {
+    //the refinements of lambda are not kept in the checkpoint
+    throw JPLMConfigurationExceptions::InconsistentOptionsException();
+  }
 }
 
 
@@ -332,6 +626,74 @@ double JPLMEncoderConfigurationLightField4DTransformMode::get_lambda() const {
 }
 
 
+std::vector<double> JPLMEncoderConfigurationLightField4DTransformMode::
+    get_lambdas() const {
+  if (lambdas.empty()) {
+    return {lambda};
+  }
+  return lambdas;
+}
+
+
+bool JPLMEncoderConfigurationLightField4DTransformMode::has_multiple_lambdas()
+    const noexcept {
+  return !lambdas.empty();
+}
+
+
+double JPLMEncoderConfigurationLightField4DTransformMode::get_target_bpp()
+    const noexcept {
+  return target_bpp;
+}
+
+
+bool JPLMEncoderConfigurationLightField4DTransformMode::has_target_bpp()
+    const noexcept {
+  return target_bpp > 0.0;
+}
+
+
+bool JPLMEncoderConfigurationLightField4DTransformMode::
+    refines_lambda_per_row() const noexcept {
+  return refine_lambda_per_row_flag;
+}
+
+
+std::string
+JPLMEncoderConfigurationLightField4DTransformMode::get_filename_for_lambda(
+    const std::string &filename, double lambda) {
+  auto value = std::ostringstream();
+  value << lambda;
+  const auto path = std::filesystem::path(filename);
+  auto name = path.stem().string() + "_lambda_" + value.str() +
+              path.extension().string();
+  return (path.parent_path() / name).string();
+}
+
+
+std::vector<double> get_lambdas_from_list(const std::string &list) {
+  auto lambdas = std::vector<double>();
+  auto stream = std::istringstream(list);
+  auto item = std::string();
+  while (std::getline(stream, item, ',')) {
+    try {
+      auto number_of_characters = std::size_t(0);
+      lambdas.push_back(std::stod(item, &number_of_characters));
+      if (item.find_first_not_of(' ', number_of_characters) !=
+          std::string::npos) {
+        throw JPLMConfigurationExceptions::InvalidLambdasException(list);
+      }
+    } catch (const std::logic_error &) {
+      throw JPLMConfigurationExceptions::InvalidLambdasException(list);
+    }
+    if (!(lambdas.back() > 0.0)) {
+      throw JPLMConfigurationExceptions::InvalidLambdasException(list);
+    }
+  }
+  return lambdas;
+}
+
+
 uint32_t JPLMEncoderConfigurationLightField4DTransformMode::
     get_minimal_transform_size_intra_view_vertical() {
   return minimal_transform_size_intra_view_vertical_v;
@@ -42,10 +42,12 @@
 #define JPLMENCODERCONFIGURATIONLIGHTFIELD4DTRANSFORMMODE_H__
 
 #include <string>
+#include <vector>
 #include "Lib/Common/JPLMEncoderConfigurationLightField.h"
 #include "Lib/Part2/Common/LightfieldDimension.h"
 #include "Lib/Part2/Common/TransformMode/BorderBlocksPolicy.h"
 #include "Lib/Part2/Common/TransformMode/ComponentSsizParameter.h"
+#include "Lib/Part2/Common/TransformMode/TransformPrecision.h"
 
 // \todo: Refactor and improve the redundancies in this class
 class JPLMEncoderConfigurationLightField4DTransformMode
@@ -83,6 +85,9 @@ class JPLMEncoderConfigurationLightField4DTransformMode
   uint32_t minimal_transform_size_intra_view_horizontal_u = 4;
 
   double lambda = 1000.0;
+  std::vector<double> lambdas;  //<! Only filled when --lambdas is given
+  double target_bpp = 0.0;  //<! Zero disables the rate control
+  bool refine_lambda_per_row_flag = false;
   BorderBlocksPolicy border_policy = BorderBlocksPolicy::truncate;
 
   double transform_scale_t = 1.0;
@@ -92,6 +97,15 @@ class JPLMEncoderConfigurationLightField4DTransformMode
 
   bool show_estimated_error_flag = false;
   bool insert_codestream_pointer_set_flag = false;
+  uint32_t trace_partition_depth = 2;
+  std::size_t partition_search_threads = 1;
+  uint32_t parallel_partition_depth = 3;
+  TransformPrecision partition_search_precision =
+      TransformPrecision::double_precision;
+  double time_budget = 0.0;  //<! Zero disables the time budget
+  std::size_t checkpoint_interval = 0;  //<! Zero disables the checkpoints
+  bool resume_flag = false;
+  std::string block_report_filename = "";
 
  protected:
   virtual void add_options() override;
@@ -102,6 +116,42 @@ class JPLMEncoderConfigurationLightField4DTransformMode
  public:
   JPLMEncoderConfigurationLightField4DTransformMode(int argc, char **argv);
   double get_lambda() const;
+
+
+  /**
+   * \brief      Gets the lambdas the light field is encoded with: the ones
+   * given with --lambdas or, if none, the single --lambda.
+   */
+  std::vector<double> get_lambdas() const;
+
+
+  /**
+   * \brief      Whether --lambdas was given, i.e., one file is written per
+   * lambda.
+   */
+  bool has_multiple_lambdas() const noexcept;
+
+
+  /**
+   * \brief      Gets the name of the file written for a lambda when encoding
+   * with --lambdas, e.g., out_lambda_100.jpl for out.jpl and lambda 100.
+   */
+  static std::string get_filename_for_lambda(
+      const std::string &filename, double lambda);
+
+
+  double get_target_bpp() const noexcept;
+
+
+  /**
+   * \brief      Whether the lambda is chosen to reach a target bitrate
+   * (--target-bpp)
+   */
+  bool has_target_bpp() const noexcept;
+
+
+  bool refines_lambda_per_row() const noexcept;
+
   virtual CompressionTypeLightField get_compression_type() const override;
   uint32_t get_minimal_transform_size_intra_view_vertical();
   uint32_t get_maximal_transform_size_intra_view_vertical();
@@ -121,6 +171,63 @@ class JPLMEncoderConfigurationLightField4DTransformMode
   bool insert_codestream_pointer_set() const noexcept;
 
 
+  uint32_t get_trace_partition_depth() const noexcept;
+
+
+  /**
+   * \brief      Gets the number of threads of the partition search of each
+   * 4D block (0 for one per hardware thread)
+   */
+  std::size_t get_partition_search_threads() const noexcept;
+
+
+  uint32_t get_parallel_partition_depth() const noexcept;
+
+
+  /**
+   * \brief      Gets the precision of the candidate transforms of the
+   * partition search (the chosen ones are always coded in double precision)
+   */
+  TransformPrecision get_partition_search_precision() const noexcept;
+
+
+  double get_time_budget() const noexcept;
+
+
+  /**
+   * \brief      Whether the partition search depth of each 4D block is
+   * limited to encode within a wall-clock budget (--time-budget)
+   */
+  bool has_time_budget() const noexcept;
+
+
+  /**
+   * \brief      Gets the number of 4D blocks (of all channels) between
+   * checkpoints of the encoding (0 if no checkpoint is written)
+   */
+  std::size_t get_checkpoint_interval() const noexcept;
+
+
+  bool writes_checkpoints() const noexcept;
+
+
+  /**
+   * \brief      Whether the encoding continues from the checkpoint file, if
+   * there is one (--resume)
+   */
+  bool resumes() const noexcept;
+
+
+  /**
+   * \brief      Gets the name of the checkpoint file, e.g., out.jpl.checkpoint
+   * for out.jpl
+   */
+  std::string get_checkpoint_filename() const;
+
+
+  const std::string &get_block_report_filename() const noexcept;
+
+
   std::tuple<uint32_t, uint32_t, uint32_t, uint32_t>
   get_maximal_transform_sizes() const;
 
@@ -175,4 +282,11 @@ class JPLMEncoderConfigurationLightField4DTransformMode
 };
 
 
+
+/**
+ * \brief      Parses a comma separated list of (positive) lambdas.
+ */
+std::vector<double> get_lambdas_from_list(const std::string &list);
+
+
 #endif /* end of include guard: JPLMENCODERCONFIGURATIONLIGHTFIELD4DTRANSFORMMODE_H__ */
@@ -0,0 +1,176 @@
+/* The copyright in this software is being made available under the BSD
+ * License, included below. This software may be subject to other third party
+ * and contributor rights, including patent rights, and no such rights are
+ * granted under this license.
+ *
+ * Copyright (c) 2010-2019, ITU/ISO/IEC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *  * Neither the name of the ITU/ISO/IEC nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** \file     JPLMMemoryCodec.cpp
+ *  \brief    Library front-end to encode and decode light fields in memory
+ *  \details  
+ *  \date     2026-10-19
+ */
+
+#include "Lib/Common/JPLMMemoryCodec.h"
+#include <ostream>
+#include "Lib/Common/CommonExceptions.h"
+#include "Lib/Part1/Decoder/JPLFileFromStream.h"
+#include "Lib/Part2/Decoder/TransformMode/JPLM4DTransformModeLightFieldDecoder.h"
+#include "Lib/Part2/Encoder/TransformMode/JPLM4DTransformModeLightFieldEncoder.h"
+
+
+namespace {
+
+std::unique_ptr<JPLM4DTransformModeLightFieldEncoder<uint16_t>> run_encoder(
+    std::shared_ptr<JPLMEncoderConfigurationLightField4DTransformMode>
+        configuration,
+    const std::shared_ptr<LightfieldMemoryIO<uint16_t>>& input) {
+  if (input->get_number_of_channels() !=
+      configuration->get_number_of_colour_channels()) {
+    throw JPLMMemoryCodecExceptions::InconsistentNumberOfChannelsException(
+        configuration->get_number_of_colour_channels(),
+        input->get_number_of_channels());
+  }
+  auto encoder =
+      std::make_unique<JPLM4DTransformModeLightFieldEncoder<uint16_t>>(
+          configuration,
+          std::make_unique<LightFieldTransformMode<uint16_t>>(input));
+  encoder->run();
+
+  if (configuration->must_generate_xml_box_with_catalog()) {
+    encoder->get_ref_to_jpl_file().enable_catalog();
+  }
+  return encoder;
+}
+
+
+void write_jpl_file(const JPLFile& jpl_file, CodestreamSink& sink) {
+  sink.reserve(jpl_file.size());
+  auto stream_buffer = CodestreamSinkStreamBuffer(sink);
+  auto stream = std::ostream(&stream_buffer);
+  stream << jpl_file;
+  stream.flush();
+}
+
+}  // namespace
+
+
+void JPLMMemoryCodec::encode_light_field(
+    std::shared_ptr<JPLMEncoderConfigurationLightField4DTransformMode>
+        configuration,
+    const std::shared_ptr<LightfieldMemoryIO<uint16_t>>& input,
+    CodestreamSink& sink) {
+  auto encoder = run_encoder(configuration, input);
+  write_jpl_file(encoder->get_ref_to_jpl_file(), sink);
+}
+
+
+std::vector<std::byte> JPLMMemoryCodec::encode_light_field(
+    std::shared_ptr<JPLMEncoderConfigurationLightField4DTransformMode>
+        configuration,
+    const std::shared_ptr<LightfieldMemoryIO<uint16_t>>& input) {
+  auto bytes = std::vector<std::byte>();
+  auto sink = ByteVectorCodestreamSink(bytes);
+  encode_light_field(configuration, input, sink);
+  return bytes;
+}
+
+
+std::vector<std::vector<std::byte>>
+JPLMMemoryCodec::encode_light_field_for_each_lambda(
+    std::shared_ptr<JPLMEncoderConfigurationLightField4DTransformMode>
+        configuration,
+    const std::shared_ptr<LightfieldMemoryIO<uint16_t>>& input) {
+  auto encoder = run_encoder(configuration, input);
+  auto files = std::vector<std::vector<std::byte>>();
+  for (auto i = std::size_t(0); i < encoder->get_number_of_lambdas(); ++i) {
+    encoder->select_lambda(i);
+    auto sink = ByteVectorCodestreamSink(files.emplace_back());
+    write_jpl_file(encoder->get_ref_to_jpl_file(), sink);
+  }
+  return files;
+}
+
+
+void JPLMMemoryCodec::decode_light_fields(const std::byte* data,
+    std::size_t size, std::shared_ptr<JPLMDecoderConfiguration> configuration,
+    const LightfieldMemoryIOFactory& output_factory) {
+  using Decoder = JPLM4DTransformModeLightFieldDecoder<uint16_t>;
+
+  auto jpl_file = std::make_shared<JPLFileFromStream>(data, size);
+  for (const auto& codestream : jpl_file->get_reference_to_codestreams()) {
+    if (codestream->get_type() != JpegPlenoCodestreamBoxTypes::LightField) {
+      continue;
+    }
+    const auto& light_field_box =
+        static_cast<const JpegPlenoLightFieldBox&>(*codestream);
+    const auto& header =
+        Decoder::get_light_field_header_contents(light_field_box);
+    if (header.get_compression_type() !=
+        CompressionTypeLightField::transform_mode) {
+      throw JPLMConfigurationExceptions::UnsuportedPredictionMode();
+    }
+    auto output = output_factory(
+        Decoder::get_decoded_light_field_dimension(
+            light_field_box, *configuration),
+        header.get_number_of_components(), header.get_bits_per_component());
+    auto decoder = Decoder(jpl_file, light_field_box,
+        std::make_unique<LightFieldTransformMode<uint16_t>>(output),
+        configuration);
+    decoder.run();
+  }
+}
+
+
+DecodedLightField JPLMMemoryCodec::decode_light_field(const std::byte* data,
+    std::size_t size, std::shared_ptr<JPLMDecoderConfiguration> configuration) {
+  auto decoded = std::optional<DecodedLightField>();
+  decode_light_fields(data, size, configuration,
+      [&decoded](const auto& dimension, auto number_of_channels,
+          auto bits_per_sample)
+          -> std::shared_ptr<LightfieldMemoryIO<uint16_t>> {
+        if (decoded) {
+          return std::make_shared<LightfieldMemoryIO<uint16_t>>(dimension,
+              number_of_channels, bits_per_sample, nullptr,
+              [](const auto&, const auto&) {});
+        }
+        const auto number_of_samples =
+            dimension.get_number_of_views_per_lightfield() *
+            number_of_channels * dimension.get_number_of_pixels_per_view();
+        decoded = DecodedLightField{dimension, number_of_channels,
+            bits_per_sample, std::vector<uint16_t>(number_of_samples)};
+        return LightfieldMemoryIO<uint16_t>::to_planar_buffer(
+            decoded->samples.data(), dimension, number_of_channels,
+            bits_per_sample);
+      });
+  if (!decoded) {
+    throw JPLMMemoryCodecExceptions::NoLightFieldCodestreamException();
+  }
+  return std::move(*decoded);
+}
@@ -0,0 +1,151 @@
+/* The copyright in this software is being made available under the BSD
+ * License, included below. This software may be subject to other third party
+ * and contributor rights, including patent rights, and no such rights are
+ * granted under this license.
+ *
+ * Copyright (c) 2010-2019, ITU/ISO/IEC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *  * Neither the name of the ITU/ISO/IEC nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** \file     JPLMMemoryCodec.h
+ *  \brief    Library front-end to encode and decode light fields in memory
+ *  \details  Encodes light fields provided by the caller (a planar buffer or
+ *            a callback, see LightfieldMemoryIO) into a CodestreamSink, and
+ *            decodes a JPL file held in memory into caller-provided views,
+ *            without creating files.
+ *  \date     2026-10-19
+ */
+
+#ifndef JPLM_LIB_COMMON_JPLMMEMORYCODEC_H__
+#define JPLM_LIB_COMMON_JPLMMEMORYCODEC_H__
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <vector>
+#include "Lib/Common/JPLMDecoderConfiguration.h"
+#include "Lib/Common/JPLMEncoderConfigurationLightField4DTransformMode.h"
+#include "Lib/Part2/Common/LightfieldMemoryIO.h"
+#include "Lib/Utils/Stream/CodestreamSink.h"
+
+
+/**
+ * \brief      A light field decoded to a planar buffer (see
+ * LightfieldMemoryIO for the sample order).
+ */
+struct DecodedLightField {
+  LightfieldDimension<std::size_t> dimension;
+  std::size_t number_of_channels;
+  std::size_t bits_per_sample;
+  std::vector<uint16_t> samples;
+};
+
+
+class JPLMMemoryCodec {
+ public:
+  /**
+   * \brief      Creates the destination of a decoded light field, given the
+   * information in its header (dimension, number of channels and bits per
+   * sample).
+   *
+   * \details    The dimension is the one of the decoded light field, i.e., it
+   * is already downscaled when the configuration asks for a preview.
+   */
+  using LightfieldMemoryIOFactory =
+      std::function<std::shared_ptr<LightfieldMemoryIO<uint16_t>>(
+          const LightfieldDimension<std::size_t>& dimension,
+          std::size_t number_of_channels, std::size_t bits_per_sample)>;
+
+
+  /**
+   * \brief      Encodes a light field in memory.
+   *
+   * \param[in]  configuration  The configuration (input and output paths are
+   *                            ignored)
+   * \param[in]  input          The light field to be encoded
+   * \param      sink           Receives the JPL file
+   */
+  static void encode_light_field(
+      std::shared_ptr<JPLMEncoderConfigurationLightField4DTransformMode>
+          configuration,
+      const std::shared_ptr<LightfieldMemoryIO<uint16_t>>& input,
+      CodestreamSink& sink);
+
+
+  /**
+   * \brief      Encodes a light field in memory.
+   *
+   * \return     The JPL file
+   */
+  static std::vector<std::byte> encode_light_field(
+      std::shared_ptr<JPLMEncoderConfigurationLightField4DTransformMode>
+          configuration,
+      const std::shared_ptr<LightfieldMemoryIO<uint16_t>>& input);
+
+
+  /**
+   * \brief      Encodes a light field in memory with each of the lambdas of
+   * the configuration (see --lambdas), sharing the reading of the views and
+   * the 4D transforms.
+   *
+   * \return     One JPL file per lambda, in the order of the lambdas
+   */
+  static std::vector<std::vector<std::byte>>
+  encode_light_field_for_each_lambda(
+      std::shared_ptr<JPLMEncoderConfigurationLightField4DTransformMode>
+          configuration,
+      const std::shared_ptr<LightfieldMemoryIO<uint16_t>>& input);
+
+
+  /**
+   * \brief      Decodes all light fields in a JPL file held in memory.
+   *
+   * \param[in]  data            The JPL file
+   * \param[in]  size            The size of the JPL file, in bytes
+   * \param[in]  configuration   The configuration (input and output paths are
+   *                             ignored)
+   * \param[in]  output_factory  Called once per light field codestream to
+   *                             create the destination of its views
+   */
+  static void decode_light_fields(const std::byte* data, std::size_t size,
+      std::shared_ptr<JPLMDecoderConfiguration> configuration,
+      const LightfieldMemoryIOFactory& output_factory);
+
+
+  /**
+   * \brief      Decodes the first light field in a JPL file held in memory.
+   *
+   * \details    Any other light field in the file is decoded, but discarded.
+   * Throws if the file has no light field codestream.
+   */
+  static DecodedLightField decode_light_field(const std::byte* data,
+      std::size_t size,
+      std::shared_ptr<JPLMDecoderConfiguration> configuration);
+};
+
+#endif /* end of include guard: JPLM_LIB_COMMON_JPLMMEMORYCODEC_H__ */
@@ -52,9 +52,40 @@ uint64_t JpegPlenoThumbnailContents::size() const noexcept {
     return sum + val.size();
   };
 
-  return ihdr.size() + bpcc->size() +
-         std::accumulate(colr.begin(), colr.end(), 0, sum_colr_sizes) +
-         cdef->size() + jpc2->size();
+  return ihdr.size() + (bpcc ? bpcc->size() : 0) +
+         std::accumulate(
+             colr.begin(), colr.end(), uint64_t{0}, sum_colr_sizes) +
+         (cdef ? cdef->size() : 0) + (jpc2 ? jpc2->size() : 0);
+}
+
+
+const ImageHeaderBox &JpegPlenoThumbnailContents::get_const_ref_to_ihdr() const
+    noexcept {
+  return ihdr;
+}
+
+
+const std::optional<BitsPerComponentBox> &
+JpegPlenoThumbnailContents::get_const_ref_to_bpcc() const noexcept {
+  return bpcc;
+}
+
+
+const std::vector<ColourSpecificationBox> &
+JpegPlenoThumbnailContents::get_const_ref_to_colr() const noexcept {
+  return colr;
+}
+
+
+const std::optional<ChannelDefinitionBox> &
+JpegPlenoThumbnailContents::get_const_ref_to_cdef() const noexcept {
+  return cdef;
+}
+
+
+const std::optional<ContiguousCodestreamBox> &
+JpegPlenoThumbnailContents::get_const_ref_to_jpc2() const noexcept {
+  return jpc2;
 }
 
 
@@ -78,3 +109,21 @@ bool JpegPlenoThumbnailContents::operator!=(
     const JpegPlenoThumbnailContents &other) const {
   return !this->operator==(other);
 }
+
+
+std::ostream &JpegPlenoThumbnailContents::write_to(std::ostream &stream) const {
+  stream << ihdr;
+  if (bpcc) {
+    stream << *bpcc;
+  }
+  for (const auto &colour_specification_box : colr) {
+    stream << colour_specification_box;
+  }
+  if (cdef) {
+    stream << *cdef;
+  }
+  if (jpc2) {
+    stream << *jpc2;
+  }
+  return stream;
+}
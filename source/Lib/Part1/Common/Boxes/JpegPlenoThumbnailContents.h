@@ -43,16 +43,18 @@
 
 #include <algorithm>
 #include <numeric>
+#include <optional>
+#include <vector>
 #include "Lib/Common/Boxes/Generic/BitsPerComponentBox.h"
 #include "Lib/Common/Boxes/Generic/ChannelDefinitionBox.h"
 #include "Lib/Common/Boxes/Generic/ColourSpecificationBox.h"
 #include "Lib/Common/Boxes/Generic/ContiguousCodestreamBox.h"
 #include "Lib/Common/Boxes/Generic/ImageHeaderBox.h"
 #include "Lib/Common/Boxes/Generic/ImageHeaderContents.h"
-#include "Lib/Common/Boxes/InMemoryDBox.h"
+#include "Lib/Common/Boxes/SuperBoxDBox.h"
 
 
-class JpegPlenoThumbnailContents : public InMemoryDBox {
+class JpegPlenoThumbnailContents : public SuperBoxDBox {
  protected:
   ImageHeaderBox ihdr;  //image header box
   std::optional<BitsPerComponentBox> bpcc;
@@ -86,6 +88,25 @@ class JpegPlenoThumbnailContents : public InMemoryDBox {
   virtual JpegPlenoThumbnailContents* clone() const override;
 
 
+  const ImageHeaderBox& get_const_ref_to_ihdr() const noexcept;
+
+
+  const std::optional<BitsPerComponentBox>& get_const_ref_to_bpcc() const
+      noexcept;
+
+
+  const std::vector<ColourSpecificationBox>& get_const_ref_to_colr() const
+      noexcept;
+
+
+  const std::optional<ChannelDefinitionBox>& get_const_ref_to_cdef() const
+      noexcept;
+
+
+  const std::optional<ContiguousCodestreamBox>& get_const_ref_to_jpc2() const
+      noexcept;
+
+
   virtual uint64_t size() const noexcept override;
 
 
@@ -96,6 +117,9 @@ class JpegPlenoThumbnailContents : public InMemoryDBox {
 
 
   bool operator!=(const JpegPlenoThumbnailContents& other) const;
+
+
+  std::ostream& write_to(std::ostream& stream) const final;
 };
 
 
@@ -42,6 +42,7 @@
 #ifndef JPLM_LIB_PART1_COMMON_COMMONEXCEPTIONS_H__
 #define JPLM_LIB_PART1_COMMON_COMMONEXCEPTIONS_H__
 
+#include <cstdint>
 #include <exception>
 #include <iostream>
 #include <string>
@@ -97,4 +98,53 @@ class InvalidSizeException : public std::exception {
 
 }  // namespace ImageHeaderBoxExceptions
 
+
+namespace JpegPlenoThumbnailExceptions {
+
+class UnsupportedThumbnailCompressionTypeException : public std::exception {
+ protected:
+  std::string message;
+
+ public:
+  UnsupportedThumbnailCompressionTypeException(const uint8_t compression_type)
+      : message(std::string("Unable to read a thumbnail with compression "
+                            "type ") +
+                std::to_string(compression_type) +
+                std::string(". Only uncompressed thumbnails (C = 0) are "
+                            "supported.")) {
+  }
+  const char* what() const noexcept override {
+    return message.c_str();
+  }
+};
+
+
+class ThumbnailWithoutCodestreamException : public std::exception {
+ public:
+  const char* what() const noexcept override {
+    return "The JPEG Pleno Thumbnail box has no Contiguous Codestream box "
+           "with the thumbnail samples.";
+  }
+};
+
+
+class InvalidThumbnailCodestreamSizeException : public std::exception {
+ protected:
+  std::string message;
+
+ public:
+  InvalidThumbnailCodestreamSizeException(
+      const uint64_t expected_size, const uint64_t size)
+      : message(std::string("The thumbnail codestream was expected to have ") +
+                std::to_string(expected_size) +
+                std::string(" bytes, but has ") + std::to_string(size) +
+                std::string(" bytes.")) {
+  }
+  const char* what() const noexcept override {
+    return message.c_str();
+  }
+};
+
+}  // namespace JpegPlenoThumbnailExceptions
+
 #endif /* end of include guard: JPLM_LIB_PART1_COMMON_COMMONEXCEPTIONS_H__ */
\ No newline at end of file
@@ -0,0 +1,153 @@
+/* The copyright in this software is being made available under the BSD
+ * License, included below. This software may be subject to other third party
+ * and contributor rights, including patent rights, and no such rights are
+ * granted under this license.
+ *
+ * Copyright (c) 2010-2019, ITU/ISO/IEC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *  * Neither the name of the ITU/ISO/IEC nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** \file     UncompressedThumbnail.cpp
+ *  \brief    Conversion between images and uncompressed thumbnail boxes
+ *  \details  
+ *  \date     2026-10-19
+ */
+
+#include "Lib/Part1/Common/UncompressedThumbnail.h"
+#include "Lib/Common/Boxes/Generic/ContiguousCodestreamCodeInMemory.h"
+#include "Lib/Utils/Image/RGBImage.h"
+#include "Lib/Utils/Image/UndefinedImage.h"
+#include "Lib/Utils/Stream/BinaryTools.h"
+
+
+namespace {
+
+std::size_t get_bytes_per_sample(const std::size_t bpp) {
+  return (bpp <= 8) ? 1 : 2;
+}
+
+}  // namespace
+
+
+JpegPlenoThumbnailBox UncompressedThumbnail::get_thumbnail_box(
+    const Image<uint16_t>& image, EnumCS enum_cs) {
+  const auto number_of_channels = image.get_number_of_channels();
+  const auto width = image.get_width();
+  const auto height = image.get_height();
+  const auto bpp = image.get_bpp();
+  const auto bytes_per_sample = get_bytes_per_sample(bpp);
+
+  auto bytes = std::vector<std::byte>();
+  bytes.reserve(number_of_channels * width * height * bytes_per_sample);
+  for (auto c = decltype(number_of_channels){0}; c < number_of_channels;
+       ++c) {
+    const auto& channel = image.get_channel(c);
+    for (auto i = decltype(height){0}; i < height; ++i) {
+      const auto* row = channel[i];
+      for (auto j = decltype(width){0}; j < width; ++j) {
+        if (bytes_per_sample == 1) {
+          BinaryTools::append_big_endian_bytes(
+              bytes, static_cast<uint8_t>(row[j]));
+        } else {
+          BinaryTools::append_big_endian_bytes(bytes, row[j]);
+        }
+      }
+    }
+  }
+
+  auto image_header_box = ImageHeaderBox(ImageHeaderContents(height, width,
+      number_of_channels, bpp, CompressionTypeImage::Uncompressed, 0, 0));
+  auto colour_specification_boxes = std::vector<ColourSpecificationBox>();
+  colour_specification_boxes.emplace_back(
+      ColourSpecificationContents(1, 1, 0, enum_cs));
+  auto contiguous_codestream_box =
+      ContiguousCodestreamBox(ContiguousCodestreamContents(
+          std::make_unique<ContiguousCodestreamCodeInMemory>(
+              std::move(bytes))));
+
+  return JpegPlenoThumbnailBox(JpegPlenoThumbnailContents(image_header_box,
+      std::nullopt, colour_specification_boxes, std::nullopt,
+      contiguous_codestream_box));
+}
+
+
+std::unique_ptr<Image<uint16_t>> UncompressedThumbnail::get_image(
+    const JpegPlenoThumbnailBox& thumbnail_box) {
+  const auto& contents = thumbnail_box.get_ref_to_contents();
+  const auto& header =
+      contents.get_const_ref_to_ihdr().get_ref_to_contents();
+  if (header.get_coder_type() != CompressionTypeImage::Uncompressed) {
+    throw JpegPlenoThumbnailExceptions::
+        UnsupportedThumbnailCompressionTypeException(
+            static_cast<uint8_t>(header.get_coder_type()));
+  }
+  const auto& codestream_box = contents.get_const_ref_to_jpc2();
+  if (!codestream_box) {
+    throw JpegPlenoThumbnailExceptions::
+        ThumbnailWithoutCodestreamException();
+  }
+
+  const std::size_t number_of_channels = header.get_number_of_channels();
+  const std::size_t width = header.get_width();
+  const std::size_t height = header.get_height();
+  const std::size_t bpp = header.get_bits_per_component();
+  const auto bytes_per_sample = get_bytes_per_sample(bpp);
+
+  const auto& code = codestream_box->get_ref_to_contents().get_ref_to_code();
+  const auto expected_size =
+      number_of_channels * width * height * bytes_per_sample;
+  if (code.size() != expected_size) {
+    throw JpegPlenoThumbnailExceptions::
+        InvalidThumbnailCodestreamSizeException(expected_size, code.size());
+  }
+
+  auto image = (number_of_channels == 3)
+                   ? std::unique_ptr<Image<uint16_t>>(
+                         std::make_unique<RGBImage<uint16_t>>(
+                             width, height, bpp))
+                   : std::unique_ptr<Image<uint16_t>>(
+                         std::make_unique<UndefinedImage<uint16_t>>(
+                             width, height, bpp, number_of_channels));
+
+  auto position = uint64_t{0};
+  for (auto c = decltype(number_of_channels){0}; c < number_of_channels;
+       ++c) {
+    auto& channel = image->get_channel(c);
+    for (auto i = decltype(height){0}; i < height; ++i) {
+      auto* row = channel[i];
+      for (auto j = decltype(width){0}; j < width; ++j) {
+        auto value = std::to_integer<uint16_t>(code.get_byte_at(position++));
+        if (bytes_per_sample == 2) {
+          value = (value << 8) |
+                  std::to_integer<uint16_t>(code.get_byte_at(position++));
+        }
+        row[j] = value;
+      }
+    }
+  }
+  return image;
+}
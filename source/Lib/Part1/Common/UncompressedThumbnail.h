@@ -0,0 +1,86 @@
+/* The copyright in this software is being made available under the BSD
+ * License, included below. This software may be subject to other third party
+ * and contributor rights, including patent rights, and no such rights are
+ * granted under this license.
+ *
+ * Copyright (c) 2010-2019, ITU/ISO/IEC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *  * Neither the name of the ITU/ISO/IEC nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** \file     UncompressedThumbnail.h
+ *  \brief    Conversion between images and uncompressed thumbnail boxes
+ *  \details  The thumbnail samples are stored in the Contiguous Codestream
+ *            box of the JPEG Pleno Thumbnail box, component after component
+ *            and in raster order, using one byte per sample when the bit
+ *            depth is up to 8 bits and two (big-endian) bytes otherwise. The
+ *            Image Header box signals it with the compression type 0
+ *            (uncompressed).
+ *  \date     2026-10-19
+ */
+
+#ifndef JPLM_LIB_PART1_COMMON_UNCOMPRESSEDTHUMBNAIL_H__
+#define JPLM_LIB_PART1_COMMON_UNCOMPRESSEDTHUMBNAIL_H__
+
+#include <cstdint>
+#include <memory>
+#include "Lib/Common/Boxes/Generic/EnumCS.h"
+#include "Lib/Part1/Common/Boxes/JpegPlenoThumbnailBox.h"
+#include "Lib/Part1/Common/CommonExceptions.h"
+#include "Lib/Utils/Image/Image.h"
+
+namespace UncompressedThumbnail {
+
+/**
+ * \brief      Creates a thumbnail box holding the samples of an image.
+ *
+ * \param[in]  image    The thumbnail image
+ * \param[in]  enum_cs  The colour space signalled in the Colour
+ *                      Specification box
+ *
+ * \return     The JPEG Pleno Thumbnail box
+ */
+JpegPlenoThumbnailBox get_thumbnail_box(
+    const Image<uint16_t>& image, EnumCS enum_cs);
+
+
+/**
+ * \brief      Gets the image stored in an uncompressed thumbnail box.
+ *
+ * \details    Three component thumbnails are returned as RGB images (the
+ * same assumption made when light-field views are written as PPM files);
+ * the others are returned as undefined images.
+ *
+ * \param[in]  thumbnail_box  The thumbnail box
+ *
+ * \return     The thumbnail image
+ */
+std::unique_ptr<Image<uint16_t>> get_image(
+    const JpegPlenoThumbnailBox& thumbnail_box);
+
+}  // namespace UncompressedThumbnail
+
+#endif /* end of include guard: JPLM_LIB_PART1_COMMON_UNCOMPRESSEDTHUMBNAIL_H__ */
@@ -238,9 +238,22 @@ void JPLFileFromStream::populate_codestreams_list() {
 }
 
 
+void JPLFileFromStream::populate_thumbnail() {
+  if (auto it = temp_decoded_boxes.find(JpegPlenoThumbnailBox::id);
+      it != temp_decoded_boxes.end()) {
+    auto& thumbnail_boxes_pairs = it->second;
+    if (!thumbnail_boxes_pairs.empty()) {
+      auto& thumbnail_box = std::get<1>(thumbnail_boxes_pairs.front());
+      jpeg_pleno_thumbnail_box = std::unique_ptr<JpegPlenoThumbnailBox>(
+          static_cast<JpegPlenoThumbnailBox*>(thumbnail_box.release()));
+    }
+  }
+}
+
+
 void JPLFileFromStream::populate_jpl_fields() {
   //! \todo populate_xml_box_with_catalog();
-  //! \todo populate_thumbnail();
+  populate_thumbnail();
   populate_codestreams_list();
 }
 
@@ -248,6 +261,18 @@ void JPLFileFromStream::populate_jpl_fields() {
 JPLFileFromStream::JPLFileFromStream(const std::string& filename)
     : JPLFileParser(filename), JPLFile(JPLFileParser::get_signature_box(),
                                    JPLFileParser::get_file_type_box()) {
+  parse_remaining_boxes();
+}
+
+
+JPLFileFromStream::JPLFileFromStream(const std::byte* data, std::size_t size)
+    : JPLFileParser(data, size), JPLFile(JPLFileParser::get_signature_box(),
+                                     JPLFileParser::get_file_type_box()) {
+  parse_remaining_boxes();
+}
+
+
+void JPLFileFromStream::parse_remaining_boxes() {
   if (!this->file_type_box->get_ref_to_contents().is_the_file_compatible_with(
           JpegPlenoSignatureBox::id)) {
     throw JPLFileFromStreamExceptions::
@@ -76,6 +76,13 @@ class JPLFileFromStream : public JPLFileParser, public JPLFile {
   void check_boxes_constraints();
 
 
+  /**
+   * @brief      Populates the thumbnail of the JPLFile with the first
+   *             thumbnail box found in the stream
+   */
+  void populate_thumbnail();
+
+
   /**
    * @brief      Populates the lightfield codestreams list within the JPLFile
    */
@@ -107,6 +114,13 @@ class JPLFileFromStream : public JPLFileParser, public JPLFile {
    */
   void populate_jpl_fields();
 
+
+  /**
+   * @brief      Parses the boxes after the file type box and populates the
+   *             JPLFile
+   */
+  void parse_remaining_boxes();
+
  public:
   /**
    * @brief      Constructs a new instance.
@@ -116,6 +130,16 @@ class JPLFileFromStream : public JPLFileParser, public JPLFile {
   JPLFileFromStream(const std::string& filename);
 
 
+  /**
+   * @brief      Constructs a new instance from a codestream in memory.
+   *
+   * @param[in]  data  The bytes of the JPL file (they must outlive this
+   *                   object)
+   * @param[in]  size  The number of bytes
+   */
+  JPLFileFromStream(const std::byte* data, std::size_t size);
+
+
   /**
    * @brief      Gets the number of decoded boxes.
    *
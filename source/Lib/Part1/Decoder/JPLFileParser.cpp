@@ -96,8 +96,24 @@ std::unique_ptr<FileTypeBox> JPLFileParser::get_file_type_box() {
 
 JPLFileParser::JPLFileParser(const std::string& filename)
     : filename(filename), file_size(std::filesystem::file_size(filename)),
-      if_stream(filename, std::ifstream::binary),
-      managed_stream(if_stream, static_cast<uint64_t>(file_size)) {
+      input_stream(
+          std::make_unique<std::ifstream>(filename, std::ifstream::binary)),
+      managed_stream(*input_stream, static_cast<uint64_t>(file_size)) {
+  parse_initial_boxes();
+}
+
+
+JPLFileParser::JPLFileParser(const std::byte* data, std::size_t size)
+    : filename(""), file_size(size),
+      byte_array_buffer(
+          std::make_unique<ByteArrayInputStreamBuffer>(data, size)),
+      input_stream(std::make_unique<std::istream>(byte_array_buffer.get())),
+      managed_stream(*input_stream, static_cast<uint64_t>(file_size)) {
+  parse_initial_boxes();
+}
+
+
+void JPLFileParser::parse_initial_boxes() {
   if (file_size < 20) {
     //the file should have at least the file type box
     throw JPLFileFromStreamExceptions::InvalidTooSmallFileException(file_size);
@@ -42,7 +42,9 @@
 #define JPLM_LIB_PART1_DECODER_JPLFILEPARSER_H
 
 
+#include <memory>
 #include "Lib/Common/Boxes/Parsers/BoxParserRegistry.h"
+#include "Lib/Utils/Stream/ByteArrayInputStreamBuffer.h"
 #include "Lib/Utils/Stream/ManagedStream.h"
 
 
@@ -51,7 +53,9 @@ class JPLFileParser {
   const BoxParserRegistry& parser = BoxParserRegistry::get_instance();
   const std::string filename;
   const uint64_t file_size;
-  std::ifstream if_stream;
+  //! only used when parsing a codestream that is already in memory
+  std::unique_ptr<ByteArrayInputStreamBuffer> byte_array_buffer;
+  std::unique_ptr<std::istream> input_stream;
   ManagedStream managed_stream;
   std::unique_ptr<JpegPlenoSignatureBox> temp_signature;
   std::unique_ptr<FileTypeBox> temp_file_type;
@@ -75,10 +79,23 @@ class JPLFileParser {
 
   std::unique_ptr<FileTypeBox> get_file_type_box();
 
+
+  void parse_initial_boxes();
+
  public:
   JPLFileParser(const std::string& filename);
 
 
+  /**
+   * @brief      Constructs a parser of a codestream in memory.
+   *
+   * @param[in]  data  The bytes of the codestream, which must outlive the
+   *                   parser
+   * @param[in]  size  The number of bytes
+   */
+  JPLFileParser(const std::byte* data, std::size_t size);
+
+
   virtual ~JPLFileParser();
 };
 
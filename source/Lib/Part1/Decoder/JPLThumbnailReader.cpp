@@ -0,0 +1,89 @@
+/* The copyright in this software is being made available under the BSD
+ * License, included below. This software may be subject to other third party
+ * and contributor rights, including patent rights, and no such rights are
+ * granted under this license.
+ *
+ * Copyright (c) 2010-2019, ITU/ISO/IEC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *  * Neither the name of the ITU/ISO/IEC nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** \file     JPLThumbnailReader.cpp
+ *  \brief    Reads the thumbnail of a JPL file without parsing its codestreams
+ *  \details  
+ *  \date     2026-10-19
+ */
+
+#include "Lib/Part1/Decoder/JPLThumbnailReader.h"
+#include <filesystem>
+#include <fstream>
+#include "Lib/Part1/Common/Boxes/JpegPlenoCodestreamBox.h"
+
+
+JPLThumbnailReader::JPLThumbnailReader(const std::string& filename)
+    : input_stream(
+          std::make_unique<std::ifstream>(filename, std::ifstream::binary)),
+      managed_stream(*input_stream,
+          static_cast<uint64_t>(std::filesystem::file_size(filename))) {
+}
+
+
+JPLThumbnailReader::JPLThumbnailReader(const std::byte* data, std::size_t size)
+    : byte_array_buffer(
+          std::make_unique<ByteArrayInputStreamBuffer>(data, size)),
+      input_stream(std::make_unique<std::istream>(byte_array_buffer.get())),
+      managed_stream(*input_stream, static_cast<uint64_t>(size)) {
+}
+
+
+bool JPLThumbnailReader::is_plenoptic(const t_box_id_type id) {
+  return (id == static_cast<t_box_id_type>(
+                    JpegPlenoCodestreamBoxTypes::LightField)) ||
+         (id == static_cast<t_box_id_type>(
+                    JpegPlenoCodestreamBoxTypes::PointCloud)) ||
+         (id ==
+             static_cast<t_box_id_type>(JpegPlenoCodestreamBoxTypes::Hologram));
+}
+
+
+std::unique_ptr<JpegPlenoThumbnailBox>
+JPLThumbnailReader::read_thumbnail_box() {
+  while (managed_stream.is_valid()) {
+    auto box_stream = managed_stream.get_remaining_sub_managed_stream();
+    auto box_parser_helper = BoxParserHelperBase(box_stream);
+    const auto id = box_parser_helper.get_t_box_value();
+    if (id == JpegPlenoThumbnailBox::id) {
+      auto thumbnail_box = parser.parse(box_parser_helper);
+      return std::unique_ptr<JpegPlenoThumbnailBox>(
+          static_cast<JpegPlenoThumbnailBox*>(thumbnail_box.release()));
+    }
+    if (is_plenoptic(id)) {
+      break;
+    }
+    box_parser_helper.get_data_stream().forward();
+  }
+  return nullptr;
+}
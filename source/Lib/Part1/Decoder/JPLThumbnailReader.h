@@ -0,0 +1,95 @@
+/* The copyright in this software is being made available under the BSD
+ * License, included below. This software may be subject to other third party
+ * and contributor rights, including patent rights, and no such rights are
+ * granted under this license.
+ *
+ * Copyright (c) 2010-2019, ITU/ISO/IEC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *  * Neither the name of the ITU/ISO/IEC nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** \file     JPLThumbnailReader.h
+ *  \brief    Reads the thumbnail of a JPL file without parsing its codestreams
+ *  \details  Only the headers (LBox and TBox) of the boxes that precede the
+ *            JPEG Pleno Thumbnail box are read; their contents are skipped.
+ *            As the thumbnail shall be signalled before the plenoptic
+ *            superboxes (A.2.3), the search stops at the first of them.
+ *  \date     2026-10-19
+ */
+
+#ifndef JPLM_LIB_PART1_DECODER_JPLTHUMBNAILREADER_H__
+#define JPLM_LIB_PART1_DECODER_JPLTHUMBNAILREADER_H__
+
+#include <cstddef>
+#include <istream>
+#include <memory>
+#include <string>
+#include "Lib/Common/Boxes/Parsers/BoxParserRegistry.h"
+#include "Lib/Part1/Common/Boxes/JpegPlenoThumbnailBox.h"
+#include "Lib/Utils/Stream/ByteArrayInputStreamBuffer.h"
+#include "Lib/Utils/Stream/ManagedStream.h"
+
+class JPLThumbnailReader {
+ protected:
+  const BoxParserRegistry& parser = BoxParserRegistry::get_instance();
+  //! only used when reading a codestream that is already in memory
+  std::unique_ptr<ByteArrayInputStreamBuffer> byte_array_buffer;
+  std::unique_ptr<std::istream> input_stream;
+  ManagedStream managed_stream;
+
+  static bool is_plenoptic(const t_box_id_type id);
+
+ public:
+  /**
+   * \brief      Constructs a reader of a JPL file.
+   *
+   * \param[in]  filename  The filename
+   */
+  JPLThumbnailReader(const std::string& filename);
+
+
+  /**
+   * \brief      Constructs a reader of a JPL file in memory.
+   *
+   * \param[in]  data  The bytes of the JPL file, which must outlive the
+   *                   reader
+   * \param[in]  size  The number of bytes
+   */
+  JPLThumbnailReader(const std::byte* data, std::size_t size);
+
+
+  /**
+   * \brief      Reads the thumbnail box.
+   *
+   * \return     The thumbnail box, or nullptr if the file has no thumbnail.
+   */
+  std::unique_ptr<JpegPlenoThumbnailBox> read_thumbnail_box();
+
+
+  virtual ~JPLThumbnailReader() = default;
+};
+
+#endif /* end of include guard: JPLM_LIB_PART1_DECODER_JPLTHUMBNAILREADER_H__ */
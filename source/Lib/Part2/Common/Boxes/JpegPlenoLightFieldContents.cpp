@@ -59,6 +59,12 @@ void JpegPlenoLightFieldContents::add_contiguous_codestream_box(
 }
 
 
+std::unique_ptr<ContiguousCodestreamBox>
+JpegPlenoLightFieldContents::release_contiguous_codestream_box() {
+  return std::move(contiguous_codestream_box);
+}
+
+
 ContiguousCodestreamBox &
 JpegPlenoLightFieldContents::get_ref_to_contiguous_codestream_box() {
   if (!contiguous_codestream_box) {
@@ -114,6 +114,14 @@ class JpegPlenoLightFieldContents : public SuperBoxDBox {
       std::unique_ptr<ContiguousCodestreamBox>&& contiguous_codestream_box);
 
 
+  /**
+   * \brief      Removes the contiguous codestream box, returning it
+   *
+   * \return     The contiguous codestream box (nullptr if there was none)
+   */
+  std::unique_ptr<ContiguousCodestreamBox> release_contiguous_codestream_box();
+
+
   ContiguousCodestreamBox& get_ref_to_contiguous_codestream_box();
 
 
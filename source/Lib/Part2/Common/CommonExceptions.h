@@ -155,6 +155,241 @@ class InvalidLightfieldPath : public std::exception {
 }  // namespace LightfieldIOConfigurationExceptions
 
 
+namespace PlanarLightfieldFileExceptions {
+class UnableToOpenFileException : public std::exception {
+ private:
+  std::string message_;
+
+ public:
+  explicit UnableToOpenFileException(const std::string& filename)
+      : message_("Unable to open planar light-field file " + filename) {
+  }
+
+  const char* what() const noexcept override {
+    return message_.c_str();
+  }
+};
+
+
+class InvalidSignatureException : public std::exception {
+ private:
+  std::string message_;
+
+ public:
+  explicit InvalidSignatureException(const std::string& filename)
+      : message_(filename + " is not a planar light-field file") {
+  }
+
+  const char* what() const noexcept override {
+    return message_.c_str();
+  }
+};
+
+
+class UnexpectedEndOfFileException : public std::exception {
+ private:
+  std::string message_;
+
+ public:
+  explicit UnexpectedEndOfFileException(const std::string& filename)
+      : message_("Unexpected end of planar light-field file " + filename) {
+  }
+
+  const char* what() const noexcept override {
+    return message_.c_str();
+  }
+};
+
+
+class InvalidPlaneAlignmentException : public std::exception {
+ public:
+  const char* what() const noexcept override {
+    return "The plane alignment must be a power of two multiple of the sample "
+           "size";
+  }
+};
+
+
+class ViewOutOfBoundsException : public std::exception {
+ public:
+  const char* what() const noexcept override {
+    return "The required view is outside the planar light-field file";
+  }
+};
+
+
+class WrongViewSizeException : public std::exception {
+ private:
+  std::string message_;
+
+ public:
+  WrongViewSizeException(std::size_t image_width, std::size_t image_height,
+      std::size_t view_width, std::size_t view_height)
+      : message_("Wrong view size. Image is " + std::to_string(image_width) +
+                 "x" + std::to_string(image_height) +
+                 " and the views of the planar light-field file are " +
+                 std::to_string(view_width) + "x" +
+                 std::to_string(view_height)) {
+  }
+
+  const char* what() const noexcept override {
+    return message_.c_str();
+  }
+};
+
+
+class UnableToWriteFileException : public std::exception {
+ private:
+  std::string message_;
+
+ public:
+  explicit UnableToWriteFileException(const std::string& filename)
+      : message_("Unable to write planar light-field file " + filename) {
+  }
+
+  const char* what() const noexcept override {
+    return message_.c_str();
+  }
+};
+
+
+class InvalidHeaderException : public std::exception {
+ private:
+  std::string message_;
+
+ public:
+  InvalidHeaderException(const std::string& filename, const std::string& field)
+      : message_("Invalid " + field + " in the header of planar light-field "
+                 "file " + filename) {
+  }
+
+  const char* what() const noexcept override {
+    return message_.c_str();
+  }
+};
+
+
+class InvalidBitsPerSampleException : public std::exception {
+ private:
+  std::string message_;
+
+ public:
+  explicit InvalidBitsPerSampleException(std::size_t bits_per_sample)
+      : message_("Planar light-field files must have from 1 to 16 bits per "
+                 "sample, but " +
+                 std::to_string(bits_per_sample) + " were requested") {
+  }
+
+  const char* what() const noexcept override {
+    return message_.c_str();
+  }
+};
+
+
+class InvalidNumberOfChannelsException : public std::exception {
+ private:
+  std::string message_;
+
+ public:
+  explicit InvalidNumberOfChannelsException(std::size_t number_of_channels)
+      : message_("Planar light-field files must have from 1 to 65535 "
+                 "channels, but " +
+                 std::to_string(number_of_channels) + " were requested") {
+  }
+
+  const char* what() const noexcept override {
+    return message_.c_str();
+  }
+};
+}  // namespace PlanarLightfieldFileExceptions
+
+
+namespace LightfieldMemoryIOExceptions {
+class MissingViewReaderException : public std::exception {
+ public:
+  const char* what() const noexcept override {
+    return "The light field in memory has no view reader (it is write only)";
+  }
+};
+
+
+class MissingViewWriterException : public std::exception {
+ public:
+  const char* what() const noexcept override {
+    return "The light field in memory has no view writer (it is read only)";
+  }
+};
+}  // namespace LightfieldMemoryIOExceptions
+
+
+namespace SyntheticLightfieldExceptions {
+class InvalidBitsPerSampleException : public std::exception {
+ private:
+  std::string message_;
+
+ public:
+  explicit InvalidBitsPerSampleException(std::size_t bits_per_sample)
+      : message_("Synthetic light fields must have from 1 to 16 bits per "
+                 "sample, but " +
+                 std::to_string(bits_per_sample) + " were requested") {
+  }
+
+  const char* what() const noexcept override {
+    return message_.c_str();
+  }
+};
+
+
+class InvalidNumberOfChannelsException : public std::exception {
+ public:
+  const char* what() const noexcept override {
+    return "Synthetic light fields must have at least one channel";
+  }
+};
+
+
+class MissingDisparitiesException : public std::exception {
+ public:
+  const char* what() const noexcept override {
+    return "The content of the synthetic light field requires at least one "
+           "disparity";
+  }
+};
+
+
+class UnknownContentException : public std::exception {
+ private:
+  std::string message_;
+
+ public:
+  explicit UnknownContentException(const std::string& name)
+      : message_("Unknown synthetic light-field content " + name +
+                 " (expected flat, gradient, noise, texture or planes)") {
+  }
+
+  const char* what() const noexcept override {
+    return message_.c_str();
+  }
+};
+
+
+class InvalidDisparitiesException : public std::exception {
+ private:
+  std::string message_;
+
+ public:
+  explicit InvalidDisparitiesException(const std::string& list)
+      : message_("Invalid list of disparities " + list +
+                 " (expected comma separated numbers)") {
+  }
+
+  const char* what() const noexcept override {
+    return message_.c_str();
+  }
+};
+}  // namespace SyntheticLightfieldExceptions
+
+
 namespace ViewToFilenameTranslatorExceptions {
 class Char3OverflowException : public std::exception {
  public:
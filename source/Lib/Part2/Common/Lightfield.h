@@ -41,6 +41,7 @@
 #ifndef JPLM_LIB_PART2_COMMON_LIGHTFIELD_H__
 #define JPLM_LIB_PART2_COMMON_LIGHTFIELD_H__
 
+#include <vector>
 #include "Lib/Part2/Common/LightfieldCoordinate.h"
 #include "Lib/Part2/Common/LightfieldDimension.h"
 #include "Lib/Part2/Common/View.h"
@@ -170,6 +171,41 @@ class Lightfield : public Generic2DStructure<std::unique_ptr<View<T>>> {
   }
 
 
+  /**
+   * @brief      Loads the images of the views at the given coordinates
+   *             concurrently
+   *
+   * @details    The views are loaded using a bounded number of threads and
+   *             then handed to the view i/o policy (see
+   *             ViewIOPolicy::preload_images).
+   *
+   * @param[in]  coordinates        The (t, s) coordinates of the views
+   * @param[in]  number_of_threads  The maximum number of loading threads (0
+   *                                for one per hardware thread)
+   */
+  void preload_views(
+      const std::vector<std::pair<std::size_t, std::size_t>>& coordinates,
+      std::size_t number_of_threads) {
+    std::vector<View<T>*> views;
+    views.reserve(coordinates.size());
+    for (const auto& coordinate : coordinates) {
+      views.push_back(&get_view_at(coordinate));
+    }
+    view_io_policy->preload_images(views, number_of_threads);
+  }
+
+
+  /**
+   * @brief      Loads the images of the views at the given coordinates using
+   *             the number of loading threads set in the view i/o policy
+   */
+  void preload_views(
+      const std::vector<std::pair<std::size_t, std::size_t>>& coordinates) {
+    preload_views(
+        coordinates, view_io_policy->get_number_of_loading_threads());
+  }
+
+
   virtual T get_value_at(const std::size_t channel,
       const LightfieldCoordinate<std::size_t>& coordinate) const {
     auto& view = get_view_at(coordinate.get_t_and_s());
@@ -43,17 +43,34 @@
 
 #include "Lib/Part2/Common/Lightfield.h"
 #include "Lib/Part2/Common/LightfieldIOConfiguration.h"
+#include "Lib/Part2/Common/LightfieldMemoryIO.h"
+#include "Lib/Part2/Common/PlanarLightfieldFile.h"
+#include "Lib/Part2/Common/ViewFromMemory.h"
 #include "Lib/Part2/Common/ViewFromPGXFile.h"
+#include "Lib/Part2/Common/ViewFromPlanarFile.h"
 
 
 /**
  * \brief A class that holds a complete lightfield, where the views are obtained from PPM Files.
- * \details [long description]
+ * \details If the configured path is a planar light-field file (.plf), all
+ * views are read from (or written to) that single file instead. The views
+ * may also be kept in the caller's memory (see LightfieldMemoryIO).
  * 
  * \tparam T Its the type of each pixel in the Lightfield.
  */
 template<typename T>
 class LightfieldFromFile : public Lightfield<T> {
+ protected:
+  void set_views_from_planar_file(
+      const LightfieldIOConfiguration& configuration,
+      const std::shared_ptr<PlanarLightfieldFile>& planar_file) {
+    for (const auto& coordinate : configuration.get_raster_view_coordinates()) {
+      this->set_view_at(
+          std::make_unique<ViewFromPlanarFile<T>>(planar_file, coordinate),
+          coordinate);
+    }
+  }
+
  public:
   /**
    * \brief      Constructs the object.
@@ -70,6 +87,13 @@ class LightfieldFromFile : public Lightfield<T> {
       ViewIOPolicy<T>&& view_io_policy = ViewIOPolicyLimitlessMemory<T>())
       : Lightfield<T>(configuration.get_size().get_t_and_s(),
             std::move(view_io_policy), true) {
+    if (PlanarLightfieldFile::is_planar_lightfield_filename(
+            configuration.get_path())) {
+      auto planar_file =
+          std::make_shared<PlanarLightfieldFile>(configuration.get_path());
+      set_views_from_planar_file(configuration, planar_file);
+      return;
+    }
     //number of channels
     std::size_t number_of_channels =
         configuration
@@ -101,6 +125,17 @@ class LightfieldFromFile : public Lightfield<T> {
       : Lightfield<T>(configuration.get_size().get_t_and_s(),
             std::move(view_io_policy), true) {
     // std::size_t bits_per_sample = 10;
+    if (PlanarLightfieldFile::is_planar_lightfield_filename(
+            configuration.get_path())) {
+      auto planar_file = std::make_shared<PlanarLightfieldFile>(
+          configuration.get_path(), configuration.get_size(),
+          number_of_channels, bits_per_sample);
+      set_views_from_planar_file(configuration, planar_file);
+      this->lightfield_dimension =
+          std::make_unique<LightfieldDimension<std::size_t>>(
+              configuration.get_size());
+      return;
+    }
 
     for (auto i = decltype(number_of_channels){0}; i < number_of_channels;
          ++i) {
@@ -126,6 +161,30 @@ class LightfieldFromFile : public Lightfield<T> {
   }
 
 
+  /**
+   * \brief      Constructs a light field whose views are in memory.
+   *
+   * \param[in]  memory_io       Reads and/or writes the views
+   * \param[in]  view_io_policy  The view i/o policy
+   */
+  LightfieldFromFile(const std::shared_ptr<LightfieldMemoryIO<T>>& memory_io,
+      ViewIOPolicy<T>&& view_io_policy = ViewIOPolicyLimitlessMemory<T>())
+      : Lightfield<T>(memory_io->get_dimension().get_t_and_s(),
+            std::move(view_io_policy), true) {
+    const auto& dimension = memory_io->get_dimension();
+    for (auto t = decltype(dimension.get_t()){0}; t < dimension.get_t(); ++t) {
+      for (auto s = decltype(dimension.get_s()){0}; s < dimension.get_s();
+           ++s) {
+        this->set_view_at(std::make_unique<ViewFromMemory<T>>(
+                              memory_io, std::make_pair(t, s)),
+            {t, s});
+      }
+    }
+    this->lightfield_dimension =
+        std::make_unique<LightfieldDimension<std::size_t>>(dimension);
+  }
+
+
   /**
    * \brief Destructor of the LightfieldFromFile (default)
    */
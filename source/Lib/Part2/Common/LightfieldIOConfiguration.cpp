@@ -39,10 +39,19 @@
  *  \date     2020-02-12
  */
 #include "Lib/Part2/Common/LightfieldIOConfiguration.h"
+#include "Lib/Part2/Common/PlanarLightfieldFile.h"
 
 
 void LightfieldIOConfiguration::check_configurations() {
   namespace fs = std::filesystem;
+  if (PlanarLightfieldFile::is_planar_lightfield_filename(lightfield_path)) {
+    // the file may not exist yet when it is the output of the decoder
+    auto parent = fs::absolute(fs::path(lightfield_path)).parent_path();
+    if (!fs::is_regular_file(lightfield_path) && !fs::is_directory(parent)) {
+      throw LightfieldIOConfigurationExceptions::InvalidLightfieldPath();
+    }
+    return;
+  }
   if (!fs::is_directory(lightfield_path)) {
     throw LightfieldIOConfigurationExceptions::InvalidLightfieldPath();
   }
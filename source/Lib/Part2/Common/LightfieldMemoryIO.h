@@ -0,0 +1,219 @@
+/* The copyright in this software is being made available under the BSD
+ * License, included below. This software may be subject to other third party
+ * and contributor rights, including patent rights, and no such rights are
+ * granted under this license.
+ *
+ * Copyright (c) 2010-2019, ITU/ISO/IEC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *  * Neither the name of the ITU/ISO/IEC nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** \file     LightfieldMemoryIO.h
+ *  \brief    Access to a light field that lives in the caller's memory
+ *  \details  The views are obtained from (and delivered to) callbacks, so
+ *            that the codec can be embedded in an application without
+ *            storing the light field in files. The helpers from_planar_buffer
+ *            and to_planar_buffer create the callbacks for a contiguous
+ *            buffer in which each channel of each view is a plane, stored in
+ *            (t, s, c) order, i.e., the same order used by the planar
+ *            light-field file:
+ *
+ *            samples[(((t * S + s) * NC + c) * V + v) * U + u]
+ *  \date     2026-10-19
+ */
+
+#ifndef JPLM_LIB_PART2_COMMON_LIGHTFIELDMEMORYIO_H__
+#define JPLM_LIB_PART2_COMMON_LIGHTFIELDMEMORYIO_H__
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <utility>
+#include "Lib/Part2/Common/CommonExceptions.h"
+#include "Lib/Part2/Common/LightfieldDimension.h"
+#include "Lib/Utils/Image/Image.h"
+
+
+template<typename T>
+class LightfieldMemoryIO {
+ public:
+  /**
+   * \brief      Fills image (already allocated with the view size and the
+   * number of channels) with the view at position (t, s).
+   */
+  using ViewReader = std::function<void(
+      const std::pair<std::size_t, std::size_t>& position, Image<T>& image)>;
+
+  /**
+   * \brief      Receives the image of the view at position (t, s).
+   */
+  using ViewWriter = std::function<void(
+      const std::pair<std::size_t, std::size_t>& position,
+      const Image<T>& image)>;
+
+ protected:
+  LightfieldDimension<std::size_t> dimension;
+  std::size_t number_of_channels;
+  std::size_t bits_per_sample;
+  ViewReader view_reader;
+  ViewWriter view_writer;
+
+  static std::size_t get_first_plane_index(
+      const std::pair<std::size_t, std::size_t>& position,
+      std::size_t number_of_views_in_s,
+      std::size_t number_of_channels) noexcept {
+    const auto& [t, s] = position;
+    return (t * number_of_views_in_s + s) * number_of_channels;
+  }
+
+ public:
+  /**
+   * \brief      Constructs a new instance.
+   *
+   * \param[in]  dimension           The light field dimension (t, s, v, u)
+   * \param[in]  number_of_channels  The number of channels of each view
+   * \param[in]  bits_per_sample     The bits per sample
+   * \param[in]  view_reader         Provides the views (encoder side); may be
+   *                                 empty for a write-only light field
+   * \param[in]  view_writer         Receives the views (decoder side); may be
+   *                                 empty for a read-only light field
+   */
+  LightfieldMemoryIO(const LightfieldDimension<std::size_t>& dimension,
+      std::size_t number_of_channels, std::size_t bits_per_sample,
+      ViewReader view_reader, ViewWriter view_writer = nullptr)
+      : dimension(dimension), number_of_channels(number_of_channels),
+        bits_per_sample(bits_per_sample), view_reader(std::move(view_reader)),
+        view_writer(std::move(view_writer)) {
+  }
+
+
+  virtual ~LightfieldMemoryIO() = default;
+
+
+  /**
+   * \brief      Creates a read-only light field over a planar buffer.
+   *
+   * \details    The buffer is not copied and must outlive the returned object.
+   */
+  static std::shared_ptr<LightfieldMemoryIO<T>> from_planar_buffer(
+      const T* samples, const LightfieldDimension<std::size_t>& dimension,
+      std::size_t number_of_channels, std::size_t bits_per_sample) {
+    const auto samples_per_plane = dimension.get_number_of_pixels_per_view();
+    const auto views_in_s = dimension.get_s();
+    auto reader = [samples, samples_per_plane, views_in_s, number_of_channels](
+                      const auto& position, Image<T>& image) {
+      const auto* plane = samples + get_first_plane_index(position,
+                                        views_in_s, number_of_channels) *
+                                        samples_per_plane;
+      for (auto c = decltype(number_of_channels){0}; c < number_of_channels;
+           ++c, plane += samples_per_plane) {
+        std::copy(
+            plane, plane + samples_per_plane, image.get_channel(c).data());
+      }
+    };
+    return std::make_shared<LightfieldMemoryIO<T>>(
+        dimension, number_of_channels, bits_per_sample, reader);
+  }
+
+
+  /**
+   * \brief      Creates a write-only light field over a planar buffer, which
+   * must be large enough to hold all views (see get_number_of_samples).
+   */
+  static std::shared_ptr<LightfieldMemoryIO<T>> to_planar_buffer(
+      T* samples, const LightfieldDimension<std::size_t>& dimension,
+      std::size_t number_of_channels, std::size_t bits_per_sample) {
+    const auto samples_per_plane = dimension.get_number_of_pixels_per_view();
+    const auto views_in_s = dimension.get_s();
+    auto writer = [samples, samples_per_plane, views_in_s, number_of_channels](
+                      const auto& position, const Image<T>& image) {
+      auto* plane = samples + get_first_plane_index(position, views_in_s,
+                                  number_of_channels) *
+                                  samples_per_plane;
+      for (auto c = decltype(number_of_channels){0}; c < number_of_channels;
+           ++c, plane += samples_per_plane) {
+        const auto* channel_samples = image.get_channel(c).data();
+        std::copy(channel_samples, channel_samples + samples_per_plane, plane);
+      }
+    };
+    return std::make_shared<LightfieldMemoryIO<T>>(
+        dimension, number_of_channels, bits_per_sample, nullptr, writer);
+  }
+
+
+  const LightfieldDimension<std::size_t>& get_dimension() const noexcept {
+    return dimension;
+  }
+
+
+  std::size_t get_number_of_channels() const noexcept {
+    return number_of_channels;
+  }
+
+
+  std::size_t get_bits_per_sample() const noexcept {
+    return bits_per_sample;
+  }
+
+
+  /**
+   * \brief      Gets the number of samples of the whole light field.
+   */
+  std::size_t get_number_of_samples() const noexcept {
+    return dimension.get_number_of_views_per_lightfield() *
+           number_of_channels * dimension.get_number_of_pixels_per_view();
+  }
+
+
+  bool has_view_reader() const noexcept {
+    return static_cast<bool>(view_reader);
+  }
+
+
+  bool has_view_writer() const noexcept {
+    return static_cast<bool>(view_writer);
+  }
+
+
+  void read_view(const std::pair<std::size_t, std::size_t>& position,
+      Image<T>& image) const {
+    if (!view_reader) {
+      throw LightfieldMemoryIOExceptions::MissingViewReaderException();
+    }
+    view_reader(position, image);
+  }
+
+
+  void write_view(const std::pair<std::size_t, std::size_t>& position,
+      const Image<T>& image) const {
+    if (!view_writer) {
+      throw LightfieldMemoryIOExceptions::MissingViewWriterException();
+    }
+    view_writer(position, image);
+  }
+};
+
+#endif /* end of include guard: JPLM_LIB_PART2_COMMON_LIGHTFIELDMEMORYIO_H__ */
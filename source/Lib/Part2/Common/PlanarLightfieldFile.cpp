@@ -0,0 +1,232 @@
+/* The copyright in this software is being made available under the BSD
+ * License, included below. This software may be subject to other third party
+ * and contributor rights, including patent rights, and no such rights are
+ * granted under this license.
+ *
+ * Copyright (c) 2010-2019, ITU/ISO/IEC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *  * Neither the name of the ITU/ISO/IEC nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** \file     PlanarLightfieldFile.cpp
+ *  \brief    Planar light-field container file
+ *  \details  See PlanarLightfieldFile.h for the layout of the file
+ *  \date     2026-10-19
+ */
+
+#include "Lib/Part2/Common/PlanarLightfieldFile.h"
+#include <limits>
+
+
+namespace {
+std::size_t align_up(std::size_t value, std::size_t alignment) noexcept {
+  return ((value + alignment - 1) / alignment) * alignment;
+}
+}  // namespace
+
+
+PlanarLightfieldFile::PlanarLightfieldFile(const std::string& filename)
+    : filename(filename), dimension(1, 1, 1, 1) {
+  read_header();
+}
+
+
+PlanarLightfieldFile::PlanarLightfieldFile(const std::string& filename,
+    const LightfieldDimension<std::size_t>& dimension,
+    std::size_t number_of_channels, std::size_t bits_per_sample,
+    std::size_t plane_alignment)
+    : filename(filename), dimension(dimension),
+      number_of_channels(number_of_channels), bits_per_sample(bits_per_sample),
+      endianess(BinaryTools::using_little_endian()
+                    ? PlanarLightfieldEndianess::PLF_LITTLE_ENDIAN
+                    : PlanarLightfieldEndianess::PLF_BIG_ENDIAN),
+      plane_alignment(plane_alignment) {
+  //they are stored in 8 and 16 bits in the header
+  if ((bits_per_sample == 0) || (bits_per_sample > 8 * bytes_per_sample)) {
+    throw PlanarLightfieldFileExceptions::InvalidBitsPerSampleException(
+        bits_per_sample);
+  }
+  if ((number_of_channels == 0) ||
+      (number_of_channels > std::numeric_limits<uint16_t>::max())) {
+    throw PlanarLightfieldFileExceptions::InvalidNumberOfChannelsException(
+        number_of_channels);
+  }
+  if ((plane_alignment < bytes_per_sample) ||
+      ((plane_alignment & (plane_alignment - 1)) != 0)) {
+    throw PlanarLightfieldFileExceptions::InvalidPlaneAlignmentException();
+  }
+  write_header();
+}
+
+
+void PlanarLightfieldFile::read_header() {
+  std::ifstream file(filename, std::ios::in | std::ios::binary);
+  if (!file.is_open()) {
+    throw PlanarLightfieldFileExceptions::UnableToOpenFileException(filename);
+  }
+  std::vector<std::byte> bytes(header_size);
+  file.read(reinterpret_cast<char*>(bytes.data()), header_size);
+  if (!file) {
+    throw PlanarLightfieldFileExceptions::UnexpectedEndOfFileException(
+        filename);
+  }
+  if (!std::equal(signature, signature + 8,
+          reinterpret_cast<const char*>(bytes.data()))) {
+    throw PlanarLightfieldFileExceptions::InvalidSignatureException(filename);
+  }
+  auto [t, s, v, u, channels, bps, endianess_byte, alignment] =
+      BinaryTools::get_tuple_from_big_endian_byte_vector<uint32_t, uint32_t,
+          uint32_t, uint32_t, uint16_t, uint8_t, uint8_t, uint32_t>(
+          bytes, 8);
+  dimension = LightfieldDimension<std::size_t>(t, s, v, u);
+  number_of_channels = channels;
+  bits_per_sample = bps;
+  if ((endianess_byte !=
+          static_cast<uint8_t>(PlanarLightfieldEndianess::PLF_BIG_ENDIAN)) &&
+      (endianess_byte !=
+          static_cast<uint8_t>(PlanarLightfieldEndianess::PLF_LITTLE_ENDIAN))) {
+    throw PlanarLightfieldFileExceptions::InvalidHeaderException(
+        filename, "endianess");
+  }
+  //the samples are stored in 16 bits
+  if ((bps == 0) || (bps > 8 * bytes_per_sample)) {
+    throw PlanarLightfieldFileExceptions::InvalidHeaderException(
+        filename, "number of bits per sample");
+  }
+  endianess = static_cast<PlanarLightfieldEndianess>(endianess_byte);
+  plane_alignment = alignment;
+  if ((plane_alignment < bytes_per_sample) ||
+      ((plane_alignment & (plane_alignment - 1)) != 0)) {
+    throw PlanarLightfieldFileExceptions::InvalidPlaneAlignmentException();
+  }
+}
+
+
+void PlanarLightfieldFile::write_header() const {
+  std::vector<std::byte> bytes;
+  bytes.reserve(header_size);
+  for (auto i = 0; i < 8; ++i) {
+    bytes.push_back(static_cast<std::byte>(signature[i]));
+  }
+  BinaryTools::append_big_endian_bytes(
+      bytes, std::make_tuple(static_cast<uint32_t>(dimension.get_t()),
+                 static_cast<uint32_t>(dimension.get_s()),
+                 static_cast<uint32_t>(dimension.get_v()),
+                 static_cast<uint32_t>(dimension.get_u()),
+                 static_cast<uint16_t>(number_of_channels),
+                 static_cast<uint8_t>(bits_per_sample),
+                 static_cast<uint8_t>(endianess),
+                 static_cast<uint32_t>(plane_alignment)));
+
+  std::ofstream file(
+      filename, std::ios::out | std::ios::binary | std::ios::trunc);
+  if (!file.is_open()) {
+    throw PlanarLightfieldFileExceptions::UnableToOpenFileException(filename);
+  }
+  file.write(reinterpret_cast<const char*>(bytes.data()), bytes.size());
+  file.close();
+  if (file.fail()) {
+    throw PlanarLightfieldFileExceptions::UnableToWriteFileException(filename);
+  }
+  std::filesystem::resize_file(filename, get_file_size());
+}
+
+
+bool PlanarLightfieldFile::is_different_endianess() const noexcept {
+  return BinaryTools::using_little_endian() !=
+         (endianess == PlanarLightfieldEndianess::PLF_LITTLE_ENDIAN);
+}
+
+
+void PlanarLightfieldFile::check_view_position(
+    std::size_t t, std::size_t s) const {
+  if ((t >= dimension.get_t()) || (s >= dimension.get_s())) {
+    throw PlanarLightfieldFileExceptions::ViewOutOfBoundsException();
+  }
+}
+
+
+bool PlanarLightfieldFile::is_planar_lightfield_filename(
+    const std::string& filename) {
+  return std::filesystem::path(filename).extension() == extension;
+}
+
+
+const std::string& PlanarLightfieldFile::get_filename() const noexcept {
+  return filename;
+}
+
+
+const LightfieldDimension<std::size_t>& PlanarLightfieldFile::get_dimension()
+    const noexcept {
+  return dimension;
+}
+
+
+std::size_t PlanarLightfieldFile::get_number_of_channels() const noexcept {
+  return number_of_channels;
+}
+
+
+std::size_t PlanarLightfieldFile::get_bits_per_sample() const noexcept {
+  return bits_per_sample;
+}
+
+
+std::size_t PlanarLightfieldFile::get_plane_alignment() const noexcept {
+  return plane_alignment;
+}
+
+
+std::size_t PlanarLightfieldFile::get_plane_size_in_bytes() const noexcept {
+  return dimension.get_number_of_pixels_per_view() * bytes_per_sample;
+}
+
+
+std::size_t PlanarLightfieldFile::get_plane_stride() const noexcept {
+  return align_up(get_plane_size_in_bytes(), plane_alignment);
+}
+
+
+std::size_t PlanarLightfieldFile::get_data_offset() const noexcept {
+  return align_up(header_size, plane_alignment);
+}
+
+
+std::size_t PlanarLightfieldFile::get_file_size() const noexcept {
+  return get_data_offset() +
+         dimension.get_number_of_views_per_lightfield() * number_of_channels *
+             get_plane_stride();
+}
+
+
+std::size_t PlanarLightfieldFile::get_plane_offset(
+    std::size_t t, std::size_t s, std::size_t c) const {
+  check_view_position(t, s);
+  const auto plane_index =
+      (t * dimension.get_s() + s) * number_of_channels + c;
+  return get_data_offset() + plane_index * get_plane_stride();
+}
@@ -0,0 +1,261 @@
+/* The copyright in this software is being made available under the BSD
+ * License, included below. This software may be subject to other third party
+ * and contributor rights, including patent rights, and no such rights are
+ * granted under this license.
+ *
+ * Copyright (c) 2010-2019, ITU/ISO/IEC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *  * Neither the name of the ITU/ISO/IEC nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** \file     PlanarLightfieldFile.h
+ *  \brief    Planar light-field container file
+ *  \details  Stores a complete light field in a single file as a sequence of
+ *            raw planes, one per view and channel, in (t, s, c) order. Each
+ *            plane starts at an offset aligned to plane_alignment bytes, so
+ *            that a view channel can be read with a single bulk read (or
+ *            mapped directly) without any parsing or deinterleaving.
+ *
+ *            Header (32 bytes, big endian):
+ *            signature (8) | T (4) | S (4) | V (4) | U (4) |
+ *            number of channels (2) | bits per sample (1) |
+ *            sample endianess (1) | plane alignment (4)
+ *
+ *            Samples are stored as 16 bit unsigned integers in the byte order
+ *            given in the header.
+ *  \date     2026-10-19
+ */
+
+#ifndef JPLM_LIB_PART2_COMMON_PLANARLIGHTFIELDFILE_H__
+#define JPLM_LIB_PART2_COMMON_PLANARLIGHTFIELDFILE_H__
+
+#include <algorithm>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <type_traits>
+#include <vector>
+#include "Lib/Part2/Common/CommonExceptions.h"
+#include "Lib/Part2/Common/LightfieldDimension.h"
+#include "Lib/Utils/Image/Image.h"
+#include "Lib/Utils/Image/RasterTools.h"
+#include "Lib/Utils/Stream/BinaryTools.h"
+
+
+enum class PlanarLightfieldEndianess {
+  PLF_BIG_ENDIAN = 0,
+  PLF_LITTLE_ENDIAN = 1
+};
+
+
+class PlanarLightfieldFile {
+ protected:
+  const std::string filename;
+  LightfieldDimension<std::size_t> dimension;
+  std::size_t number_of_channels;
+  std::size_t bits_per_sample;
+  PlanarLightfieldEndianess endianess;
+  std::size_t plane_alignment;
+
+  void read_header();
+  void write_header() const;
+  bool is_different_endianess() const noexcept;
+  void check_view_position(std::size_t t, std::size_t s) const;
+
+
+  /**
+   * \brief      Throws if image does not have the channels of a view or if
+   *             any of its channels does not have the size of a view
+   */
+  template<typename T>
+  void check_view_image(const Image<T>& image) const {
+    if (image.get_number_of_channels() != number_of_channels) {
+      throw ViewExceptions::WrongNumberOfChannelsException(
+          image.get_number_of_channels(), number_of_channels);
+    }
+    for (auto c = decltype(number_of_channels){0}; c < number_of_channels;
+         ++c) {
+      const auto& channel = image.get_channel(c);
+      if ((channel.get_width() != dimension.get_u()) ||
+          (channel.get_height() != dimension.get_v())) {
+        throw PlanarLightfieldFileExceptions::WrongViewSizeException(
+            channel.get_width(), channel.get_height(), dimension.get_u(),
+            dimension.get_v());
+      }
+    }
+  }
+
+ public:
+  static constexpr std::size_t header_size = 32;
+  static constexpr std::size_t default_plane_alignment = 4096;
+  static constexpr std::size_t bytes_per_sample = sizeof(uint16_t);
+  static constexpr char signature[9] = "JPLMPLF1";
+  static constexpr char extension[5] = ".plf";
+
+  /**
+   * \brief      Opens an existing planar light-field file (encoder side)
+   *
+   * \param[in]  filename  The filename
+   */
+  explicit PlanarLightfieldFile(const std::string& filename);
+
+
+  /**
+   * \brief      Creates a new planar light-field file (decoder side)
+   *
+   * \details    The header is written and the file is resized to hold all
+   *             planes, which are then filled view by view using write_view.
+   */
+  PlanarLightfieldFile(const std::string& filename,
+      const LightfieldDimension<std::size_t>& dimension,
+      std::size_t number_of_channels, std::size_t bits_per_sample,
+      std::size_t plane_alignment = default_plane_alignment);
+
+
+  ~PlanarLightfieldFile() = default;
+
+
+  static bool is_planar_lightfield_filename(const std::string& filename);
+
+
+  const std::string& get_filename() const noexcept;
+  const LightfieldDimension<std::size_t>& get_dimension() const noexcept;
+  std::size_t get_number_of_channels() const noexcept;
+  std::size_t get_bits_per_sample() const noexcept;
+  std::size_t get_plane_alignment() const noexcept;
+  std::size_t get_plane_size_in_bytes() const noexcept;
+  std::size_t get_plane_stride() const noexcept;
+  std::size_t get_data_offset() const noexcept;
+  std::size_t get_file_size() const noexcept;
+
+
+  /**
+   * \brief      Gets the offset (in bytes) of the plane of channel c of view
+   *             (t, s)
+   */
+  std::size_t get_plane_offset(
+      std::size_t t, std::size_t s, std::size_t c) const;
+
+
+  /**
+   * \brief      Reads all channels of view (t, s) into image
+   *
+   * \details    Each channel is read with a single read directly into the
+   *             channel storage. Every call uses its own stream, so different
+   *             views may be read concurrently.
+   */
+  template<typename T>
+  void read_view(std::size_t t, std::size_t s, Image<T>& image) const {
+    check_view_position(t, s);
+    check_view_image(image);
+    const auto samples_per_plane =
+        dimension.get_v() * dimension.get_u();
+    std::ifstream file(filename, std::ios::in | std::ios::binary);
+    std::vector<uint16_t> buffer;
+    if constexpr (!std::is_same_v<T, uint16_t>) {
+      buffer.resize(samples_per_plane);
+    }
+    for (auto c = decltype(number_of_channels){0}; c < number_of_channels;
+         ++c) {
+      auto& channel = image.get_channel(c);
+      uint16_t* samples;
+      if constexpr (std::is_same_v<T, uint16_t>) {
+        samples = channel.data();
+      } else {
+        samples = buffer.data();
+      }
+      file.seekg(get_plane_offset(t, s, c));
+      file.read(reinterpret_cast<char*>(samples),
+          samples_per_plane * bytes_per_sample);
+      if (!file) {
+        throw PlanarLightfieldFileExceptions::UnexpectedEndOfFileException(
+            filename);
+      }
+      if (is_different_endianess()) {
+        RasterTools::swap_endianess(samples, samples_per_plane);
+      }
+      if constexpr (!std::is_same_v<T, uint16_t>) {
+        std::copy(buffer.begin(), buffer.end(), channel.data());
+      }
+    }
+  }
+
+
+  /**
+   * \brief      Writes all channels of image as the planes of view (t, s)
+   *
+   * \throws     UnableToWriteFileException if the planes were not written
+   */
+  template<typename T>
+  void write_view(std::size_t t, std::size_t s, const Image<T>& image) const {
+    check_view_position(t, s);
+    check_view_image(image);
+    const auto samples_per_plane =
+        dimension.get_v() * dimension.get_u();
+    std::fstream file(
+        filename, std::ios::in | std::ios::out | std::ios::binary);
+    if (!file.is_open()) {
+      throw PlanarLightfieldFileExceptions::UnableToOpenFileException(
+          filename);
+    }
+    std::vector<uint16_t> buffer;
+    if (!std::is_same_v<T, uint16_t> || is_different_endianess()) {
+      buffer.resize(samples_per_plane);
+    }
+    for (auto c = decltype(number_of_channels){0}; c < number_of_channels;
+         ++c) {
+      const auto* channel_samples = image.get_channel(c).data();
+      const uint16_t* samples;
+      if (buffer.empty()) {
+        samples = reinterpret_cast<const uint16_t*>(channel_samples);
+      } else {
+        for (auto i = decltype(samples_per_plane){0}; i < samples_per_plane;
+             ++i) {
+          auto sample = static_cast<uint16_t>(channel_samples[i]);
+          buffer[i] = is_different_endianess()
+                          ? RasterTools::byte_swap(sample)
+                          : sample;
+        }
+        samples = buffer.data();
+      }
+      file.seekp(get_plane_offset(t, s, c));
+      file.write(reinterpret_cast<const char*>(samples),
+          samples_per_plane * bytes_per_sample);
+      if (!file) {
+        throw PlanarLightfieldFileExceptions::UnableToWriteFileException(
+            filename);
+      }
+    }
+    file.close();
+    if (!file) {
+      throw PlanarLightfieldFileExceptions::UnableToWriteFileException(
+          filename);
+    }
+  }
+};
+
+#endif /* end of include guard: JPLM_LIB_PART2_COMMON_PLANARLIGHTFIELDFILE_H__ */
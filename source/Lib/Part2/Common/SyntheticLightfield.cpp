@@ -0,0 +1,341 @@
+/* The copyright in this software is being made available under the BSD
+ * License, included below. This software may be subject to other third party
+ * and contributor rights, including patent rights, and no such rights are
+ * granted under this license.
+ *
+ * Copyright (c) 2010-2019, ITU/ISO/IEC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *  * Neither the name of the ITU/ISO/IEC nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** \file     SyntheticLightfield.cpp
+ *  \brief    Generator of synthetic light fields with controllable content
+ *  \details  
+ *  \date     2026-10-19
+ */
+
+#include "Lib/Part2/Common/SyntheticLightfield.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <sstream>
+
+
+namespace {
+
+//salts that decorrelate the different uses of the hash
+constexpr uint64_t noise_salt = 1;
+constexpr uint64_t value_noise_salt = 2;
+constexpr uint64_t plane_salt = 3;
+constexpr uint64_t channel_salt = 4;
+
+constexpr double value_noise_cell_size = 8.0;
+
+
+uint64_t mix(uint64_t value) {
+  //splitmix64 finalizer
+  value += 0x9e3779b97f4a7c15;
+  value = (value ^ (value >> 30)) * 0xbf58476d1ce4e5b9;
+  value = (value ^ (value >> 27)) * 0x94d049bb133111eb;
+  return value ^ (value >> 31);
+}
+
+
+double get_smooth_weight(double weight) {
+  return weight * weight * (3.0 - 2.0 * weight);
+}
+
+}  // namespace
+
+
+SyntheticLightfield::SyntheticLightfield(
+    const SyntheticLightfieldParameters& parameters)
+    : parameters(parameters) {
+  if ((parameters.bits_per_sample == 0) || (parameters.bits_per_sample > 16)) {
+    throw SyntheticLightfieldExceptions::InvalidBitsPerSampleException(
+        parameters.bits_per_sample);
+  }
+  if (parameters.number_of_channels == 0) {
+    throw SyntheticLightfieldExceptions::InvalidNumberOfChannelsException();
+  }
+  if (((parameters.content == SyntheticLightfieldContent::texture) ||
+          (parameters.content == SyntheticLightfieldContent::planes)) &&
+      parameters.disparities.empty()) {
+    throw SyntheticLightfieldExceptions::MissingDisparitiesException();
+  }
+  maximum_value =
+      static_cast<double>((uint32_t(1) << parameters.bits_per_sample) - 1);
+  central_t = (static_cast<double>(parameters.dimension.get_t()) - 1.0) / 2.0;
+  central_s = (static_cast<double>(parameters.dimension.get_s()) - 1.0) / 2.0;
+  create_planes();
+}
+
+
+uint64_t SyntheticLightfield::get_hash(
+    uint64_t a, uint64_t b, uint64_t c, uint64_t d) const {
+  return mix(mix(mix(mix(parameters.seed ^ a) ^ b) ^ c) ^ d);
+}
+
+
+double SyntheticLightfield::get_uniform(
+    uint64_t a, uint64_t b, uint64_t c, uint64_t d) const {
+  //the 53 most significant bits give a double in [0, 1)
+  return static_cast<double>(get_hash(a, b, c, d) >> 11) /
+         static_cast<double>(uint64_t(1) << 53);
+}
+
+
+double SyntheticLightfield::get_value_noise(
+    double v, double u, std::size_t plane_index) const {
+  const auto y = v / value_noise_cell_size;
+  const auto x = u / value_noise_cell_size;
+  const auto cell_v = std::floor(y);
+  const auto cell_u = std::floor(x);
+  const auto weight_v = get_smooth_weight(y - cell_v);
+  const auto weight_u = get_smooth_weight(x - cell_u);
+  const auto corner = [this, plane_index](double corner_v, double corner_u) {
+    return get_uniform(value_noise_salt, plane_index,
+        static_cast<uint64_t>(static_cast<int64_t>(corner_v)),
+        static_cast<uint64_t>(static_cast<int64_t>(corner_u)));
+  };
+  const auto top = corner(cell_v, cell_u) +
+                   weight_u * (corner(cell_v, cell_u + 1.0) -
+                                  corner(cell_v, cell_u));
+  const auto bottom = corner(cell_v + 1.0, cell_u) +
+                      weight_u * (corner(cell_v + 1.0, cell_u + 1.0) -
+                                     corner(cell_v + 1.0, cell_u));
+  return top + weight_v * (bottom - top);
+}
+
+
+void SyntheticLightfield::create_planes() {
+  const auto height = static_cast<double>(parameters.dimension.get_v());
+  const auto width = static_cast<double>(parameters.dimension.get_u());
+  const auto number_of_planes =
+      parameters.content == SyntheticLightfieldContent::planes
+          ? parameters.disparities.size()
+          : std::min(parameters.disparities.size(), std::size_t(1));
+  for (auto i = std::size_t(0); i < number_of_planes; ++i) {
+    auto plane = Plane();
+    plane.disparity = parameters.disparities.at(i);
+    plane.is_textured = (i % 2) == 0;
+    if (i == 0) {
+      plane.first_v = -std::numeric_limits<double>::infinity();
+      plane.first_u = -std::numeric_limits<double>::infinity();
+      plane.last_v = std::numeric_limits<double>::infinity();
+      plane.last_u = std::numeric_limits<double>::infinity();
+    } else {
+      //from 25% to 45% of the view, centred in the middle half of the view
+      const auto get_fraction = [this, i](uint64_t index, double minimum,
+                                    double range) {
+        return minimum + range * get_uniform(plane_salt, i, 0, index);
+      };
+      const auto size_v = height * get_fraction(0, 0.25, 0.2);
+      const auto size_u = width * get_fraction(1, 0.25, 0.2);
+      const auto centre_v = height * get_fraction(2, 0.25, 0.5);
+      const auto centre_u = width * get_fraction(3, 0.25, 0.5);
+      plane.first_v = centre_v - size_v / 2.0;
+      plane.first_u = centre_u - size_u / 2.0;
+      plane.last_v = centre_v + size_v / 2.0;
+      plane.last_u = centre_u + size_u / 2.0;
+    }
+    plane.frequency_v = 0.05 + 0.25 * get_uniform(plane_salt, i, 1, 0);
+    plane.frequency_u = 0.05 + 0.25 * get_uniform(plane_salt, i, 1, 1);
+    plane.phase = 6.283185307179586 * get_uniform(plane_salt, i, 1, 2);
+    for (auto c = std::size_t(0); c < parameters.number_of_channels; ++c) {
+      plane.channel_gains.push_back(
+          0.6 + 0.4 * get_uniform(channel_salt, i, c, 0));
+    }
+    planes.push_back(std::move(plane));
+  }
+}
+
+
+double SyntheticLightfield::get_plane_value(const Plane& plane,
+    std::size_t plane_index, std::size_t channel, double v, double u) const {
+  auto value = 0.0;
+  if (plane.is_textured) {
+    const auto waves = 0.5 + 0.5 * std::sin(plane.frequency_v * v +
+                                            plane.phase) *
+                                 std::sin(plane.frequency_u * u + plane.phase);
+    value = 0.15 + 0.35 * waves + 0.35 * get_value_noise(v, u, plane_index);
+  } else {
+    value = 0.2 + 0.6 * get_uniform(plane_salt, plane_index, 2, 0);
+  }
+  return value * plane.channel_gains.at(channel);
+}
+
+
+double SyntheticLightfield::get_content_value(std::size_t t, std::size_t s,
+    std::size_t channel, std::size_t v, std::size_t u) const {
+  switch (parameters.content) {
+    case SyntheticLightfieldContent::flat: {
+      return 0.25 + 0.5 * get_uniform(channel_salt, channel, 1, 0);
+    }
+    case SyntheticLightfieldContent::gradient: {
+      //the direction of the ramp changes with the channel
+      const auto weight = get_uniform(channel_salt, channel, 2, 0);
+      const auto ramp_v = (static_cast<double>(v) + 0.5) /
+                          static_cast<double>(parameters.dimension.get_v());
+      const auto ramp_u = (static_cast<double>(u) + 0.5) /
+                          static_cast<double>(parameters.dimension.get_u());
+      return 0.1 + 0.8 * (weight * ramp_v + (1.0 - weight) * ramp_u);
+    }
+    case SyntheticLightfieldContent::noise: {
+      return get_uniform(
+          noise_salt, t * parameters.dimension.get_s() + s, channel,
+          v * parameters.dimension.get_u() + u);
+    }
+    case SyntheticLightfieldContent::texture:
+    case SyntheticLightfieldContent::planes: {
+      const auto offset_t = static_cast<double>(t) - central_t;
+      const auto offset_s = static_cast<double>(s) - central_s;
+      //the front-most plane that covers the sample is the visible one
+      for (auto i = planes.size(); i > 0; --i) {
+        const auto& plane = planes[i - 1];
+        const auto plane_v =
+            static_cast<double>(v) + plane.disparity * offset_t;
+        const auto plane_u =
+            static_cast<double>(u) + plane.disparity * offset_s;
+        if ((plane_v >= plane.first_v) && (plane_v < plane.last_v) &&
+            (plane_u >= plane.first_u) && (plane_u < plane.last_u)) {
+          return get_plane_value(plane, i - 1, channel, plane_v, plane_u);
+        }
+      }
+      return 0.0;
+    }
+  }
+  return 0.0;
+}
+
+
+uint16_t SyntheticLightfield::get_sample(std::size_t t, std::size_t s,
+    std::size_t channel, std::size_t v, std::size_t u) const {
+  auto value = get_content_value(t, s, channel, v, u);
+  if ((parameters.content != SyntheticLightfieldContent::noise) &&
+      (parameters.noise_amplitude > 0.0)) {
+    value += parameters.noise_amplitude *
+             (2.0 * get_uniform(noise_salt,
+                        t * parameters.dimension.get_s() + s, channel,
+                        v * parameters.dimension.get_u() + u) -
+                 1.0);
+  }
+  return static_cast<uint16_t>(
+      std::round(std::clamp(value, 0.0, 1.0) * maximum_value));
+}
+
+
+void SyntheticLightfield::fill_view(
+    const std::pair<std::size_t, std::size_t>& position,
+    Image<uint16_t>& image) const {
+  const auto& [t, s] = position;
+  const auto width = image.get_width();
+  const auto number_of_channels =
+      std::min(image.get_number_of_channels(), parameters.number_of_channels);
+  for (auto c = std::size_t(0); c < number_of_channels; ++c) {
+    auto sample = image.get_channel(c).begin();
+    for (auto v = std::size_t(0); v < image.get_height(); ++v) {
+      for (auto u = std::size_t(0); u < width; ++u) {
+        *sample = get_sample(t, s, c, v, u);
+        ++sample;
+      }
+    }
+  }
+}
+
+
+std::vector<uint16_t> SyntheticLightfield::get_planar_samples() const {
+  const auto& dimension = parameters.dimension;
+  auto samples = std::vector<uint16_t>();
+  samples.reserve(dimension.get_number_of_views_per_lightfield() *
+                  parameters.number_of_channels *
+                  dimension.get_number_of_pixels_per_view());
+  for (auto t = std::size_t(0); t < dimension.get_t(); ++t) {
+    for (auto s = std::size_t(0); s < dimension.get_s(); ++s) {
+      for (auto c = std::size_t(0); c < parameters.number_of_channels; ++c) {
+        for (auto v = std::size_t(0); v < dimension.get_v(); ++v) {
+          for (auto u = std::size_t(0); u < dimension.get_u(); ++u) {
+            samples.push_back(get_sample(t, s, c, v, u));
+          }
+        }
+      }
+    }
+  }
+  return samples;
+}
+
+
+std::shared_ptr<LightfieldMemoryIO<uint16_t>>
+SyntheticLightfield::get_memory_io() const {
+  auto generator = std::make_shared<SyntheticLightfield>(*this);
+  return std::make_shared<LightfieldMemoryIO<uint16_t>>(parameters.dimension,
+      parameters.number_of_channels, parameters.bits_per_sample,
+      [generator](const auto& position, Image<uint16_t>& image) {
+        generator->fill_view(position, image);
+      });
+}
+
+
+SyntheticLightfieldContent get_synthetic_lightfield_content(
+    const std::string& name) {
+  if (name == "flat") {
+    return SyntheticLightfieldContent::flat;
+  }
+  if (name == "gradient") {
+    return SyntheticLightfieldContent::gradient;
+  }
+  if (name == "noise") {
+    return SyntheticLightfieldContent::noise;
+  }
+  if (name == "texture") {
+    return SyntheticLightfieldContent::texture;
+  }
+  if (name == "planes") {
+    return SyntheticLightfieldContent::planes;
+  }
+  throw SyntheticLightfieldExceptions::UnknownContentException(name);
+}
+
+
+std::vector<double> get_synthetic_lightfield_disparities(
+    const std::string& list) {
+  auto disparities = std::vector<double>();
+  auto stream = std::istringstream(list);
+  auto item = std::string();
+  while (std::getline(stream, item, ',')) {
+    try {
+      auto number_of_characters = std::size_t(0);
+      disparities.push_back(std::stod(item, &number_of_characters));
+      if (item.find_first_not_of(' ', number_of_characters) !=
+          std::string::npos) {
+        throw SyntheticLightfieldExceptions::InvalidDisparitiesException(list);
+      }
+    } catch (const std::logic_error&) {
+      throw SyntheticLightfieldExceptions::InvalidDisparitiesException(list);
+    }
+  }
+  return disparities;
+}
@@ -0,0 +1,174 @@
+/* The copyright in this software is being made available under the BSD
+ * License, included below. This software may be subject to other third party
+ * and contributor rights, including patent rights, and no such rights are
+ * granted under this license.
+ *
+ * Copyright (c) 2010-2019, ITU/ISO/IEC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *  * Neither the name of the ITU/ISO/IEC nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** \file     SyntheticLightfield.h
+ *  \brief    Generator of synthetic light fields with controllable content
+ *  \details  Each sample is a pure function of its position (t, s, c, v, u)
+ *            and of the seed, so that views can be generated in any order
+ *            (or in parallel) and the same parameters always give the same
+ *            light field.
+ *
+ *            The planes content mimics the parallax of a real light field:
+ *            a scene made of fronto-parallel planes, each with a disparity
+ *            (in pixels per view, relative to the central view). The first
+ *            plane is the background and covers all views; every other
+ *            plane is a rectangle in front of the previous ones. Planes
+ *            alternate between textured and flat regions.
+ *  \date     2026-10-19
+ */
+
+#ifndef JPLM_LIB_PART2_COMMON_SYNTHETICLIGHTFIELD_H__
+#define JPLM_LIB_PART2_COMMON_SYNTHETICLIGHTFIELD_H__
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+#include "Lib/Part2/Common/CommonExceptions.h"
+#include "Lib/Part2/Common/LightfieldDimension.h"
+#include "Lib/Part2/Common/LightfieldMemoryIO.h"
+#include "Lib/Utils/Image/Image.h"
+
+
+enum class SyntheticLightfieldContent {
+  flat,  //!< A constant value per channel
+  gradient,  //!< Linear ramps along v and u
+  noise,  //!< Uniform noise, independent for every sample
+  texture,  //!< A single textured plane at the first disparity
+  planes  //!< Textured and flat planes at all the disparities
+};
+
+
+struct SyntheticLightfieldParameters {
+  LightfieldDimension<std::size_t> dimension;
+  std::size_t number_of_channels = 3;
+  std::size_t bits_per_sample = 10;
+  SyntheticLightfieldContent content = SyntheticLightfieldContent::planes;
+  //! Disparities (pixels per view) of the planes, from back to front
+  std::vector<double> disparities = {-0.5, 0.5, 1.5};
+  //! Amplitude of the additive noise, relative to the maximum sample value
+  double noise_amplitude = 0.01;
+  uint32_t seed = 0;
+};
+
+
+class SyntheticLightfield {
+ protected:
+  struct Plane {
+    double disparity;
+    bool is_textured;
+    //region covered in the central view (the background covers all)
+    double first_v, first_u, last_v, last_u;
+    double frequency_v, frequency_u, phase;
+    std::vector<double> channel_gains;
+  };
+
+  SyntheticLightfieldParameters parameters;
+  double maximum_value;
+  double central_t;
+  double central_s;
+  std::vector<Plane> planes;
+
+  uint64_t get_hash(uint64_t a, uint64_t b, uint64_t c, uint64_t d) const;
+  double get_uniform(uint64_t a, uint64_t b, uint64_t c, uint64_t d) const;
+  double get_value_noise(double v, double u, std::size_t plane_index) const;
+  double get_plane_value(const Plane& plane, std::size_t plane_index,
+      std::size_t channel, double v, double u) const;
+  double get_content_value(std::size_t t, std::size_t s, std::size_t channel,
+      std::size_t v, std::size_t u) const;
+  void create_planes();
+
+ public:
+  /**
+   * \brief      Constructs a new instance.
+   *
+   * \details    Throws if the bits per sample are not in [1, 16], if there are
+   * no channels or if the content needs planes and no disparity is given.
+   */
+  explicit SyntheticLightfield(const SyntheticLightfieldParameters& parameters);
+
+
+  ~SyntheticLightfield() = default;
+
+
+  const SyntheticLightfieldParameters& get_parameters() const noexcept {
+    return parameters;
+  }
+
+
+  /**
+   * \brief      Gets the sample of channel c at (t, s, v, u).
+   */
+  uint16_t get_sample(std::size_t t, std::size_t s, std::size_t channel,
+      std::size_t v, std::size_t u) const;
+
+
+  /**
+   * \brief      Fills the image (already allocated with the view size and the
+   * number of channels) with the view at position (t, s).
+   */
+  void fill_view(const std::pair<std::size_t, std::size_t>& position,
+      Image<uint16_t>& image) const;
+
+
+  /**
+   * \brief      Gets the samples of the whole light field, in the planar
+   * order of LightfieldMemoryIO (and of the planar light-field file).
+   */
+  std::vector<uint16_t> get_planar_samples() const;
+
+
+  /**
+   * \brief      Gets a read-only in-memory light field whose views are
+   * generated when read (no sample is stored).
+   */
+  std::shared_ptr<LightfieldMemoryIO<uint16_t>> get_memory_io() const;
+};
+
+
+/**
+ * \brief      Gets the content from its name (flat, gradient, noise, texture
+ * or planes).
+ */
+SyntheticLightfieldContent get_synthetic_lightfield_content(
+    const std::string& name);
+
+
+/**
+ * \brief      Gets the disparities from a comma separated list.
+ */
+std::vector<double> get_synthetic_lightfield_disparities(
+    const std::string& list);
+
+#endif /* end of include guard: JPLM_LIB_PART2_COMMON_SYNTHETICLIGHTFIELD_H__ */
@@ -100,6 +100,7 @@ void Block4D::release_data() {
     delete[] mPixel;
     delete[] mPixelData;
     mPixelData = nullptr;
+    tracked_bytes.set(0);
   }
 }
 
@@ -133,6 +134,7 @@ void Block4D::set_dimension(uint32_t length_t, uint32_t length_s,
 
   if (number_of_elements != 0) {
     mPixelData = new block4DElementType[number_of_elements];
+    tracked_bytes.set(number_of_elements * sizeof(block4DElementType));
     mPixel = new block4DElementType***[mlength_t];
     for (auto t = decltype(mlength_t){0}; t < mlength_t; ++t) {
       mPixel[t] = new block4DElementType**[mlength_s];
@@ -200,11 +202,13 @@ void Block4D::operator=(const Block4D& other) {
 void Block4D::swap_data_with(Block4D& other) {  //assumes the sizes are equal...
   std::swap(mPixelData, other.mPixelData);
   std::swap(mPixel, other.mPixel);
+  std::swap(tracked_bytes, other.tracked_bytes);
 }
 
 
 //move constructor
-Block4D::Block4D(Block4D&& other) {
+Block4D::Block4D(Block4D&& other)
+    : tracked_bytes(std::move(other.tracked_bytes)) {
   set_lengths(
       other.mlength_t, other.mlength_s, other.mlength_v, other.mlength_u);
   number_of_elements = other.number_of_elements;
@@ -250,6 +254,7 @@ Block4D& Block4D::operator=(Block4D&& other) {
   mPixel = other.mPixel;
   other.mPixelData = nullptr;
   other.mPixel = nullptr;
+  tracked_bytes = std::move(other.tracked_bytes);
   return *this;
 }
 
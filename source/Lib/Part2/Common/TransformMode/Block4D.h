@@ -53,6 +53,7 @@
 #include <iostream>
 #include <vector>
 #include "Lib/Part2/Common/LightfieldDimension.h"
+#include "Lib/Utils/Stats/MemoryAccounting.h"
 
 
 #ifndef block4DElementType
@@ -81,6 +82,8 @@ class Block4D {
  private:
   std::size_t number_of_elements = 0;
   std::size_t number_of_allocated_elements = 0;
+  MemoryAccounting::TrackedBytes tracked_bytes =
+      MemoryAccounting::TrackedBytes(MemoryAccounting::Category::blocks_4d);
   void set_number_of_elements();
   void set_strides();
   void set_lengths(uint32_t length_t, uint32_t length_s, uint32_t length_v,
@@ -106,4 +106,42 @@ class OverflowInTheNumberOf4DBlocks : public std::exception {
 };
 }  // namespace LightFieldConfigurationMarker
 
+namespace DCT4DCoefficientsExceptions {
+class SizeOutOfTheRegistryException : public std::exception {
+ private:
+  std::string message_;
+
+ public:
+  explicit SizeOutOfTheRegistryException(
+      uint32_t size, uint32_t maximal_size) {
+    message_ = "There are no DCT coefficients for the transform size " +
+               std::to_string(size) + ". The registry was built for the "
+               "sizes of the partitions of blocks up to " +
+               std::to_string(maximal_size) + ".";
+  }
+
+  virtual const char* what() const throw() {
+    return message_.c_str();
+  }
+};
+
+
+class UnsupportedTransformSizeException : public std::exception {
+ private:
+  std::string message_;
+
+ public:
+  explicit UnsupportedTransformSizeException(
+      uint32_t size, uint32_t maximal_supported_size) {
+    message_ = "The transform size " + std::to_string(size) +
+               " is not supported. The largest supported size is " +
+               std::to_string(maximal_supported_size) + ".";
+  }
+
+  virtual const char* what() const throw() {
+    return message_.c_str();
+  }
+};
+}  // namespace DCT4DCoefficientsExceptions
+
 #endif  // JPLM_LIB_PART2_COMMON_TRANSFORMMODE_COMMON_EXCEPTIONS_H
\ No newline at end of file
@@ -41,24 +41,26 @@
 #include "DCT4DBlock.h"
 
 
-DCT4DBlock::DCT4DBlock(const Block4D& block) : Transformed4DBlock(block) {
-  DCT4DCoefficientsManager& manager(
-      DCT4DCoefficientsManager::get_instance(true));
+DCT4DBlock::DCT4DBlock(const Block4D& block,
+    const DCT4DCoefficientsRegistry& registry, TransformPrecision precision)
+    : Transformed4DBlock(block) {
+  JPLM_STAGE_TIMER(forward_dct);
+  JPLM_STAGE_ITEMS(forward_dct, block.get_number_of_elements());
 
-  auto coefficients =
-      std::make_tuple(manager.get_coefficients_for_size(block.mlength_t),  //
-          manager.get_coefficients_for_size(block.mlength_s),
-          manager.get_coefficients_for_size(block.mlength_v),
-          manager.get_coefficients_for_size(block.mlength_u));
+  auto coefficients = std::make_tuple(
+      registry.get_forward_coefficients_for_size(block.mlength_t),  //
+      registry.get_forward_coefficients_for_size(block.mlength_s),
+      registry.get_forward_coefficients_for_size(block.mlength_v),
+      registry.get_forward_coefficients_for_size(block.mlength_u));
 
   auto weights =
-      std::make_tuple(manager.get_weight_for_size_in_dimension(
+      std::make_tuple(registry.get_weight_for_size_in_dimension(
                           block.mlength_t, LightFieldDimensions::T),  //
-          manager.get_weight_for_size_in_dimension(
+          registry.get_weight_for_size_in_dimension(
               block.mlength_s, LightFieldDimensions::S),
-          manager.get_weight_for_size_in_dimension(
+          registry.get_weight_for_size_in_dimension(
               block.mlength_v, LightFieldDimensions::V),
-          manager.get_weight_for_size_in_dimension(
+          registry.get_weight_for_size_in_dimension(
               block.mlength_u, LightFieldDimensions::U));
 
   auto n =
@@ -71,29 +73,109 @@ DCT4DBlock::DCT4DBlock(const Block4D& block) : Transformed4DBlock(block) {
 
   this->mult = gain * static_cast<double>(n);
 
+  if (precision == TransformPrecision::single_precision) {
+    auto coefficients_of = [&registry](uint32_t size) {
+      return registry.get_single_precision_forward_coefficients_for_size(size);
+    };
+    do_single_precision_4d_transform(data.get(), block.mPixelData,
+        std::make_tuple(coefficients_of(block.mlength_t),
+            coefficients_of(block.mlength_s), coefficients_of(block.mlength_v),
+            coefficients_of(block.mlength_u)),
+        std::make_tuple(static_cast<float>(std::get<0>(weights)),
+            static_cast<float>(std::get<1>(weights)),
+            static_cast<float>(std::get<2>(weights)),
+            static_cast<float>(std::get<3>(weights))));
+    return;
+  }
+
   do_4d_transform(data.get(), block.mPixelData, coefficients, weights);
 }
 
 
-Block4D DCT4DBlock::inverse() {
-  DCT4DCoefficientsManager& manager(
-      DCT4DCoefficientsManager::get_instance(false));
+Block4D DCT4DBlock::inverse(const DCT4DCoefficientsRegistry& registry) {
+  const auto whole_block = SignificanceBoundingBox::for_whole_block(
+      mlength_t, mlength_s, mlength_v, mlength_u);
+  return inverse(registry, whole_block);
+}
+
+
+Block4D DCT4DBlock::inverse(const DCT4DCoefficientsRegistry& registry,
+    const SignificanceBoundingBox& significant_region) {
+  JPLM_STAGE_TIMER(inverse_dct);
+  JPLM_STAGE_ITEMS(inverse_dct, get_number_of_elements());
 
   auto coefficients =
-      std::make_tuple(manager.get_coefficients_for_size(mlength_t),  //
-          manager.get_coefficients_for_size(mlength_s),
-          manager.get_coefficients_for_size(mlength_v),
-          manager.get_coefficients_for_size(mlength_u));
+      std::make_tuple(registry.get_inverse_coefficients_for_size(mlength_t),  //
+          registry.get_inverse_coefficients_for_size(mlength_s),
+          registry.get_inverse_coefficients_for_size(mlength_v),
+          registry.get_inverse_coefficients_for_size(mlength_u));
 
   auto weights =
-      std::make_tuple(1.0 / manager.get_weight_for_size_in_dimension(
+      std::make_tuple(1.0 / registry.get_weight_for_size_in_dimension(
                                 mlength_t, LightFieldDimensions::T),  //
-          1.0 / manager.get_weight_for_size_in_dimension(
+          1.0 / registry.get_weight_for_size_in_dimension(
                     mlength_s, LightFieldDimensions::S),
-          1.0 / manager.get_weight_for_size_in_dimension(
+          1.0 / registry.get_weight_for_size_in_dimension(
                     mlength_v, LightFieldDimensions::V),
-          1.0 / manager.get_weight_for_size_in_dimension(
+          1.0 / registry.get_weight_for_size_in_dimension(
                     mlength_u, LightFieldDimensions::U));
 
-  return Transformed4DBlock::inverse(coefficients, weights);
-}
\ No newline at end of file
+  return Transformed4DBlock::inverse(
+      coefficients, weights, significant_region);
+}
+
+Block4D DCT4DBlock::inverse_low_frequencies(
+    const DCT4DCoefficientsRegistry& registry, uint32_t length_t,
+    uint32_t length_s, uint32_t length_v, uint32_t length_u) const {
+  JPLM_STAGE_TIMER(inverse_dct);
+  JPLM_STAGE_ITEMS(inverse_dct, get_number_of_elements());
+  Block4D low_frequencies;
+  low_frequencies.set_dimension(length_t, length_s, length_v, length_u);
+  for (auto t = decltype(length_t){0}; t < length_t; ++t) {
+    for (auto s = decltype(length_s){0}; s < length_s; ++s) {
+      for (auto v = decltype(length_v){0}; v < length_v; ++v) {
+        auto row = data.get() + ((t * mlength_s + s) * mlength_v + v) *
+                                    static_cast<std::size_t>(mlength_u);
+        std::copy(row, row + length_u, low_frequencies.mPixel[t][s][v]);
+      }
+    }
+  }
+
+  //the weights of the full size block are undone, and the ratio between the
+  //lengths keeps the mean value of the samples (the inverse is not normalized)
+  auto weight = [&registry](uint32_t length, uint32_t full_length,
+                    LightFieldDimensions dimension) {
+    return (1.0 / registry.get_weight_for_size_in_dimension(
+                      full_length, dimension)) *
+           (static_cast<double>(length) / static_cast<double>(full_length));
+  };
+
+  //the downscaled lengths are not partition lengths, so they may not be in
+  //the registry (their matrices are small)
+  std::vector<double> computed_coefficients[4];
+  auto coefficients_of = [&registry, &computed_coefficients](
+                             uint32_t length, int dimension) {
+    if (registry.has_size(length)) {
+      return registry.get_inverse_coefficients_for_size(length);
+    }
+    auto& coefficients = computed_coefficients[dimension];
+    coefficients.resize(static_cast<std::size_t>(length) * length);
+    DCT4DCoefficientsRegistry::generate_inverse_coefficients(
+        length, coefficients.data());
+    return static_cast<const double*>(coefficients.data());
+  };
+
+  auto coefficients = std::make_tuple(coefficients_of(length_t, 0),  //
+      coefficients_of(length_s, 1), coefficients_of(length_v, 2),
+      coefficients_of(length_u, 3));
+
+  auto weights =
+      std::make_tuple(weight(length_t, mlength_t, LightFieldDimensions::T),
+          weight(length_s, mlength_s, LightFieldDimensions::S),
+          weight(length_v, mlength_v, LightFieldDimensions::V),
+          weight(length_u, mlength_u, LightFieldDimensions::U));
+
+  auto low_frequencies_block = DCT4DBlock(std::move(low_frequencies));
+  return low_frequencies_block.Transformed4DBlock::inverse(
+      coefficients, weights);
+}
@@ -41,8 +41,10 @@
 #ifndef JPLM_LIB_PART2_COMMON_TRANSFORMMODE_DCT4DBLOCK_H__
 #define JPLM_LIB_PART2_COMMON_TRANSFORMMODE_DCT4DBLOCK_H__
 
-#include "Lib/Part2/Common/TransformMode/DCT4DCoefficientsManager.h"
+#include "Lib/Part2/Common/TransformMode/DCT4DCoefficientsRegistry.h"
 #include "Lib/Part2/Common/TransformMode/Transformed4DBlock.h"
+#include "Lib/Part2/Common/TransformMode/TransformPrecision.h"
+#include "Lib/Utils/Stats/StageInstrumentation.h"
 
 
 class DCT4DBlock : public Transformed4DBlock {
@@ -50,7 +52,13 @@ class DCT4DBlock : public Transformed4DBlock {
   double mult = 1.0;
 
  public:
-  DCT4DBlock(const Block4D& block);
+  /**
+   * \brief Forward DCT of the block, in the given precision (the single
+   *        precision one is an approximation, not to be coded)
+   */
+  DCT4DBlock(const Block4D& block,
+      const DCT4DCoefficientsRegistry& coefficients,
+      TransformPrecision precision = TransformPrecision::double_precision);
   DCT4DBlock(
       const block4DElementType* transformed_values, int u, int v, int s, int t)
       : Transformed4DBlock(transformed_values, u, v, s, t){};
@@ -59,7 +67,26 @@ class DCT4DBlock : public Transformed4DBlock {
 
   virtual ~DCT4DBlock() = default;
 
-  Block4D inverse();
+  Block4D inverse(const DCT4DCoefficientsRegistry& coefficients);
+
+  /**
+   * \brief Inverse transform of a block whose non-zero coefficients are all
+   *        inside significant_region (the other lines are skipped)
+   */
+  Block4D inverse(const DCT4DCoefficientsRegistry& coefficients,
+      const SignificanceBoundingBox& significant_region);
+
+  /**
+   * \brief Inverse transform of the lowest frequency coefficients only
+   *
+   * \details Uses the first length_x coefficients in each dimension (each
+   *          length_x must not be larger than the block length) and a
+   *          smaller inverse DCT, giving a low pass downsampled version of
+   *          the block with the given lengths.
+   */
+  Block4D inverse_low_frequencies(
+      const DCT4DCoefficientsRegistry& coefficients, uint32_t length_t,
+      uint32_t length_s, uint32_t length_v, uint32_t length_u) const;
 
   auto get_coefficients_mult() {
     return mult;
@@ -0,0 +1,154 @@
+/* The copyright in this software is being made available under the BSD
+ * License, included below. This software may be subject to other third party
+ * and contributor rights, including patent rights, and no such rights are
+ * granted under this license.
+ *
+ * Copyright (c) 2010-2019, ITU/ISO/IEC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *  * Neither the name of the ITU/ISO/IEC nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/** \file     DCT4DCoefficientsRegistry.cpp
+ *  \brief    
+ *  \details  
+ *  \author   Ismael Seidel <i.seidel@samsung.com>
+ *  \date     2019-03-21
+ */
+
+#include "DCT4DCoefficientsRegistry.h"
+#include <algorithm>
+
+
+DCT4DCoefficientsRegistry::DCT4DCoefficientsRegistry(
+    const std::tuple<uint32_t, uint32_t, uint32_t, uint32_t>&
+        maximal_transform_sizes,
+    const std::tuple<double, double, double, double>& gains,
+    const std::vector<uint32_t>& other_block_sizes) {
+  const auto& [max_size_t, max_size_s, max_size_v, max_size_u] =
+      maximal_transform_sizes;
+  const auto& [gain_t, gain_s, gain_v, gain_u] = gains;
+  const int max_sizes[4] = {static_cast<int>(max_size_t),
+      static_cast<int>(max_size_s), static_cast<int>(max_size_v),
+      static_cast<int>(max_size_u)};  //indexed by LightFieldDimensions
+  const double dimension_gains[4] = {gain_t, gain_s, gain_v, gain_u};
+
+  auto block_sizes = std::vector<uint32_t>(
+      {max_size_t, max_size_s, max_size_v, max_size_u});
+  block_sizes.insert(
+      block_sizes.end(), other_block_sizes.begin(), other_block_sizes.end());
+  maximal_size = *std::max_element(block_sizes.begin(), block_sizes.end());
+  if (maximal_size > maximal_supported_size) {
+    throw DCT4DCoefficientsExceptions::UnsupportedTransformSizeException(
+        maximal_size, maximal_supported_size);
+  }
+
+  //a split gives the lengths size / 2 and size - size / 2
+  coefficients_offsets.resize(maximal_size + 1, no_coefficients);
+  auto number_of_coefficients = std::size_t{0};
+  auto pending_sizes = block_sizes;
+  while (!pending_sizes.empty()) {
+    const auto size = pending_sizes.back();
+    pending_sizes.pop_back();
+    if ((size == 0) || (coefficients_offsets[size] != no_coefficients)) {
+      continue;
+    }
+    coefficients_offsets[size] = number_of_coefficients;
+    number_of_coefficients += static_cast<std::size_t>(size) * size;
+    pending_sizes.push_back(size / 2);
+    pending_sizes.push_back(size - size / 2);
+  }
+
+  forward_coefficients.resize(number_of_coefficients);
+  inverse_coefficients.resize(number_of_coefficients);
+  for (auto size = uint32_t{1}; size <= maximal_size; ++size) {
+    if (has_size(size)) {
+      generate_forward_coefficients(
+          size, forward_coefficients.data() + coefficients_offsets[size]);
+      generate_inverse_coefficients(
+          size, inverse_coefficients.data() + coefficients_offsets[size]);
+    }
+  }
+  single_precision_forward_coefficients.assign(
+      forward_coefficients.begin(), forward_coefficients.end());
+
+  weights.resize(4 * static_cast<std::size_t>(maximal_size + 1), 0.0);
+  for (auto dimension = 0; dimension < 4; ++dimension) {
+    for (auto size = uint32_t{1}; size <= maximal_size; ++size) {
+      //used to test correctness of corner block shrinking:
+      //double transform_gain =gains[dimension_name]*sqrt(2.0/static_cast<double>(size));
+      weights[dimension * (maximal_size + 1) + size] =
+          dimension_gains[dimension] *
+          sqrt(max_sizes[dimension] / static_cast<double>(size));
+    }
+  }
+}
+
+
+void DCT4DCoefficientsRegistry::generate_forward_coefficients(
+    uint32_t size, double* coefficients) {
+  const auto rows = static_cast<int>(size);
+  const auto columns = static_cast<int>(size);
+
+  double* coefficients_ptr = coefficients;
+  for (auto j = 0; j < columns; ++j) {  //i=0
+    *coefficients_ptr = 1.0;
+    coefficients_ptr++;
+  }
+  for (auto i = 1; i < rows; ++i) {
+    for (auto j = 0; j < columns; ++j) {
+      *coefficients_ptr =
+          sqrt(2.0) * cos(dctPi * (i * (2.0 * j + 1.0)) / (2.0 * rows));
+      coefficients_ptr++;
+    }
+  }
+}
+
+
+//in theory the IDCT can be computed using the same coefficients, but transposed and scaled..
+void DCT4DCoefficientsRegistry::generate_inverse_coefficients(
+    uint32_t size, double* coefficients) {
+  const auto rows = static_cast<int>(size);
+  const auto columns = static_cast<int>(size);
+
+  double* coefficients_ptr = coefficients;
+  for (auto j = 0; j < columns; ++j) {
+    *coefficients_ptr = 1.0 / static_cast<double>(columns);
+    coefficients_ptr++;
+    for (auto i = 1; i < rows; ++i) {
+      *coefficients_ptr = sqrt(2.0) *
+                          cos(dctPi * (i * (2.0 * j + 1.0)) / (2.0 * rows)) /
+                          static_cast<double>(columns);
+      coefficients_ptr++;
+    }
+  }
+}
+
+
+void DCT4DCoefficientsRegistry::check_size(uint32_t size) const {
+  if (!has_size(size)) {
+    throw DCT4DCoefficientsExceptions::SizeOutOfTheRegistryException(
+        size, maximal_size);
+  }
+}
@@ -0,0 +1,166 @@
+/* The copyright in this software is being made available under the BSD
+ * License, included below. This software may be subject to other third party
+ * and contributor rights, including patent rights, and no such rights are
+ * granted under this license.
+ *
+ * Copyright (c) 2010-2019, ITU/ISO/IEC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *  * Neither the name of the ITU/ISO/IEC nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/** \file     DCT4DCoefficientsRegistry.h
+ *  \brief    Immutable set of the DCT coefficients and weights of a
+ *            transform configuration.
+ *  \details  The sizes reachable by halving the 4D block sizes are computed
+ *            on construction and stored in flat arrays, thus the lookups are
+ *            plain indexing and the registry can be shared by concurrent
+ *            transforms without synchronization.
+ *  \author   Ismael Seidel <i.seidel@samsung.com>
+ *  \date     2019-03-21
+ */
+
+#ifndef JPLM_LIB_PART2_COMMON_TRANSFORMMODE_DCT4DCOEFFICIENTSREGISTRY_H__
+#define JPLM_LIB_PART2_COMMON_TRANSFORMMODE_DCT4DCOEFFICIENTSREGISTRY_H__
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <tuple>
+#include <vector>
+#include "Lib/Part2/Common/Lightfield.h"
+#include "Lib/Part2/Common/TransformMode/CommonExceptions.h"
+
+class DCT4DCoefficientsRegistry {
+ public:
+  //! Bounds the memory used by the coefficients (and read from codestreams)
+  static constexpr uint32_t maximal_supported_size = 4096;
+
+ private:
+  static constexpr double dctPi = 3.141592653589793;
+  static constexpr std::size_t no_coefficients = SIZE_MAX;
+
+  uint32_t maximal_size;  //!< Largest length in any dimension
+  std::vector<std::size_t>
+      coefficients_offsets;  //!< Of the size x size matrix, indexed by size
+                             //!< (no_coefficients if it is not reachable)
+  std::vector<double> forward_coefficients;
+  std::vector<double> inverse_coefficients;
+  std::vector<float>
+      single_precision_forward_coefficients;  //!< Rounded forward ones
+  std::vector<double>
+      weights;  //!< Indexed by dimension * (maximal_size + 1) + size
+
+  void check_size(uint32_t size) const;
+
+ public:
+  /**
+   * \brief      Computes the coefficients and weights of the transform
+   *             lengths reachable by halving the 4D block sizes, i.e., the
+   *             lengths of the partitions
+   *
+   * \param[in]  maximal_transform_sizes  The maximal transform sizes (t, s,
+   *             v, u), which scale the weights of the smaller lengths
+   * \param[in]  gains  The transform gains (t, s, v, u)
+   * \param[in]  other_block_sizes  Lengths of the 4D blocks smaller than the
+   *             maximal ones (e.g., the truncated ones at the borders)
+   */
+  DCT4DCoefficientsRegistry(
+      const std::tuple<uint32_t, uint32_t, uint32_t, uint32_t>&
+          maximal_transform_sizes,
+      const std::tuple<double, double, double, double>& gains,
+      const std::vector<uint32_t>& other_block_sizes = {});
+
+
+  /**
+   * \brief      Writes the size x size forward DCT matrix (row major, one row
+   *             per frequency)
+   */
+  static void generate_forward_coefficients(
+      uint32_t size, double* coefficients);
+
+
+  /**
+   * \brief      Writes the size x size inverse DCT matrix (row major, one row
+   *             per sample), e.g., for lengths that are not in the registry
+   */
+  static void generate_inverse_coefficients(
+      uint32_t size, double* coefficients);
+
+
+  bool has_size(uint32_t size) const noexcept {
+    return (size <= maximal_size) &&
+           (coefficients_offsets[size] != no_coefficients);
+  }
+
+
+  /**
+   * \brief      Gets the size x size forward DCT matrix (row major, one row
+   *             per frequency)
+   */
+  const double* get_forward_coefficients_for_size(uint32_t size) const {
+    check_size(size);
+    return forward_coefficients.data() + coefficients_offsets[size];
+  }
+
+
+  /**
+   * \brief      Gets the forward DCT matrix rounded to single precision
+   */
+  const float* get_single_precision_forward_coefficients_for_size(
+      uint32_t size) const {
+    check_size(size);
+    return single_precision_forward_coefficients.data() +
+           coefficients_offsets[size];
+  }
+
+
+  /**
+   * \brief      Gets the size x size inverse DCT matrix (row major, one row
+   *             per sample)
+   */
+  const double* get_inverse_coefficients_for_size(uint32_t size) const {
+    check_size(size);
+    return inverse_coefficients.data() + coefficients_offsets[size];
+  }
+
+
+  /**
+   * \brief      Gets the weight of the forward transform of the given size in
+   *             a dimension (the inverse uses its reciprocal)
+   */
+  double get_weight_for_size_in_dimension(
+      uint32_t size, LightFieldDimensions dimension) const {
+    check_size(size);
+    return weights[static_cast<std::size_t>(dimension) * (maximal_size + 1) +
+                   size];
+  }
+
+
+  uint32_t get_maximal_size() const noexcept {
+    return maximal_size;
+  }
+};
+
+#endif /* end of include guard: JPLM_LIB_PART2_COMMON_TRANSFORMMODE_DCT4DCOEFFICIENTSREGISTRY_H__ */
@@ -43,14 +43,16 @@
 
 #include <cstdint>
 #include <iostream>
+#include <memory>
 #include "Lib/Common/Boxes/Generic/ContiguousCodestreamBox.h"
 #include "Lib/Part2/Common/JPLMLightFieldCodec.h"
 #include "Lib/Part2/Common/TransformMode/BorderBlocksPolicy.h"
 #include "Lib/Part2/Common/TransformMode/CodestreamPointerSetMarkerSegment.h"
 #include "Lib/Part2/Common/TransformMode/CommonExceptions.h"
-#include "Lib/Part2/Common/TransformMode/DCT4DCoefficientsManager.h"
+#include "Lib/Part2/Common/TransformMode/DCT4DCoefficientsRegistry.h"
 #include "Lib/Part2/Common/TransformMode/LightFieldTransformMode.h"
 #include "Lib/Utils/Image/ColorSpaces.h"
+#include "Lib/Utils/Stats/TraceEvents.h"
 #include "cppitertools/product.hpp"
 #include "cppitertools/zip.hpp"
 #include "tqdm-cpp/tqdm.hpp"
@@ -68,6 +70,8 @@ class JPLM4DTransformModeLightFieldCodec
   LightfieldDimension<uint32_t> lightfield_dimension;
   LightfieldDimension<uint32_t> block_4d_dimension;
   const JPLMConfiguration& transform_mode_configuration;
+  std::unique_ptr<const DCT4DCoefficientsRegistry>
+      dct_coefficients;  //<! Shared by all transforms, set up by the codecs
 
 
   /**
@@ -238,7 +242,7 @@ class JPLM4DTransformModeLightFieldCodec
   virtual ~JPLM4DTransformModeLightFieldCodec() = default;
 
 
-  void setup_transform_coefficients(bool forward,
+  void setup_transform_coefficients(
       const std::tuple<uint32_t, uint32_t, uint32_t, uint32_t>& max_sizes,
       const std::tuple<double, double, double, double>& scalings);
 
@@ -255,6 +259,11 @@ class JPLM4DTransformModeLightFieldCodec
   virtual void run() override;
 
 
+  void run_for_block_4d_with_trace(const uint32_t channel,
+      const LightfieldCoordinate<uint32_t>& position,
+      const LightfieldDimension<uint32_t>& size);
+
+
   virtual void run_for_block_4d(const uint32_t channel,
       const LightfieldCoordinate<uint32_t>& position,
       const LightfieldDimension<uint32_t>& size) = 0;
@@ -263,16 +272,15 @@ class JPLM4DTransformModeLightFieldCodec
 
 template<typename PelType>
 void JPLM4DTransformModeLightFieldCodec<PelType>::setup_transform_coefficients(
-    bool forward,
     const std::tuple<uint32_t, uint32_t, uint32_t, uint32_t>& max_sizes,
     const std::tuple<double, double, double, double>& scalings) {
-  const auto& [t_size, s_size, v_size, u_size] = max_sizes;
-  const auto& [t_scaling, s_scaling, v_scaling, u_scaling] = scalings;
-  DCT4DCoefficientsManager::get_instance(forward).set_transform_max_sizes(
-      u_size, v_size, s_size, t_size);
-
-  DCT4DCoefficientsManager::get_instance(forward).set_transform_gains(
-      u_scaling, v_scaling, s_scaling, t_scaling);
+  //the blocks truncated at the borders are also partitioned
+  const auto& [max_size_t, max_size_s, max_size_v, max_size_u] = max_sizes;
+  const auto& [T, S, V, U] = lightfield_dimension;
+  const auto border_sizes = std::vector<uint32_t>{
+      T % max_size_t, S % max_size_s, V % max_size_v, U % max_size_u};
+  dct_coefficients = std::make_unique<const DCT4DCoefficientsRegistry>(
+      max_sizes, scalings, border_sizes);
 }
 
 
@@ -317,6 +325,23 @@ void JPLM4DTransformModeLightFieldCodec<
 }
 
 
+template<typename PelType>
+void JPLM4DTransformModeLightFieldCodec<PelType>::run_for_block_4d_with_trace(
+    const uint32_t channel, const LightfieldCoordinate<uint32_t>& position,
+    const LightfieldDimension<uint32_t>& size) {
+  auto event = TraceEvents::ScopedEvent("block_4d", "codec");
+  if (event.is_recording()) {
+    event.add_argument("channel", channel);
+    event.add_argument("position", std::vector<uint32_t>({position.get_t(),
+                                       position.get_s(), position.get_v(),
+                                       position.get_u()}));
+    event.add_argument("size", std::vector<uint32_t>({size.get_t(),
+                                   size.get_s(), size.get_v(), size.get_u()}));
+  }
+  run_for_block_4d(channel, position, size);
+}
+
+
 template<typename PelType>
 void JPLM4DTransformModeLightFieldCodec<PelType>::run() {
   const auto& block_coordinates_and_sizes = get_block_coordinates_and_sizes();
@@ -324,14 +349,14 @@ void JPLM4DTransformModeLightFieldCodec<PelType>::run() {
   if (transform_mode_configuration.show_progress_bar()) {
     for (auto&& [position, size, channel] :
         tq::tqdm(block_coordinates_and_sizes)) {
-      run_for_block_4d(channel, position, size);
+      run_for_block_4d_with_trace(channel, position, size);
     }
   } else {
     for (auto&& [position, size, channel] : block_coordinates_and_sizes) {
       if (transform_mode_configuration.is_verbose()) {
         std::cout << "Transforming 4D at " << position << std::endl;
       }
-      run_for_block_4d(channel, position, size);
+      run_for_block_4d_with_trace(channel, position, size);
     }
   }
 
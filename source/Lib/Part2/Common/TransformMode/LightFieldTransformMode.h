@@ -41,8 +41,11 @@
 #ifndef JPLM_LIB_PART2_COMMON_TRANSFORMMODE_LIGHTFIELDTRANSFORMMODE_H__
 #define JPLM_LIB_PART2_COMMON_TRANSFORMMODE_LIGHTFIELDTRANSFORMMODE_H__
 
+#include <algorithm>
+#include <limits>
 #include "Lib/Part2/Common/LightfieldFromFile.h"
 #include "Lib/Part2/Common/TransformMode/Block4D.h"
+#include "Lib/Utils/Stats/StageInstrumentation.h"
 
 template<typename T = uint16_t>
 class LightFieldTransformMode : public LightfieldFromFile<T> {
@@ -72,130 +75,225 @@ class LightFieldTransformMode : public LightfieldFromFile<T> {
   }
 
 
+  /**
+   * @brief      Constructs a new instance whose views are in memory.
+   *
+   * @param[in]  memory_io       Reads (encoder) or writes (decoder) the views
+   * @param      view_io_policy  The view i/o policy
+   */
+  LightFieldTransformMode(
+      const std::shared_ptr<LightfieldMemoryIO<T>>& memory_io,
+      ViewIOPolicy<T>&& view_io_policy = ViewIOPolicyLimitlessMemory<T>())
+      : LightfieldFromFile<T>(memory_io, std::move(view_io_policy)) {
+  }
+
+
   virtual ~LightFieldTransformMode() = default;
 
 
+  /**
+   * \brief      Gets the 4D block at coordinate_4d from the given channel.
+   *
+   * \param[in]  channel        The channel
+   * \param[in]  coordinate_4d  The position of the first sample of the block
+   * \param[in]  size           The size of the block
+   * \param[in]  level_shift    Value added to every sample while it is gathered
+   *
+   * \return     The block, already level shifted.
+   *
+   * \details    Samples outside the light field are set to level_shift (i.e.,
+   * zero before the shift). The copy is done row by row (u dimension), so
+   * that the border test is evaluated once per row instead of once per
+   * sample.
+   */
   Block4D get_block_4D_from(const int channel,
       const LightfieldCoordinate<uint32_t>& coordinate_4d,
-      const LightfieldDimension<uint32_t>& size);
+      const LightfieldDimension<uint32_t>& size, const int level_shift = 0);
 
 
   void set_block_4D_at(const Block4D& block_4d, const int channel,
       const LightfieldCoordinate<uint32_t>& coordinate_4d);
+
+
+  /**
+   * \brief      Sets the block_4d at coordinate_4d in the given channel.
+   *
+   * \param[in]  block_4d       The block 4D
+   * \param[in]  channel        The channel
+   * \param[in]  coordinate_4d  The position of the first sample of the block
+   * \param[in]  level_shift    Value added to every sample before clipping
+   * \param[in]  min_value      The minimum value allowed in the image channel
+   * \param[in]  max_value      The maximum value allowed in the image channel
+   *
+   * \details    The level shift and the clipping to [min_value, max_value] are
+   * applied row by row during the copy, avoiding extra passes over block_4d.
+   * Samples of block_4d outside the light field are discarded.
+   */
+  void set_block_4D_at(const Block4D& block_4d, const int channel,
+      const LightfieldCoordinate<uint32_t>& coordinate_4d,
+      const int level_shift, const block4DElementType min_value,
+      const block4DElementType max_value);
+
+
+ private:
+  /**
+   * \brief      Gets the number of samples of a block dimension that are
+   * inside the light field.
+   *
+   * \param[in]  initial  The position of the first sample of the block
+   * \param[in]  length   The block length
+   * \param[in]  limit    The light field length
+   */
+  static uint32_t get_number_of_samples_inside(
+      const uint32_t initial, const uint32_t length, const uint32_t limit) {
+    if (initial >= limit) {
+      return 0;
+    }
+    return std::min(length, limit - initial);
+  }
+
+
+  static void gather_row(block4DElementType* destination, const T* source,
+      const uint32_t number_of_valid_samples,
+      const uint32_t number_of_samples, const int level_shift);
+
+
+  static void scatter_row(T* destination,
+      const block4DElementType* source, const uint32_t number_of_samples,
+      const int level_shift, const block4DElementType min_value,
+      const block4DElementType max_value);
 };
 
 
+/**
+ * \brief      Copies one row of samples from an image channel to a 4D block.
+ *
+ * \details    Written as plain loops over contiguous memory, so that the
+ * compiler is able to vectorize the type conversion and level shift. The
+ * remaining samples (outside the light field) are filled with level_shift.
+ */
+template<typename T>
+void LightFieldTransformMode<T>::gather_row(block4DElementType* destination,
+    const T* source, const uint32_t number_of_valid_samples,
+    const uint32_t number_of_samples, const int level_shift) {
+  for (auto u = decltype(number_of_valid_samples){0};
+       u < number_of_valid_samples; ++u) {
+    destination[u] = static_cast<block4DElementType>(source[u]) + level_shift;
+  }
+  std::fill(destination + number_of_valid_samples,
+      destination + number_of_samples,
+      static_cast<block4DElementType>(level_shift));
+}
+
+
+/**
+ * \brief      Copies one row of samples from a 4D block to an image channel.
+ *
+ * \details    Applies the level shift and clips the result before converting
+ * it to the image sample type.
+ */
+template<typename T>
+void LightFieldTransformMode<T>::scatter_row(T* destination,
+    const block4DElementType* source, const uint32_t number_of_samples,
+    const int level_shift, const block4DElementType min_value,
+    const block4DElementType max_value) {
+  for (auto u = decltype(number_of_samples){0}; u < number_of_samples; ++u) {
+    destination[u] = static_cast<T>(
+        std::clamp(static_cast<block4DElementType>(source[u] + level_shift),
+            min_value, max_value));
+  }
+}
+
+
 template<typename T>
 Block4D LightFieldTransformMode<T>::get_block_4D_from(const int channel,
     const LightfieldCoordinate<uint32_t>& coordinate_4d,
-    const LightfieldDimension<uint32_t>& size) {
+    const LightfieldDimension<uint32_t>& size, const int level_shift) {
+  JPLM_STAGE_TIMER(block_gather);
   auto block = Block4D(size);
+  JPLM_STAGE_ITEMS(block_gather, block.get_number_of_elements());
   const auto& [t_initial, s_initial, v_initial, u_initial] = coordinate_4d;
-  const auto [t_max, s_max, v_max, u_max] = coordinate_4d + size;
-  auto c = 0;
-  bool has_invalid_coordinates = false;
-  for (auto t = t_initial; t < t_max; ++t) {
-    for (auto s = s_initial; s < s_max; ++s) {
-      // std::cout << "getting block from " << t << ", " << s << ", channel "
-      //           << channel << std::endl;
-      //! \todo Check this for errors
-      if (this->is_coordinate_valid({t, s, v_initial, u_initial})) {
+  const auto& [length_t, length_s, length_v, length_u] = size;
+  const auto [t_size, s_size, v_size, u_size] =
+      this->template get_dimensions<uint32_t>();
+
+  const auto valid_t =
+      get_number_of_samples_inside(t_initial, length_t, t_size);
+  const auto valid_s =
+      get_number_of_samples_inside(s_initial, length_s, s_size);
+  const auto valid_v =
+      get_number_of_samples_inside(v_initial, length_v, v_size);
+  const auto valid_u =
+      get_number_of_samples_inside(u_initial, length_u, u_size);
+
+  const auto padding = static_cast<block4DElementType>(level_shift);
+  auto block_row = block.mPixelData;
+  for (auto t = decltype(length_t){0}; t < length_t; ++t) {
+    for (auto s = decltype(length_s){0}; s < length_s; ++s) {
+      if (t < valid_t && s < valid_s) {
         const auto& image_channel =
-            this->get_image_at({t, s}).get_channel(channel);
-        for (auto v = v_initial; v < v_max; ++v) {
-          for (auto u = u_initial; u < u_max; ++u) {
-            // std::cout << t << ", " << s << ", " << v << ", " << u << std::endl;
-            if (this->is_coordinate_valid({t, s, v, u})) {
-              block.mPixelData[c++] = image_channel[v][u];
-            } else {
-              has_invalid_coordinates = true;
-              block.mPixelData[c++] = 0;
-            }
-          }
+            this->get_image_at({t_initial + t, s_initial + s})
+                .get_channel(channel);
+        for (auto v = decltype(valid_v){0}; v < valid_v; ++v) {
+          gather_row(block_row, image_channel[v_initial + v] + u_initial,
+              valid_u, length_u, level_shift);
+          block_row += length_u;
         }
+        const auto number_of_padding_samples =
+            static_cast<std::size_t>(length_v - valid_v) * length_u;
+        std::fill_n(block_row, number_of_padding_samples, padding);
+        block_row += number_of_padding_samples;
       } else {
-        for (auto v = v_initial; v < v_max; ++v) {
-          for (auto u = u_initial; u < u_max; ++u) {
-            has_invalid_coordinates = true;
-            // ++c;
-            block.mPixelData[c++] = 0;
-          }
-        }
+        std::fill_n(block_row, block.stride_s, padding);
+        block_row += block.stride_s;
       }
     }
   }
 
-
-  if (has_invalid_coordinates) {
-    uint32_t last_valid_t = 0;
-    auto t = t_initial;
-    while (this->is_coordinate_valid({t, s_initial, v_initial, u_initial}) &&
-           t < t_max) {
-      ++t;
-      ++last_valid_t;
-    }
-
-    uint32_t last_valid_s = 0;
-    auto s = s_initial;
-    while (this->is_coordinate_valid({t_initial, s, v_initial, u_initial}) &&
-           s < s_max) {
-      ++s;
-      ++last_valid_s;
-    }
-
-    uint32_t last_valid_v = 0;
-    auto v = v_initial;
-    while (this->is_coordinate_valid({t_initial, s_initial, v, u_initial}) &&
-           v < v_max) {
-      ++v;
-      ++last_valid_v;
-    }
-
-    uint32_t last_valid_u = 0;
-    auto u = u_initial;
-    while (this->is_coordinate_valid({t_initial, s_initial, v_initial, u}) &&
-           u < u_max) {
-      ++u;
-      ++last_valid_u;
-    }
-#ifdef _WIN32
-    LightfieldCoordinate<int> c(
-        last_valid_t, last_valid_s, last_valid_v, last_valid_u);
-    block.extend(c);
-#else
-    block.extend({last_valid_t, last_valid_s, last_valid_v, last_valid_u});
-#endif
-  }
-
   return block;
 }
 
+
 template<typename T>
 void LightFieldTransformMode<T>::set_block_4D_at(const Block4D& block_4d,
     const int channel, const LightfieldCoordinate<uint32_t>& coordinate_4d) {
+  set_block_4D_at(block_4d, channel, coordinate_4d, 0,
+      std::numeric_limits<block4DElementType>::min(),
+      std::numeric_limits<block4DElementType>::max());
+}
+
+
+template<typename T>
+void LightFieldTransformMode<T>::set_block_4D_at(const Block4D& block_4d,
+    const int channel, const LightfieldCoordinate<uint32_t>& coordinate_4d,
+    const int level_shift, const block4DElementType min_value,
+    const block4DElementType max_value) {
+  JPLM_STAGE_TIMER(block_scatter);
+  JPLM_STAGE_ITEMS(block_scatter, block_4d.get_number_of_elements());
   const auto& [t_initial, s_initial, v_initial, u_initial] = coordinate_4d;
-  const auto [t_max, s_max, v_max, u_max] =
-      coordinate_4d + block_4d.get_dimension();
-  auto c = 0;
-  for (auto t = t_initial; t < t_max; ++t) {
-    for (auto s = s_initial; s < s_max; ++s) {
-      if (this->is_coordinate_valid({t, s, v_initial, u_initial})) {
-        auto& image_channel = this->get_image_at({t, s}).get_channel(channel);
-        for (auto v = v_initial; v < v_max; ++v) {
-          for (auto u = u_initial; u < u_max; ++u) {
-            if (this->is_coordinate_valid({t, s, v, u})) {
-              image_channel[v][u] = block_4d.mPixelData[c++];
-            } else {
-              ++c;
-            }
-          }
-        }
-      } else {
-        for (auto v = v_initial; v < v_max; ++v) {
-          for (auto u = u_initial; u < u_max; ++u) {
-            ++c;
-          }
-        }
+  const auto [length_t, length_s, length_v, length_u] =
+      block_4d.get_dimension();
+  const auto [t_size, s_size, v_size, u_size] =
+      this->template get_dimensions<uint32_t>();
+
+  const auto valid_t =
+      get_number_of_samples_inside(t_initial, length_t, t_size);
+  const auto valid_s =
+      get_number_of_samples_inside(s_initial, length_s, s_size);
+  const auto valid_v =
+      get_number_of_samples_inside(v_initial, length_v, v_size);
+  const auto valid_u =
+      get_number_of_samples_inside(u_initial, length_u, u_size);
+
+  for (auto t = decltype(valid_t){0}; t < valid_t; ++t) {
+    for (auto s = decltype(valid_s){0}; s < valid_s; ++s) {
+      auto& image_channel =
+          this->get_image_at({t_initial + t, s_initial + s})
+              .get_channel(channel);
+      for (auto v = decltype(valid_v){0}; v < valid_v; ++v) {
+        scatter_row(image_channel[v_initial + v] + u_initial,
+            block_4d.mPixel[t][s][v], valid_u, level_shift, min_value,
+            max_value);
       }
     }
   }
@@ -0,0 +1,125 @@
+/* The copyright in this software is being made available under the BSD
+ * License, included below. This software may be subject to other third party
+ * and contributor rights, including patent rights, and no such rights are
+ * granted under this license.
+ *
+ * Copyright (c) 2010-2019, ITU/ISO/IEC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *  * Neither the name of the ITU/ISO/IEC nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** \file     SignificanceBoundingBox.h
+ *  \brief    Bounding box of the non-zero coefficients of a 4D block.
+ *  \details  Filled by the hexadeca-tree decoder while it decodes a
+ *            transform partition, it allows the inverse 4D DCT to skip the
+ *            lines that only carry zeros.
+ *  \date     2026-10-19
+ */
+
+#ifndef JPLM_LIB_PART2_COMMON_TRANSFORMMODE_SIGNIFICANCEBOUNDINGBOX_H__
+#define JPLM_LIB_PART2_COMMON_TRANSFORMMODE_SIGNIFICANCEBOUNDINGBOX_H__
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <limits>
+#include "Lib/Part2/Common/TransformMode/Block4D.h"
+
+
+class SignificanceBoundingBox {
+ protected:
+  std::array<uint32_t, 4> begin; /*!< first significant index (t, s, v, u) */
+  std::array<uint32_t, 4> end; /*!< last significant index + 1 (t, s, v, u) */
+
+ public:
+  SignificanceBoundingBox() {
+    reset();
+  }
+
+
+  ~SignificanceBoundingBox() = default;
+
+
+  /**
+   * \brief Box that contains all positions of a block with the given lengths
+   */
+  static SignificanceBoundingBox for_whole_block(uint32_t length_t,
+      uint32_t length_s, uint32_t length_v, uint32_t length_u) {
+    auto box = SignificanceBoundingBox();
+    box.add(0, 0, 0, 0);
+    box.add(length_t - 1, length_s - 1, length_v - 1, length_u - 1);
+    return box;
+  }
+
+
+  /**
+   * \brief Makes the box empty (i.e., no significant coefficient)
+   */
+  void reset() {
+    begin.fill(std::numeric_limits<uint32_t>::max());
+    end.fill(0);
+  }
+
+
+  /**
+   * \brief Grows the box so that it contains the position (t, s, v, u)
+   */
+  void add(uint32_t t, uint32_t s, uint32_t v, uint32_t u) {
+    const auto position = std::array<uint32_t, 4>{t, s, v, u};
+    for (auto i = std::size_t{0}; i < 4; ++i) {
+      begin[i] = std::min(begin[i], position[i]);
+      end[i] = std::max(end[i], position[i] + 1);
+    }
+  }
+
+
+  bool is_empty() const {
+    return end[LightFieldDimension::T] == 0;
+  }
+
+
+  /**
+   * \brief Checks if the only significant coefficient is the DC one
+   */
+  bool has_only_dc() const {
+    return std::all_of(begin.begin(), begin.end(),
+               [](auto value) { return value == 0; }) &&
+           std::all_of(
+               end.begin(), end.end(), [](auto value) { return value == 1; });
+  }
+
+
+  uint32_t get_begin(LightFieldDimension dimension) const {
+    return begin[dimension];
+  }
+
+
+  uint32_t get_end(LightFieldDimension dimension) const {
+    return end[dimension];
+  }
+};
+
+#endif /* end of include guard: JPLM_LIB_PART2_COMMON_TRANSFORMMODE_SIGNIFICANCEBOUNDINGBOX_H__ */
@@ -117,7 +117,6 @@ std::size_t Transformed4DBlock::get_energy() const {
 void Transformed4DBlock::alloc_temp() {
   auto max = std::max({mlength_u, mlength_v, mlength_s, mlength_t});
   temp = std::make_unique<block4DElementType[]>(max);
-  temp_double = std::make_unique<double[]>(max);
 }
 
 
@@ -125,13 +124,58 @@ void Transformed4DBlock::alloc_data() {
   if (!data) {
     data = std::make_unique<block4DElementType[]>(number_of_elements);
   }
-  data_double = std::make_unique<double[]>(number_of_elements);
 }
 
 
 void Transformed4DBlock::alloc_resources() {
   alloc_data();
   alloc_temp();
+  update_tracked_bytes();
+}
+
+
+void Transformed4DBlock::alloc_double_precision_resources() {
+  if (data_double) {
+    return;
+  }
+  auto max = std::max({mlength_u, mlength_v, mlength_s, mlength_t});
+  temp_double = std::make_unique<double[]>(max);
+  data_double = std::make_unique<double[]>(number_of_elements);
+  update_tracked_bytes();
+}
+
+
+void Transformed4DBlock::alloc_single_precision_resources() {
+  if (data_float) {
+    return;
+  }
+  auto max = std::max({mlength_u, mlength_v, mlength_s, mlength_t});
+  temp_float = std::make_unique<float[]>(max);
+  data_float = std::make_unique<float[]>(number_of_elements);
+  update_tracked_bytes();
+}
+
+
+void Transformed4DBlock::update_tracked_bytes() {
+  const auto max = static_cast<std::size_t>(
+      std::max({mlength_u, mlength_v, mlength_s, mlength_t}));
+  auto bytes = std::size_t{0};
+  if (data) {
+    bytes += number_of_elements * sizeof(block4DElementType);
+  }
+  if (data_double) {
+    bytes += number_of_elements * sizeof(double);
+  }
+  if (temp) {
+    bytes += max * sizeof(block4DElementType);
+  }
+  if (temp_double) {
+    bytes += max * sizeof(double);
+  }
+  if (data_float) {
+    bytes += number_of_elements * sizeof(float) + max * sizeof(float);
+  }
+  tracked_bytes.set(bytes);
 }
 
 
@@ -198,6 +242,8 @@ Transformed4DBlock::Transformed4DBlock(Transformed4DBlock&& other) {
       other.mlength_t, other.mlength_s, other.mlength_v, other.mlength_u);
   data = std::move(other.data);
   temp = std::move(other.temp);
+  update_tracked_bytes();
+  other.update_tracked_bytes();
 }
 
 
@@ -211,3 +257,16 @@ Block4D Transformed4DBlock::inverse(
   do_4d_transform(block.mPixelData, data.get(), coefficients, transform_gains);
   return block;
 }
+
+
+Block4D Transformed4DBlock::inverse(
+    const std::tuple<const double*, const double*, const double*, const double*>
+        coefficients,
+    const std::tuple<double, double, double, double> transform_gains,
+    const SignificanceBoundingBox& significant_region) {
+  Block4D block;
+  block.set_dimension(mlength_t, mlength_s, mlength_v, mlength_u);
+  do_4d_transform(block.mPixelData, data.get(), coefficients, transform_gains,
+      significant_region);
+  return block;
+}
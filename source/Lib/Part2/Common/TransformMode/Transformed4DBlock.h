@@ -50,23 +50,65 @@
 #include <memory>  //for unique_ptr, make_unique
 #include <numeric>  //for inner_product
 #include <tuple>
+#include <type_traits>
 #include <utility>
 #include "Block4D.h"
+#include "SeparableTransformKernels.h"
+#include "SignificanceBoundingBox.h"
+#include "Lib/Utils/Stats/MemoryAccounting.h"
 
 
 class Transformed4DBlock {
  private:
   std::unique_ptr<block4DElementType[]> temp;
-  std::unique_ptr<double[]> temp_double;
+  std::unique_ptr<double[]> temp_double; /*!< Allocated on the first use */
+  std::unique_ptr<float[]> temp_float; /*!< Allocated on the first use */
+  std::unique_ptr<float[]> data_float; /*!< Allocated on the first use */
+  MemoryAccounting::TrackedBytes tracked_bytes =
+      MemoryAccounting::TrackedBytes(MemoryAccounting::Category::blocks_4d);
 
   void alloc_temp();
   void alloc_data();
   void alloc_resources();
+  void alloc_double_precision_resources();
+  void alloc_single_precision_resources();
+  void update_tracked_bytes();
 
   void set_number_of_elements();
   void set_dimensions(uint32_t length_t, uint32_t length_s, uint32_t length_v,
       uint32_t length_u);
 
+
+  template<typename Sample>
+  void alloc_transform_resources() {
+    if constexpr (std::is_same_v<Sample, float>) {
+      alloc_single_precision_resources();
+    } else {
+      alloc_double_precision_resources();
+    }
+  }
+
+
+  template<typename Sample>
+  Sample* get_temp() {
+    if constexpr (std::is_same_v<Sample, float>) {
+      return temp_float.get();
+    } else {
+      return temp_double.get();
+    }
+  }
+
+
+  template<typename Sample>
+  Sample* get_data() {
+    if constexpr (std::is_same_v<Sample, float>) {
+      return data_float.get();
+    } else {
+      return data_double.get();
+    }
+  }
+
+
   /**
  * @brief This function makes a copy from elements in the 4D space to a temporary and linear array of elements.
  * @details [long description]
@@ -75,14 +117,15 @@ class Transformed4DBlock {
  * @param ptr_forward_stride How many elements to skip until finding the next one to be copied
  * @param num_elements The total number of elements to be copied
  */
-  void copy_values_to_temp(const double* ptr, std::size_t ptr_forward_stride,
+  template<typename Sample>
+  void copy_values_to_temp(const Sample* ptr, std::size_t ptr_forward_stride,
       std::size_t num_elements) {
+    auto temp_ptr = get_temp<Sample>();
     if (ptr_forward_stride == 1) {
       //can't use memcpy because temp is double and ptr is block4DElementType
-      std::copy(ptr, ptr + num_elements, temp_double.get());
+      std::copy(ptr, ptr + num_elements, temp_ptr);
     } else {
-      for (decltype(temp_double.get()) i = temp_double.get();
-           i < temp_double.get() + num_elements; ++i) {
+      for (auto i = temp_ptr; i < temp_ptr + num_elements; ++i) {
         *i = *ptr;
         ptr += ptr_forward_stride;
       }
@@ -95,36 +138,61 @@ class Transformed4DBlock {
       const double* coefficients, std::size_t max_a, std::size_t max_b,
       std::size_t max_c, std::size_t max_d, std::size_t stride_a,
       std::size_t stride_b, std::size_t stride_c, std::size_t stride_d) {
-    // std::cout << "weight: " << weight << std::endl;
-    auto temp_initial = temp_double.get();
-    auto temp_end = temp_initial + max_d;
-    auto total_a_stride = 0;
-    for (decltype(max_c) a = 0; a < max_a; ++a) {
-      auto total_b_stride = 0;
-      for (decltype(max_c) b = 0; b < max_b; ++b) {
-        auto stride = total_a_stride + total_b_stride;
-        for (decltype(max_c) c = 0; c < max_c; ++c) {
+    ranged_4d_separable_transform_in_1d(dest, src, weight, coefficients,
+        {0, max_a}, {0, max_b}, {0, max_c}, {0, max_d}, max_d, stride_a,
+        stride_b, stride_c, stride_d);
+  }
+
+
+  /**
+   * @brief Applies the 1D transform only to the lines inside the ranges of a, b and c.
+   * @details The lines outside of these ranges are expected to be all zeros
+   * (and are left untouched). Only the input elements in range_d take part in
+   * the inner products, as the remaining ones are zeros as well. Each range is
+   * given as [begin, end). When all inputs take part, the kernel specialized
+   * for the length is used, if there is one.
+   */
+  template<typename Sample>
+  void ranged_4d_separable_transform_in_1d(Sample* dest, const Sample* src,
+      Sample weight, const Sample* coefficients,
+      std::pair<std::size_t, std::size_t> range_a,
+      std::pair<std::size_t, std::size_t> range_b,
+      std::pair<std::size_t, std::size_t> range_c,
+      std::pair<std::size_t, std::size_t> range_d, std::size_t max_d,
+      std::size_t stride_a, std::size_t stride_b, std::size_t stride_c,
+      std::size_t stride_d) {
+    if ((range_d.first == 0) && (range_d.second == max_d)) {
+      if (auto kernel =
+              SeparableTransformKernels::get_kernel<Sample>(max_d)) {
+        kernel(dest, src, weight, coefficients, range_a, range_b, range_c,
+            stride_a, stride_b, stride_c, stride_d);
+        return;
+      }
+    }
+    const auto number_of_inputs = range_d.second - range_d.first;
+    auto temp_initial = get_temp<Sample>();
+    auto temp_end = temp_initial + number_of_inputs;
+    auto first_input = range_d.first * stride_d;
+    for (auto a = range_a.first; a < range_a.second; ++a) {
+      for (auto b = range_b.first; b < range_b.second; ++b) {
+        auto stride = a * stride_a + b * stride_b + range_c.first * stride_c;
+        for (auto c = range_c.first; c < range_c.second; ++c) {
           auto src_ptr = src + stride;
           auto dest_ptr = dest + stride;
-          copy_values_to_temp(src_ptr, stride_d, max_d);
-          for (decltype(max_c) d = 0; d < max_d; ++d) {
+          copy_values_to_temp(
+              src_ptr + first_input, stride_d, number_of_inputs);
+          auto coefficients_ptr = coefficients + range_d.first;
+          for (decltype(max_d) d = 0; d < max_d; ++d) {
             //when std::transform_reduce is available, it should be possible to
             //just swap std::inner_product by std::transform_reduce
-            *dest_ptr = weight *
-                std::inner_product(
-                    temp_initial,  //initial position of the original array
-                    temp_end,  //final position of the original array+1
-                    coefficients +
-                        d * max_d,  //initial position of the multiplication array (coefficients array)
-                    0.0  //initial sum value
-                    );
+            *dest_ptr = weight * std::inner_product(temp_initial, temp_end,
+                                     coefficients_ptr, Sample{0});
             dest_ptr += stride_d;
+            coefficients_ptr += max_d;
           }
           stride += stride_c;
         }
-        total_b_stride += stride_b;
       }
-      total_a_stride += stride_a;
     }
   }
 
@@ -138,7 +206,7 @@ class Transformed4DBlock {
   std::size_t number_of_elements;
   std::unique_ptr<block4DElementType[]>
       data; /*!< pointer to a linear array of transformed pixel data */
-  std::unique_ptr<double[]> data_double;
+  std::unique_ptr<double[]> data_double; /*!< Allocated on the first use */
   std::size_t get_number_of_elements() const;
   Transformed4DBlock(const Block4D& block);
 
@@ -150,60 +218,174 @@ class Transformed4DBlock {
           coefficients,
       const std::tuple<double, double, double, double> transform_weights =
           std::make_tuple(1.0, 1.0, 1.0, 1.0)) {
+    const auto whole_block = SignificanceBoundingBox::for_whole_block(
+        mlength_t, mlength_s, mlength_v, mlength_u);
+    do_4d_transform(dest, src, coefficients, transform_weights, whole_block);
+  }
+
+
+  /**
+   * @brief Performs the separable 4D transform of a block whose non-zero elements are all inside significant_region.
+   * @details Each 1D pass only transforms the lines that may hold non-zero
+   * values at that point, using only their non-zero inputs. When the only
+   * non-zero element is the DC one, its basis function is directly expanded.
+   * The results are exactly the same as the ones of the dense transform.
+   */
+  template<typename dest_t, typename src_t>
+  void do_4d_transform(dest_t* dest, const src_t* src,
+      const std::tuple<const double*, const double*, const double*,
+          const double*>
+          coefficients,
+      const std::tuple<double, double, double, double> transform_weights,
+      const SignificanceBoundingBox& significant_region) {
+    if (significant_region.is_empty()) {
+      std::fill(dest, dest + number_of_elements, dest_t{0});
+      return;
+    }
+
+    if (significant_region.has_only_dc()) {
+      do_dc_only_4d_transform(dest, static_cast<double>(*src), coefficients,
+          transform_weights);
+      return;
+    }
+
+    do_separable_4d_transform(
+        dest, src, coefficients, transform_weights, significant_region);
+  }
+
+
+  /**
+   * @brief Performs the separable 4D transform in single precision.
+   * @details The passes are the ones of the double precision transform, but
+   * computed with floats (thus twice as many of them fit in a vector). The
+   * result is only an approximation of the double precision one, that may
+   * differ by one in the rounding of some elements.
+   */
+  template<typename dest_t, typename src_t>
+  void do_single_precision_4d_transform(dest_t* dest, const src_t* src,
+      const std::tuple<const float*, const float*, const float*,
+          const float*>
+          coefficients,
+      const std::tuple<float, float, float, float> transform_weights) {
+    const auto whole_block = SignificanceBoundingBox::for_whole_block(
+        mlength_t, mlength_s, mlength_v, mlength_u);
+    do_separable_4d_transform(
+        dest, src, coefficients, transform_weights, whole_block);
+  }
+
+
+  /**
+   * @brief The four 1D passes (U, V, S, T) of the separable transform, with
+   * the intermediate values kept as Sample.
+   */
+  template<typename Sample, typename dest_t, typename src_t>
+  void do_separable_4d_transform(dest_t* dest, const src_t* src,
+      const std::tuple<const Sample*, const Sample*, const Sample*,
+          const Sample*>
+          coefficients,
+      const std::tuple<Sample, Sample, Sample, Sample> transform_weights,
+      const SignificanceBoundingBox& significant_region) {
+    using LF = LightFieldDimension;
+    alloc_transform_resources<Sample>();
+
     std::size_t stride_u = 1;
     std::size_t stride_v = mlength_u;
     std::size_t stride_s = mlength_v * mlength_u;
     std::size_t stride_t = mlength_s * stride_s;
 
-    using LF = LightFieldDimension;
-
-    auto data_double_ptr = data_double.get();
+    const auto values = get_data<Sample>();
+    auto values_ptr = values;
     for (decltype(number_of_elements) e = 0; e < number_of_elements; ++e) {
-      *(data_double_ptr++) = static_cast<double>(*(src++));
+      *(values_ptr++) = static_cast<Sample>(*(src++));
     }
 
+    auto range = [&significant_region](LF dimension) {
+      return std::make_pair<std::size_t, std::size_t>(
+          significant_region.get_begin(dimension),
+          significant_region.get_end(dimension));
+    };
+
     // //U, V, S, T
-    generic_4d_separable_transform_in_1d(data_double.get(),
-        data_double
-            .get(),  //using this function avoids performing an extra memcpy
+    ranged_4d_separable_transform_in_1d(values,
+        values,  //using this function avoids performing an extra memcpy
         std::get<LF::U>(transform_weights), std::get<LF::U>(coefficients),
-        mlength_t, mlength_s, mlength_v, mlength_u,  //max vals
+        range(LF::T), range(LF::S), range(LF::V), range(LF::U), mlength_u,
         stride_t,  //stride_a
         stride_s,  //stride_b
         stride_v,  //stride_c
         stride_u  //stride d
     );
 
-    generic_4d_separable_transform_in_1d(data_double.get(), data_double.get(),
+    ranged_4d_separable_transform_in_1d(values, values,
         std::get<LF::V>(transform_weights), std::get<LF::V>(coefficients),
-        mlength_t, mlength_s, mlength_u, mlength_v,
+        range(LF::T), range(LF::S), {0, mlength_u}, range(LF::V), mlength_v,
         stride_t,  //stride_a
         stride_s,  //stride_b
         stride_u,  //stride c
         stride_v  //stride_d
     );
 
-    generic_4d_separable_transform_in_1d(data_double.get(), data_double.get(),
+    ranged_4d_separable_transform_in_1d(values, values,
         std::get<LF::S>(transform_weights), std::get<LF::S>(coefficients),
-        mlength_t, mlength_v, mlength_u, mlength_s,
+        range(LF::T), {0, mlength_v}, {0, mlength_u}, range(LF::S), mlength_s,
         stride_t,  //stride_a
         stride_v,  //stride_b
         stride_u,  //stride c
         stride_s  //stride_d
     );
 
-    generic_4d_separable_transform_in_1d(data_double.get(), data_double.get(),
+    ranged_4d_separable_transform_in_1d(values, values,
         std::get<LF::T>(transform_weights), std::get<LF::T>(coefficients),
-        mlength_s, mlength_v, mlength_u, mlength_t,
+        {0, mlength_s}, {0, mlength_v}, {0, mlength_u}, range(LF::T),
+        mlength_t,
         stride_s,  //stride_a
         stride_v,  //stride_b
         stride_u,  //stride c
         stride_t  //stride_d
     );
 
-    data_double_ptr = data_double.get();
+    values_ptr = values;
     for (decltype(number_of_elements) e = 0; e < number_of_elements; ++e) {
-      *(dest++) = static_cast<dest_t>(std::round(*(data_double_ptr++)));
+      *(dest++) = static_cast<dest_t>(std::round(*(values_ptr++)));
+    }
+  }
+
+
+  /**
+   * @brief Transform of a block whose only non-zero element is the DC one.
+   * @details The operations (and their order) are the same ones performed
+   * by the separable passes, so that the result is bit exact.
+   */
+  template<typename dest_t>
+  void do_dc_only_4d_transform(dest_t* dest, double dc,
+      const std::tuple<const double*, const double*, const double*,
+          const double*>
+          coefficients,
+      const std::tuple<double, double, double, double> transform_weights) {
+    const auto [weight_t, weight_s, weight_v, weight_u] = transform_weights;
+    const auto [coefficients_t, coefficients_s, coefficients_v,
+        coefficients_u] = coefficients;
+    alloc_double_precision_resources();
+
+    auto u_line = temp_double.get();
+    for (auto u = decltype(mlength_u){0}; u < mlength_u; ++u) {
+      u_line[u] = weight_u * (dc * coefficients_u[u * mlength_u]);
+    }
+
+    for (auto t = decltype(mlength_t){0}; t < mlength_t; ++t) {
+      const auto coefficient_t = coefficients_t[t * mlength_t];
+      for (auto s = decltype(mlength_s){0}; s < mlength_s; ++s) {
+        const auto coefficient_s = coefficients_s[s * mlength_s];
+        for (auto v = decltype(mlength_v){0}; v < mlength_v; ++v) {
+          const auto coefficient_v = coefficients_v[v * mlength_v];
+          for (auto u = decltype(mlength_u){0}; u < mlength_u; ++u) {
+            auto value = weight_v * (u_line[u] * coefficient_v);
+            value = weight_s * (value * coefficient_s);
+            value = weight_t * (value * coefficient_t);
+            *(dest++) = static_cast<dest_t>(std::round(value));
+          }
+        }
+      }
     }
   }
 
@@ -238,6 +420,12 @@ class Transformed4DBlock {
                       coefficients,
       const std::tuple<double, double, double, double> transform_gains);
 
+  Block4D inverse(const std::tuple<const double*, const double*, const double*,
+                      const double*>
+                      coefficients,
+      const std::tuple<double, double, double, double> transform_gains,
+      const SignificanceBoundingBox& significant_region);
+
   Block4D generate_copy_in_block() const;
 
 
@@ -44,6 +44,8 @@
 #include <type_traits>  //is_integral
 #include "Lib/Part2/Common/CommonExceptions.h"
 #include "Lib/Utils/Image/ThreeChannelImage.h"
+#include "Lib/Utils/Stats/StageInstrumentation.h"
+#include "Lib/Utils/Stats/TraceEvents.h"
 
 template<typename T>
 class View {
@@ -130,6 +132,16 @@ class View {
   }
 
 
+  /**
+   * @brief      Checks whether the image may be released and loaded again
+   *             later without losing its samples (i.e., it is backed by
+   *             storage that is written when the image is saved)
+   */
+  virtual bool is_image_reloadable() const {
+    return false;
+  }
+
+
   View(View<T>&& other) noexcept {
     *this = std::move(other);
   }
@@ -269,6 +281,8 @@ class View {
 
   void load_image() const {
     // std::cout << "load image with size " << std::get<0>(this->view_size) << "x" << std::get<1>(this->view_size) << '\n';
+    JPLM_STAGE_TIMER(view_loading);
+    const auto event = TraceEvents::ScopedEvent("view_load", "io");
     load_image(this->view_size);
   }
 };
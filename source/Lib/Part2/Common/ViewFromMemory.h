@@ -0,0 +1,127 @@
+/* The copyright in this software is being made available under the BSD
+ * License, included below. This software may be subject to other third party
+ * and contributor rights, including patent rights, and no such rights are
+ * granted under this license.
+ *
+ * Copyright (c) 2010-2019, ITU/ISO/IEC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *  * Neither the name of the ITU/ISO/IEC nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** \file     ViewFromMemory.h
+ *  \brief    View whose samples are provided by the caller's memory
+ *  \details  The image of the view is obtained from (and delivered to) a
+ *            LightfieldMemoryIO, which may be shared by all views of the light
+ *            field.
+ *  \date     2026-10-19
+ */
+
+#ifndef JPLM_LIB_PART2_COMMON_VIEWFROMMEMORY_H__
+#define JPLM_LIB_PART2_COMMON_VIEWFROMMEMORY_H__
+
+#include <memory>
+#include "Lib/Part2/Common/LightfieldMemoryIO.h"
+#include "Lib/Part2/Common/View.h"
+#include "Lib/Utils/Image/UndefinedImage.h"
+
+template<typename T>
+class ViewFromMemory : public View<T> {
+ protected:
+  std::shared_ptr<LightfieldMemoryIO<T>> memory_io;
+  const std::pair<std::size_t, std::size_t> position;
+
+ public:
+  /**
+   * @brief      Constructs a new instance.
+   *
+   * @param[in]  memory_io  The light field in memory holding the view
+   * @param[in]  position   The position (t, s) of the view
+   */
+  ViewFromMemory(const std::shared_ptr<LightfieldMemoryIO<T>>& memory_io,
+      const std::pair<std::size_t, std::size_t>& position)
+      : View<T>(), memory_io(memory_io), position(position) {
+    const auto& dimension = memory_io->get_dimension();
+    this->view_size = {dimension.get_u(), dimension.get_v()};
+    this->bpp = memory_io->get_bits_per_sample();
+  }
+
+
+  ViewFromMemory(const ViewFromMemory& other)
+      : View<T>(other), memory_io(other.memory_io), position(other.position) {
+  }
+
+
+  virtual ViewFromMemory<T>* clone() const override {
+    return new ViewFromMemory<T>(*this);
+  }
+
+
+  ViewFromMemory(ViewFromMemory&& other) noexcept
+      : View<T>(std::move(other)), memory_io(std::move(other.memory_io)),
+        position(other.position) {
+  }
+
+
+  void load_image(const std::pair<std::size_t, std::size_t>& size,
+      const std::pair<std::size_t, std::size_t>& initial = {
+          0, 0}) const override {
+    const auto& [i, j] = initial;
+    if ((i == 0) && (j == 0) && (size == this->view_size)) {
+      auto image = std::make_unique<UndefinedImage<T>>(
+          std::get<0>(this->view_size), std::get<1>(this->view_size),
+          this->bpp, memory_io->get_number_of_channels());
+      //a write-only view (decoder side) starts with an uninitialized image
+      if (memory_io->has_view_reader()) {
+        memory_io->read_view(position, *image);
+      }
+      this->image_ = std::move(image);
+    } else {
+      //loads image patch
+    }
+  }
+
+
+  virtual void write_image(
+      [[maybe_unused]] const bool overwrite_file = false) override {
+    if (this->image_) {
+      memory_io->write_view(position, *(this->image_));
+    }
+  }
+
+
+  /**
+   * @brief      Only views that are read from memory may be loaded again
+   *             (written views are handed over to the writer)
+   */
+  virtual bool is_image_reloadable() const override {
+    return memory_io->has_view_reader();
+  }
+
+
+  virtual ~ViewFromMemory() = default;
+};
+
+#endif /* end of include guard: JPLM_LIB_PART2_COMMON_VIEWFROMMEMORY_H__ */
@@ -190,6 +190,11 @@ class ViewFromPGXFile : public View<T> {
     }
   }
 
+  virtual bool is_image_reloadable() const override {
+    return true;
+  }
+
+
   virtual ~ViewFromPGXFile() = default;
 };
 
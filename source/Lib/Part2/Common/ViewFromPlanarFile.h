@@ -0,0 +1,123 @@
+/* The copyright in this software is being made available under the BSD
+ * License, included below. This software may be subject to other third party
+ * and contributor rights, including patent rights, and no such rights are
+ * granted under this license.
+ *
+ * Copyright (c) 2010-2019, ITU/ISO/IEC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *  * Neither the name of the ITU/ISO/IEC nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** \file     ViewFromPlanarFile.h
+ *  \brief    View whose samples are stored in a planar light-field file
+ *  \details  The image of the view is read from (and written to) its planes in
+ *            a PlanarLightfieldFile, which may be shared by all views of the
+ *            light field.
+ *  \date     2026-10-19
+ */
+
+#ifndef JPLM_LIB_PART2_COMMON_VIEWFROMPLANARFILE_H__
+#define JPLM_LIB_PART2_COMMON_VIEWFROMPLANARFILE_H__
+
+#include <memory>
+#include "Lib/Part2/Common/PlanarLightfieldFile.h"
+#include "Lib/Part2/Common/View.h"
+#include "Lib/Utils/Image/UndefinedImage.h"
+
+template<typename T>
+class ViewFromPlanarFile : public View<T> {
+ protected:
+  std::shared_ptr<PlanarLightfieldFile> planar_file;
+  const std::pair<std::size_t, std::size_t> position;
+
+ public:
+  /**
+   * @brief      Constructs a new instance.
+   *
+   * @param[in]  planar_file  The planar light-field file holding the view
+   * @param[in]  position     The position (t, s) of the view in the file
+   */
+  ViewFromPlanarFile(const std::shared_ptr<PlanarLightfieldFile>& planar_file,
+      const std::pair<std::size_t, std::size_t>& position)
+      : View<T>(), planar_file(planar_file), position(position) {
+    const auto& dimension = planar_file->get_dimension();
+    this->view_size = {dimension.get_u(), dimension.get_v()};
+    this->bpp = planar_file->get_bits_per_sample();
+  }
+
+
+  ViewFromPlanarFile(const ViewFromPlanarFile& other)
+      : View<T>(other), planar_file(other.planar_file),
+        position(other.position) {
+  }
+
+
+  virtual ViewFromPlanarFile<T>* clone() const override {
+    return new ViewFromPlanarFile<T>(*this);
+  }
+
+
+  ViewFromPlanarFile(ViewFromPlanarFile&& other) noexcept
+      : View<T>(std::move(other)), planar_file(std::move(other.planar_file)),
+        position(other.position) {
+  }
+
+
+  void load_image(const std::pair<std::size_t, std::size_t>& size,
+      const std::pair<std::size_t, std::size_t>& initial = {
+          0, 0}) const override {
+    const auto& [i, j] = initial;
+    if ((i == 0) && (j == 0) && (size == this->view_size)) {
+      auto image = std::make_unique<UndefinedImage<T>>(
+          std::get<0>(this->view_size), std::get<1>(this->view_size),
+          this->bpp, planar_file->get_number_of_channels());
+      const auto& [t, s] = position;
+      planar_file->read_view(t, s, *image);
+      this->image_ = std::move(image);
+    } else {
+      //loads image patch
+    }
+  }
+
+
+  virtual void write_image(
+      [[maybe_unused]] const bool overwrite_file = false) override {
+    if (this->image_) {
+      const auto& [t, s] = position;
+      planar_file->write_view(t, s, *(this->image_));
+    }
+  }
+
+
+  virtual bool is_image_reloadable() const override {
+    return true;
+  }
+
+
+  virtual ~ViewFromPlanarFile() = default;
+};
+
+#endif /* end of include guard: JPLM_LIB_PART2_COMMON_VIEWFROMPLANARFILE_H__ */
@@ -42,18 +42,36 @@
 #define JPLM_LIB_PART2_COMMON_VIEWIOPOLICY_H__
 
 
+#include <vector>
 #include "Lib/Part2/Common/CommonExceptions.h"
 #include "Lib/Part2/Common/View.h"
 #include "Lib/Utils/Image/Image.h"
 #include "Lib/Utils/Image/ImageColorSpacesConversor.h"
+#include "Lib/Utils/Parallel/ParallelFor.h"
+#include "Lib/Utils/Stats/StageInstrumentation.h"
+#include "Lib/Utils/Stats/TraceEvents.h"
 
 
 template<typename T>
 class ViewIOPolicy {
  protected:
   virtual void load_image_if_necessary(View<T>& view) = 0;
+
+
+  /**
+   * @brief      Accounts for a view whose image was loaded by preload_images
+   *
+   * @details    The default does nothing: the view is accounted for when it is
+   *             accessed. Policies that keep track of the loaded views
+   *             override it.
+   */
+  virtual void register_preloaded_image([[maybe_unused]] View<T>& view) {
+  }
+
+
   bool save_image_when_release = false;
   bool overwrite_image_when_save_if_file_already_exists = false;
+  std::size_t number_of_loading_threads = 1;
 
  public:
   ViewIOPolicy() = default;
@@ -65,7 +83,8 @@ class ViewIOPolicy {
   ViewIOPolicy(ViewIOPolicy<T>&& other)
       : save_image_when_release(other.save_image_when_release),
         overwrite_image_when_save_if_file_already_exists(
-            other.overwrite_image_when_save_if_file_already_exists) {
+            other.overwrite_image_when_save_if_file_already_exists),
+        number_of_loading_threads(other.number_of_loading_threads) {
   }
 
 
@@ -85,6 +104,58 @@ class ViewIOPolicy {
   }
 
 
+  /**
+   * @brief      Sets the number of threads used by preload_images
+   *
+   * @param[in]  number_of_threads  The number of threads (0 for one per
+   *                                hardware thread)
+   */
+  ViewIOPolicy& set_number_of_loading_threads(std::size_t number_of_threads) {
+    number_of_loading_threads = number_of_threads;
+    return *this;
+  }
+
+
+  std::size_t get_number_of_loading_threads() const noexcept {
+    return number_of_loading_threads;
+  }
+
+
+  /**
+   * @brief      Loads the images of the views concurrently
+   *
+   * @details    Views that already have an image are skipped. Each view is
+   *             loaded by a single thread, so views must not share their
+   *             underlying files. After loading, the views are registered in
+   *             the policy in the given order, so a policy that limits the
+   *             number of loaded views may release the first ones if more
+   *             views than its limit are preloaded.
+   *
+   * @param[in]  views              The views
+   * @param[in]  number_of_threads  The maximum number of loading threads
+   */
+  void preload_images(
+      const std::vector<View<T>*>& views, std::size_t number_of_threads) {
+    std::vector<View<T>*> views_to_load;
+    views_to_load.reserve(views.size());
+    for (auto* view : views) {
+      if (!view->has_image()) {
+        views_to_load.push_back(view);
+      }
+    }
+    Parallel::parallel_for(0, views_to_load.size(), number_of_threads,
+        [&views_to_load](auto i) { views_to_load[i]->load_image(); });
+    for (auto* view : views_to_load) {
+      register_preloaded_image(*view);
+    }
+  }
+
+
+  void preload_images(const std::vector<View<T>*>& views) {
+    preload_images(views, number_of_loading_threads);
+  }
+
+
   virtual T get_value_at(View<T>& view, const std::size_t channel,
       const std::pair<std::size_t, std::size_t>& coordinate) {
     load_image_if_necessary(view);
@@ -115,11 +186,14 @@ class ViewIOPolicy {
 
 
   void save_image(View<T>& view) {
+    JPLM_STAGE_TIMER(output);
+    const auto event = TraceEvents::ScopedEvent("view_save", "io");
     view.write_image(overwrite_image_when_save_if_file_already_exists);
   }
 
 
   void release_image_from_view(View<T>& view) {
+    const auto event = TraceEvents::ScopedEvent("view_release", "io");
     if (save_image_when_release) {
       this->save_image(view);
     }
@@ -42,6 +42,7 @@
 #define JPLM_LIB_PART2_COMMON_VIEWIOPOLICYLIMITEDMEMORY_H__
 
 #include "Lib/Part2/Common/ViewIOPolicyQueue.h"
+#include "Lib/Utils/Stats/MemoryAccounting.h"
 
 
 template<typename T>
@@ -62,7 +63,24 @@ class ViewIOPolicyLimitedMemory : public ViewIOPolicyQueue<T> {
       }
       this->queue.push_back(&view);
       // this->set.insert(&view);
-      view.load_image();
+      if (!view.has_image()) {
+        view.load_image();
+      }
+      release_views_while_over_budget();
+    }
+  }
+
+
+  /**
+   * @brief      Releases the least accessed views (keeping the current one)
+   *             while the global budget of MemoryAccounting is exceeded
+   */
+  void release_views_while_over_budget() {
+    while (this->queue.size() > 1 && MemoryAccounting::is_over_budget()) {
+      auto expected_number_of_bytes =
+          this->queue.front()->get_number_of_pixels() * 3 * sizeof(T);
+      this->release_view_image();
+      current_bytes -= std::min(current_bytes, expected_number_of_bytes);
     }
   }
 
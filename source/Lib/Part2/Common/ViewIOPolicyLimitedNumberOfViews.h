@@ -59,7 +59,9 @@ class ViewIOPolicyLimitedNumberOfViews : public ViewIOPolicyQueue<T> {
       }
       this->queue.push_back(&view);
       this->set.insert(&view);
-      view.load_image();
+      if (!view.has_image()) {
+        view.load_image();
+      }
     }
   }
 
@@ -41,17 +41,68 @@
 #ifndef JPLM_LIB_PART2_COMMON_VIEWIOPOLICYLIMITLESSMEMORY_H__
 #define JPLM_LIB_PART2_COMMON_VIEWIOPOLICYLIMITLESSMEMORY_H__
 
+#include <deque>
 #include "Lib/Part2/Common/ViewIOPolicy.h"
+#include "Lib/Utils/Stats/MemoryAccounting.h"
 
+
+/**
+ * @brief      Keeps every loaded view in memory, unless a global memory
+ *             budget is set (MemoryAccounting::set_budget) and exceeded
+ *
+ * @details    Under a budget, the views whose images can be loaded again
+ *             (View::is_image_reloadable) are released in the order they were
+ *             loaded (the last loaded one is always kept) until the tracked
+ *             memory fits the budget again. Released views are loaded again
+ *             when accessed.
+ */
 template<typename T>
 class ViewIOPolicyLimitlessMemory : public ViewIOPolicy<T> {
  protected:
+  std::deque<View<T>*> loaded_views;
+
+
+  void release_views_while_over_budget() {
+    while (loaded_views.size() > 1 && MemoryAccounting::is_over_budget()) {
+      auto* view = loaded_views.front();
+      loaded_views.pop_front();
+      if (view->has_image()) {
+        this->release_image_from_view(*view);
+      }
+    }
+  }
+
+
+  void register_loaded_image(View<T>& view) {
+    if (MemoryAccounting::has_budget() && view.is_image_reloadable()) {
+      loaded_views.push_back(&view);
+      release_views_while_over_budget();
+    }
+  }
+
+
   void load_image_if_necessary(View<T>& view) override {
-    if (!view.has_image())
+    if (!view.has_image()) {
       view.load_image();
+      register_loaded_image(view);
+    }
+  }
+
+
+  void register_preloaded_image(View<T>& view) override {
+    register_loaded_image(view);
   }
 
  public:
+  ViewIOPolicyLimitlessMemory() = default;
+
+
+  ViewIOPolicyLimitlessMemory(const ViewIOPolicyLimitlessMemory<T>& other)
+      : ViewIOPolicy<T>(other) {
+    //the views loaded by other are not owned by the clone
+  }
+
+
   virtual ViewIOPolicyLimitlessMemory<T>* clone() const override {
     return new ViewIOPolicyLimitlessMemory(*this);
   }
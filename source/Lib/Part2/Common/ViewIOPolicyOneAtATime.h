@@ -64,7 +64,9 @@ class ViewIOPolicyOneAtATime : public ViewIOPolicy<T> {
     if (last != nullptr && last != &view) {
       this->release_image_from_view(*last);
     }
-    view.load_image();
+    if (!view.has_image()) {
+      view.load_image();
+    }
     last = &view;
   }
 
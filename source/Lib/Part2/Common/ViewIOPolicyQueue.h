@@ -75,6 +75,14 @@ class ViewIOPolicyQueue : public ViewIOPolicy<T> {
     }
   }
 
+
+  /**
+   * @brief      Enqueues a preloaded view (may release the least accessed one)
+   */
+  void register_preloaded_image(View<T>& view) override {
+    this->load_image_if_necessary(view);
+  }
+
   public:
   virtual ViewIOPolicyQueue<T>* clone() const = 0;
 
@@ -45,7 +45,8 @@
 #include "Lib/Part2/Decoder/TransformMode/MarkerSegmentHelper.h"
 
 namespace ColourComponentScalingMarkerSegmentParser {
-ColourComponentScalingMarkerSegment get_colour_component_scaling_marker_segment(
+inline ColourComponentScalingMarkerSegment
+get_colour_component_scaling_marker_segment(
     const ContiguousCodestreamCode& codestream_code) {
   auto SLscc_from_codestream_code =
       MarkerSegmentHelper::get_next<uint8_t>(codestream_code);
@@ -63,6 +63,24 @@ class ExpectingAMarkerException : public std::exception {
     return message.c_str();
   }
 };
+
+
+class InvalidTransformSizeException : public std::exception {
+ protected:
+  std::string message;
+
+ public:
+  InvalidTransformSizeException(
+      uint32_t transform_size, uint32_t maximal_supported_size)
+      : message(std::string("Invalid transform size ") +
+                std::to_string(transform_size) +
+                " in the codestream (it must be between 1 and " +
+                std::to_string(maximal_supported_size) + ")") {
+  }
+  const char* what() const noexcept override {
+    return message.c_str();
+  }
+};
 }  // namespace JPLM4DTransformModeLightFieldDecoderExceptions
 
 
@@ -56,8 +56,12 @@ void Hierarchical4DDecoder::decode_block(int position_t, int position_s,
 
   if (length_t * length_s * length_v * length_u ==
       1) {  //perhaps & instead of *?
-    mSubbandLF.mPixel[position_t][position_s][position_v][position_u] =
-        decode_coefficient(bitplane);
+    auto coefficient = decode_coefficient(bitplane);
+    if (coefficient != 0) {
+      mSubbandLF.mPixel[position_t][position_s][position_v][position_u] =
+          coefficient;
+      significant_region.add(position_t, position_s, position_v, position_u);
+    }
     return;
   }
 
@@ -104,19 +108,9 @@ void Hierarchical4DDecoder::decode_block(int position_t, int position_s,
       }
       break;
     }
-    case HexadecaTreeFlag::zeroBlock: {
-      for (auto t = 0; t < length_t; ++t) {
-        for (auto s = 0; s < length_s; ++s) {
-          for (auto v = 0; v < length_v; ++v) {
-            for (auto u = 0; u < length_u; ++u) {
-              mSubbandLF.mPixel[position_t + t][position_s + s][position_v + v]
-                               [position_u + u] = 0;
-            }
-          }
-        }
-      }
+    case HexadecaTreeFlag::zeroBlock:
+      //the block was already filled with zeros
       break;
-    }
     default:
       std::cerr << "Invalid segmentation flag." << std::endl;
       exit(3);
@@ -141,9 +135,17 @@ int Hierarchical4DDecoder::decode_coefficient(int bitplane) {
       ++magnitude;
     }
   }
-  magnitude = magnitude << inferior_bit_plane;
+  //the sign is coded for every non-zero magnitude, even if it is truncated
+  const auto has_sign = magnitude > 0;
+  const int reconstruction_bit_plane = std::min(
+      std::max(inferior_bit_plane, minimum_reconstruction_bit_plane),
+      MAXIMUM_RECONSTRUCTION_BIT_PLANE);
+  magnitude = (magnitude >> (reconstruction_bit_plane - inferior_bit_plane))
+              << reconstruction_bit_plane;
   if (magnitude > 0) {
-    magnitude += (1 << inferior_bit_plane) / 2;
+    magnitude += (1 << reconstruction_bit_plane) / 2;
+  }
+  if (has_sign) {
     if (entropy_decoder.decode_bit(probability_models[0])) {
       magnitude = -magnitude;
     }
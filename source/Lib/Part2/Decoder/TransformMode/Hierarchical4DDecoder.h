@@ -44,18 +44,25 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <algorithm>
 #include <iostream>
 #include "Lib/Part2/Common/TransformMode/Hierarchical4DCodec.h"
 #include "Lib/Part2/Common/TransformMode/ProbabilityModel.h"
+#include "Lib/Part2/Common/TransformMode/SignificanceBoundingBox.h"
 #include "Lib/Part2/Decoder/TransformMode/ABACDecoder.h"
 
 
 class Hierarchical4DDecoder : public Hierarchical4DCodec {
  private:
+  static constexpr uint8_t MAXIMUM_RECONSTRUCTION_BIT_PLANE = 30;
   HexadecaTreeFlag decode_segmentation_flag(int bitplane);
 
   int decode_coefficient(int bitplane);
 
+ protected:
+  SignificanceBoundingBox significant_region;
+  uint8_t minimum_reconstruction_bit_plane = 0;
+
  public:
   ABACDecoder entropy_decoder;
 
@@ -71,10 +78,43 @@ class Hierarchical4DDecoder : public Hierarchical4DCodec {
 
   virtual ~Hierarchical4DDecoder() = default;
 
+  /**
+   * \brief Decodes the coefficients of a block into mSubbandLF.
+   * \details mSubbandLF is expected to be filled with zeros, as zero blocks
+   *          are not written. The positions of the decoded non-zero
+   *          coefficients are accumulated in the significant region.
+   */
   void decode_block(int position_t, int position_s, int position_v,
       int position_u, int length_t, int length_s, int length_v, int length_u,
       int bitplane);
 
+
+  /**
+   * \brief Sets the lowest bit plane used to reconstruct the coefficients.
+   * \details Bit planes below it (and above the inferior bit plane) are
+   *          still decoded, as the hexadeca-tree is coded depth first, but
+   *          they are discarded and replaced by a mid-interval reconstruction
+   *          offset. A value not above the inferior bit plane has no effect.
+   */
+  void set_minimum_reconstruction_bit_plane(uint8_t value) {
+    minimum_reconstruction_bit_plane = value;
+  }
+
+
+  uint8_t get_minimum_reconstruction_bit_plane() const {
+    return minimum_reconstruction_bit_plane;
+  }
+
+
+  void reset_significant_region() {
+    significant_region.reset();
+  }
+
+
+  const SignificanceBoundingBox& get_significant_region() const {
+    return significant_region;
+  }
+
   PartitionFlag decode_partition_flag();
 
   int decode_integer(int precision);
@@ -81,40 +81,76 @@ class JPLM4DTransformModeLightFieldDecoder
   // const JPLFile&
   //     transform_mode_jpl_file;  //temporary, need to refactor to use base class jpl file...
  public:
+  /**
+   * \brief      Gets the light field header contents of a light field box
+   */
+  static const LightFieldHeaderContents& get_light_field_header_contents(
+      const JpegPlenoLightFieldBox& light_field_box) {
+    return light_field_box.get_ref_to_contents()
+        .get_ref_to_light_field_header_box()
+        .get_ref_to_contents()
+        .get_ref_to_light_field_header_box()
+        .get_ref_to_contents();
+  }
+
+
+  /**
+   * \brief      Gets the dimension of the decoded light field, i.e., the
+   *             dimension in the header divided by the downscale factors
+   *             (rounding up) of the configuration.
+   */
+  static LightfieldDimension<std::size_t> get_decoded_light_field_dimension(
+      const JpegPlenoLightFieldBox& light_field_box,
+      const JPLMDecoderConfiguration& configuration) {
+    const auto [t, s, v, u] = get_light_field_header_contents(light_field_box)
+                                  .get_light_field_dimension<std::size_t>()
+                                  .as_tuple();
+    auto downscale = [](std::size_t length, std::size_t factor) {
+      return (length + factor - 1) / factor;
+    };
+    const auto views_factor = configuration.get_views_downscale_factor();
+    const auto factor = configuration.get_downscale_factor();
+    return {downscale(t, views_factor), downscale(s, views_factor),
+        downscale(v, factor), downscale(u, factor)};
+  }
+
+
   JPLM4DTransformModeLightFieldDecoder(
       std::shared_ptr<JPLFile>
           jpl_file,  // ! \todo use this as the JPLCodec file
       const JpegPlenoLightFieldBox& light_field_box,
       const std::string& lightfield_path,
       std::shared_ptr<JPLMDecoderConfiguration> configuration)
-      : JPLMLightFieldCodec<PelType>(jpl_file,
+      : JPLM4DTransformModeLightFieldDecoder(jpl_file, light_field_box,
             std::make_unique<LightFieldTransformMode<PelType>>(
                 LightfieldIOConfiguration(lightfield_path,
-                    light_field_box.get_ref_to_contents()
-                        .get_ref_to_light_field_header_box()
-                        .get_ref_to_contents()
-                        .get_ref_to_light_field_header_box()
-                        .get_ref_to_contents()
-                        .get_light_field_dimension<std::size_t>()),
-                light_field_box.get_ref_to_contents()
-                    .get_ref_to_light_field_header_box()
-                    .get_ref_to_contents()
-                    .get_ref_to_light_field_header_box()
-                    .get_ref_to_contents()
+                    get_decoded_light_field_dimension(
+                        light_field_box, *configuration)),
+                get_light_field_header_contents(light_field_box)
                     .get_number_of_components(),
-                light_field_box.get_ref_to_contents()
-                    .get_ref_to_light_field_header_box()
-                    .get_ref_to_contents()
-                    .get_ref_to_light_field_header_box()
-                    .get_ref_to_contents()
+                get_light_field_header_contents(light_field_box)
                     .get_bits_per_component()),
-            *configuration),
+            configuration) {
+  }
+
+
+  /**
+   * \brief      Constructs a new instance that decodes to the given light field
+   *
+   * \param[in]  jpl_file         The jpl file
+   * \param[in]  light_field_box  The light field box to be decoded
+   * \param      light_field      The decoded light field, e.g., with views in
+   *                              memory
+   * \param[in]  configuration    The configuration
+   */
+  JPLM4DTransformModeLightFieldDecoder(std::shared_ptr<JPLFile> jpl_file,
+      const JpegPlenoLightFieldBox& light_field_box,
+      std::unique_ptr<LightFieldTransformMode<PelType>>&& light_field,
+      std::shared_ptr<JPLMDecoderConfiguration> configuration)
+      : JPLMLightFieldCodec<PelType>(
+            jpl_file, std::move(light_field), *configuration),
         JPLM4DTransformModeLightFieldCodec<PelType>(
-            light_field_box.get_ref_to_contents()
-                .get_ref_to_light_field_header_box()
-                .get_ref_to_contents()
-                .get_ref_to_light_field_header_box()
-                .get_ref_to_contents()
+            get_light_field_header_contents(light_field_box)
                 .get_light_field_dimension(),
             {9, 9, 64, 64},
             *configuration),  //temporary
@@ -129,9 +165,10 @@ class JPLM4DTransformModeLightFieldDecoder
         ref_to_lightfield(static_cast<LightFieldTransformMode<PelType>&>(
             *(this->light_field))) {
     read_initial_data_from_codestream_code();
-    this->setup_transform_coefficients(false,
+    this->setup_transform_coefficients(
         hierarchical_4d_decoder.get_transform_dimensions(),
         {1.0, 1.0, 1.0, 1.0});
+    partition_decoder.set_dct_coefficients(this->dct_coefficients.get());
 
     // std::cout << "dec LF dimension: " << light_field_box.get_ref_to_contents()
     //                     .get_ref_to_light_field_header_box()
@@ -143,6 +180,14 @@ class JPLM4DTransformModeLightFieldDecoder
     //initializes possible extension lengths
     this->initialize_extension_lengths();
 
+    const auto views_downscale_factor =
+        configuration->get_views_downscale_factor();
+    const auto downscale_factor = configuration->get_downscale_factor();
+    partition_decoder.set_downscale_factors({views_downscale_factor,
+        views_downscale_factor, downscale_factor, downscale_factor});
+    hierarchical_4d_decoder.set_minimum_reconstruction_bit_plane(
+        configuration->get_minimum_reconstruction_bit_plane());
+
     auto& view_io_policy = ref_to_lightfield.get_ref_to_view_io_policy();
     view_io_policy.set_save_image_when_release(true)
         .set_overwrite_image_when_save_if_file_already_exists(true);
@@ -256,6 +301,17 @@ class JPLM4DTransformModeLightFieldDecoder
                     transform_length_u] =
         lightfield_configuration_marker_segment.get_ref_to_block_dimension()
             .as_tuple();
+    //checked before the transform coefficients are allocated for them
+    for (const auto transform_length : {transform_length_t, transform_length_s,
+             transform_length_v, transform_length_u}) {
+      if ((transform_length == 0) ||
+          (transform_length >
+              DCT4DCoefficientsRegistry::maximal_supported_size)) {
+        throw JPLM4DTransformModeLightFieldDecoderExceptions::
+            InvalidTransformSizeException(transform_length,
+                DCT4DCoefficientsRegistry::maximal_supported_size);
+      }
+    }
     hierarchical_4d_decoder.set_transform_dimension(
         lightfield_configuration_marker_segment.get_ref_to_block_dimension());
 
@@ -339,16 +395,18 @@ class JPLM4DTransformModeLightFieldDecoder
     hierarchical_4d_decoder.reset_probability_models();
 
     auto decoded_block = partition_decoder.decode_partition(
-        channel, hierarchical_4d_decoder, size);
+        channel, hierarchical_4d_decoder, position, size);
 
+    if (decoded_block.get_number_of_elements() == 0) {
+      //happens when downscaling blocks smaller than the downscale factor
+      return;
+    }
 
     int level_shift = (hierarchical_4d_decoder.get_level_shift() + 1) / 2;
-    decoded_block += level_shift;
-
-
-    decoded_block.clip(0, hierarchical_4d_decoder.get_level_shift());
 
-    ref_to_lightfield.set_block_4D_at(decoded_block, channel, position);
+    ref_to_lightfield.set_block_4D_at(decoded_block, channel,
+        partition_decoder.get_downscaled_position(position), level_shift, 0,
+        hierarchical_4d_decoder.get_level_shift());
   }
 };
 
@@ -46,7 +46,7 @@
 
 
 namespace LightFieldContigurationMarkerSegmentParser {
-LightFieldConfigurationMarkerSegment
+inline LightFieldConfigurationMarkerSegment
 get_light_field_configuration_marker_segment(
     const ContiguousCodestreamCode& codestream_code) {
   [[maybe_unused]] auto SLlfc_from_codestream_code =
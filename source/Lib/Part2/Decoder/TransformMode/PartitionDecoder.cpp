@@ -45,12 +45,44 @@
 Block4D PartitionDecoder::decode_partition(uint16_t channel,
     Hierarchical4DDecoder &hierarchical_decoder,
     const LightfieldDimension<uint32_t> &size) {
+  return decode_partition(channel, hierarchical_decoder, {0, 0, 0, 0}, size);
+}
+
+
+Block4D PartitionDecoder::decode_partition(uint16_t channel,
+    Hierarchical4DDecoder &hierarchical_decoder,
+    const LightfieldCoordinate<uint32_t> &position_in_lightfield,
+    const LightfieldDimension<uint32_t> &size) {
   int position[] = {0, 0, 0, 0};
 
   uint32_t length[4];
   std::tie(length[0], length[1], length[2], length[3]) = size.as_tuple();
 
-  mPartitionData = Block4D(size);
+  std::tie(block_position[0], block_position[1], block_position[2],
+      block_position[3]) = position_in_lightfield.as_tuple();
+
+  if (is_downscaling()) {
+    uint32_t downscaled_length[4];
+    for (auto i = 0; i < 4; ++i) {
+      downscaled_block_position[i] =
+          get_downscaled_position(block_position[i], downscale_factors[i]);
+      downscaled_length[i] = get_downscaled_position(
+                                 block_position[i] + length[i],
+                                 downscale_factors[i]) -
+                             downscaled_block_position[i];
+    }
+    if (std::any_of(downscaled_length, downscaled_length + 4,
+            [](auto length) { return length == 0; })) {
+      //no downscaled sample falls inside this block, but its coefficients
+      //still must be decoded
+      mPartitionData = Block4D();
+    } else {
+      mPartitionData = Block4D({downscaled_length[0], downscaled_length[1],
+          downscaled_length[2], downscaled_length[3]});
+    }
+  } else {
+    mPartitionData = Block4D(size);
+  }
   // mPartitionData.fill_with_zeros();
 
   hierarchical_decoder.set_inferior_bit_plane(
@@ -132,8 +164,12 @@ void PartitionDecoder::decode_transform_partition(uint16_t channel,
   hierarchical_decoder.mSubbandLF.set_dimension(
       length[0], length[1], length[2], length[3]);
   hierarchical_decoder.mSubbandLF.fill_with_zeros();
-  hierarchical_decoder.decode_block(0, 0, 0, 0, length[0], length[1], length[2],
-      length[3], hierarchical_decoder.get_superior_bit_plane());
+  hierarchical_decoder.reset_significant_region();
+  {
+    JPLM_STAGE_TIMER(abac_decode);
+    hierarchical_decoder.decode_block(0, 0, 0, 0, length[0], length[1],
+        length[2], length[3], hierarchical_decoder.get_superior_bit_plane());
+  }
 
   inverse_scale_block(
       hierarchical_decoder.mSubbandLF, scaling_factors[channel]);
@@ -141,14 +177,51 @@ void PartitionDecoder::decode_transform_partition(uint16_t channel,
   DCT4DBlock dctblock(std::move(
       hierarchical_decoder
           .mSubbandLF));  //uses move in the initialization of transformed block.
-  hierarchical_decoder.mSubbandLF =
-      dctblock.inverse();  //hopefully using move (copy elision)
+
+  if (is_downscaling()) {
+    return copy_low_frequencies_inverse(dctblock, position, length);
+  }
+
+  hierarchical_decoder.mSubbandLF = dctblock.inverse(*dct_coefficients,
+      hierarchical_decoder
+          .get_significant_region());  //hopefully using move (copy elision)
 
   mPartitionData.copy_sub_block_from(hierarchical_decoder.mSubbandLF, 0, 0, 0,
       0, position[0], position[1], position[2], position[3]);
 }
 
 
+void PartitionDecoder::copy_low_frequencies_inverse(
+    const DCT4DBlock &dct_block, int *position, uint32_t *length) {
+  uint32_t downscaled_position[4];
+  uint32_t downscaled_length[4];
+  for (auto i = 0; i < 4; ++i) {
+    //positions in the light field are used, so that the downscaled
+    //partitions of neighbouring blocks do not overlap
+    auto initial = block_position[i] + position[i];
+    auto downscaled_initial =
+        get_downscaled_position(initial, downscale_factors[i]);
+    downscaled_length[i] =
+        get_downscaled_position(initial + length[i], downscale_factors[i]) -
+        downscaled_initial;
+    if (downscaled_length[i] == 0) {
+      //the partition is too small to contain a downscaled sample
+      return;
+    }
+    downscaled_position[i] = downscaled_initial - downscaled_block_position[i];
+  }
+
+  auto downscaled_block =
+      dct_block.inverse_low_frequencies(*dct_coefficients,
+          downscaled_length[0], downscaled_length[1], downscaled_length[2],
+          downscaled_length[3]);
+
+  mPartitionData.copy_sub_block_from(downscaled_block, 0, 0, 0, 0,
+      downscaled_position[0], downscaled_position[1], downscaled_position[2],
+      downscaled_position[3]);
+}
+
+
 void PartitionDecoder::set_colour_component_scaling_factor(
     const std::size_t colour_component_index, double scaling_factor) {
   this->scaling_factors[colour_component_index] = scaling_factor;
@@ -159,3 +232,25 @@ void PartitionDecoder::set_number_of_colour_components(
     uint16_t number_of_colour_components) {
   this->scaling_factors = std::vector<double>(number_of_colour_components, 1.0);
 }
+
+
+void PartitionDecoder::set_downscale_factors(
+    const std::array<uint32_t, 4> &factors) {
+  this->downscale_factors = factors;
+}
+
+
+bool PartitionDecoder::is_downscaling() const {
+  return std::any_of(downscale_factors.begin(), downscale_factors.end(),
+      [](auto factor) { return factor > 1; });
+}
+
+
+LightfieldCoordinate<uint32_t> PartitionDecoder::get_downscaled_position(
+    const LightfieldCoordinate<uint32_t> &position) const {
+  const auto &[t, s, v, u] = position.as_tuple();
+  return {get_downscaled_position(t, downscale_factors[0]),
+      get_downscaled_position(s, downscale_factors[1]),
+      get_downscaled_position(v, downscale_factors[2]),
+      get_downscaled_position(u, downscale_factors[3])};
+}
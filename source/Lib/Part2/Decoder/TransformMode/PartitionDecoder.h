@@ -44,10 +44,13 @@
 
 #include <math.h>
 #include <string.h>
+#include <algorithm>
+#include <array>
 #include <memory>
 #include <vector>
 #include "Lib/Part2/Common/TransformMode/DCT4DBlock.h"
 #include "Lib/Part2/Decoder/TransformMode/Hierarchical4DDecoder.h"
+#include "Lib/Utils/Stats/StageInstrumentation.h"
 
 
 class PartitionDecoder {
@@ -57,9 +60,24 @@ class PartitionDecoder {
       uint32_t *length, Hierarchical4DDecoder &hierarchical_decoder);
   void decode_partition(uint16_t channel, int *position, uint32_t *length,
       Hierarchical4DDecoder &entropyDecoder);
+  void copy_low_frequencies_inverse(
+      const DCT4DBlock &dct_block, int *position, uint32_t *length);
+
+  /**
+   * \brief Position of the first downscaled sample of the range starting at
+   *        position (i.e., ceil(position / factor))
+   */
+  static uint32_t get_downscaled_position(uint32_t position, uint32_t factor) {
+    return (position + factor - 1) / factor;
+  }
 
  protected:
   std::vector<double> scaling_factors;
+  std::array<uint32_t, 4> downscale_factors = {1, 1, 1, 1};
+  std::array<uint32_t, 4> block_position = {0, 0, 0, 0};
+  std::array<uint32_t, 4> downscaled_block_position = {0, 0, 0, 0};
+  const DCT4DCoefficientsRegistry *dct_coefficients =
+      nullptr; /*!< Coefficients of the inverse transforms (not owned) */
 
  public:
   Block4D mPartitionData; /*!< DCT of all subblocks of the partition */
@@ -70,11 +88,47 @@ class PartitionDecoder {
       const LightfieldDimension<uint32_t> &size);
 
 
+  /**
+   * \brief Decodes the partition of the 4D block at position.
+   *
+   * \details When downscaling, the returned block has the downscaled size
+   *          and must be placed at get_downscaled_position(position). Each
+   *          transform partition is reconstructed from its lowest frequency
+   *          coefficients only.
+   */
+  Block4D decode_partition(uint16_t channel,
+      Hierarchical4DDecoder &entropyDecoder,
+      const LightfieldCoordinate<uint32_t> &position,
+      const LightfieldDimension<uint32_t> &size);
+
+
+  /**
+   * \brief Sets the downscaling factors (t, s, v, u) of the decoded samples
+   */
+  void set_downscale_factors(const std::array<uint32_t, 4> &factors);
+
+
+  bool is_downscaling() const;
+
+
+  LightfieldCoordinate<uint32_t> get_downscaled_position(
+      const LightfieldCoordinate<uint32_t> &position) const;
+
+
   void set_colour_component_scaling_factor(
       const std::size_t colour_component_index, double scaling_factor);
 
 
   void set_number_of_colour_components(uint16_t number_of_colour_components);
+
+
+  /**
+   * \brief Sets the coefficients of the inverse transforms, which must be
+   *        set before decoding a partition
+   */
+  void set_dct_coefficients(const DCT4DCoefficientsRegistry *coefficients) {
+    dct_coefficients = coefficients;
+  }
 };
 
 #endif /* end of include guard: JPLM_LIB_PART2_DECODER_TRANSFORMMODE_PARTITIONDECODER_H__ */
\ No newline at end of file
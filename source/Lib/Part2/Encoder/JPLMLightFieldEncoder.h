@@ -43,6 +43,7 @@
 
 #include <magic_enum.hpp>
 #include "Lib/Common/JPLMEncoderConfigurationLightField.h"
+#include "Lib/Part1/Common/UncompressedThumbnail.h"
 #include "Lib/Part2/Common/Boxes/CompressionTypeLightField.h"
 #include "Lib/Part2/Common/Boxes/JpegPlenoLightFieldBox.h"
 #include "Lib/Part2/Common/Boxes/JpegPlenoLightFieldHeaderBox.h"
@@ -51,6 +52,7 @@
 #include "Lib/Part2/Common/JPLMLightFieldCodec.h"
 #include "Lib/Part2/Common/LightfieldFromFile.h"
 #include "Lib/Part2/Common/LightfieldIOConfiguration.h"
+#include "Lib/Part2/Encoder/LightFieldThumbnailGenerator.h"
 
 
 template<typename PelType = uint16_t>
@@ -95,11 +97,26 @@ class JPLMLightFieldEncoder : public virtual JPLMLightFieldCodec<PelType> {
   }
 
 
+  void add_thumbnail_box() {
+    const auto thumbnail_size =
+        light_field_encoder_configuration.get_thumbnail_size();
+    if (thumbnail_size == 0) {
+      return;
+    }
+    auto thumbnail = LightFieldThumbnailGenerator::generate(*this->light_field,
+        thumbnail_size,
+        light_field_encoder_configuration.is_thumbnail_a_mosaic());
+    this->jpl_file->add_thumbnail_box(UncompressedThumbnail::get_thumbnail_box(
+        *thumbnail, light_field_encoder_configuration.get_enum_cs()));
+  }
+
+
  public:
   JPLMLightFieldEncoder(const JPLMEncoderConfigurationLightField& configuration)
       : JPLMLightFieldCodec<PelType>(configuration),
         light_field_encoder_configuration(configuration) {
     add_pleno_lf_box();
+    add_thumbnail_box();
   }
 
   virtual ~JPLMLightFieldEncoder() = default;
@@ -0,0 +1,153 @@
+/* The copyright in this software is being made available under the BSD
+ * License, included below. This software may be subject to other third party
+ * and contributor rights, including patent rights, and no such rights are
+ * granted under this license.
+ *
+ * Copyright (c) 2010-2019, ITU/ISO/IEC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *  * Neither the name of the ITU/ISO/IEC nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** \file     LightFieldThumbnailGenerator.h
+ *  \brief    Generates the thumbnail image of a light field
+ *  \details  The thumbnail is either the central view or the mosaic of all
+ *            views, downscaled by an integer factor (averaging each square
+ *            of source samples) so that its largest side fits the requested
+ *            size.
+ *  \date     2026-10-19
+ */
+
+#ifndef JPLM_LIB_PART2_ENCODER_LIGHTFIELDTHUMBNAILGENERATOR_H__
+#define JPLM_LIB_PART2_ENCODER_LIGHTFIELDTHUMBNAILGENERATOR_H__
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include "Lib/Part2/Common/Lightfield.h"
+#include "Lib/Utils/Image/Image.h"
+#include "Lib/Utils/Image/RGBImage.h"
+#include "Lib/Utils/Image/UndefinedImage.h"
+
+namespace LightFieldThumbnailGenerator {
+
+/**
+ * \brief      Generates a thumbnail of the light field.
+ *
+ * \param[in]  light_field   The light field
+ * \param[in]  maximum_size  The maximum width and height of the thumbnail
+ *                           (must be greater than zero)
+ * \param[in]  mosaic        If true, the thumbnail is the mosaic of all views
+ *                           (each view is loaded once); otherwise it is the
+ *                           central view
+ *
+ * \tparam     T             The sample type of the light field
+ *
+ * \return     The thumbnail, with the channels and bit depth of the views
+ */
+template<typename T>
+std::unique_ptr<Image<uint16_t>> generate(const Lightfield<T>& light_field,
+    const std::size_t maximum_size, const bool mosaic) {
+  const auto [t_max, s_max, v_max, u_max] =
+      light_field.get_dimensions().as_tuple();
+  const auto source_height = mosaic ? t_max * v_max : v_max;
+  const auto source_width = mosaic ? s_max * u_max : u_max;
+
+  const auto largest_side = std::max(source_height, source_width);
+  const auto factor = std::max(
+      std::size_t{1}, (largest_side + maximum_size - 1) / maximum_size);
+  const auto height = (source_height + factor - 1) / factor;
+  const auto width = (source_width + factor - 1) / factor;
+
+  const std::size_t number_of_channels =
+      light_field.get_number_of_channels_in_view();
+  const std::size_t bpp = light_field.get_views_bpp();
+
+  auto sums = std::vector<uint64_t>(number_of_channels * height * width, 0);
+  auto counts = std::vector<uint64_t>(height * width, 0);
+
+  auto accumulate_view = [&](const std::size_t t, const std::size_t s) {
+    const auto& view_image = light_field.get_image_at({t, s});
+    const auto first_row = mosaic ? t * v_max : 0;
+    const auto first_column = mosaic ? s * u_max : 0;
+    for (auto v = decltype(v_max){0}; v < v_max; ++v) {
+      const auto row_offset = ((first_row + v) / factor) * width;
+      for (auto u = decltype(u_max){0}; u < u_max; ++u) {
+        ++counts[row_offset + (first_column + u) / factor];
+      }
+    }
+    for (auto c = decltype(number_of_channels){0}; c < number_of_channels;
+         ++c) {
+      const auto& channel = view_image.get_channel(c);
+      auto* channel_sums = sums.data() + c * height * width;
+      for (auto v = decltype(v_max){0}; v < v_max; ++v) {
+        const auto* row = channel[v];
+        auto* row_sums = channel_sums + ((first_row + v) / factor) * width;
+        for (auto u = decltype(u_max){0}; u < u_max; ++u) {
+          row_sums[(first_column + u) / factor] += row[u];
+        }
+      }
+    }
+  };
+
+  if (mosaic) {
+    for (auto t = decltype(t_max){0}; t < t_max; ++t) {
+      for (auto s = decltype(s_max){0}; s < s_max; ++s) {
+        accumulate_view(t, s);
+      }
+    }
+  } else {
+    accumulate_view(t_max / 2, s_max / 2);
+  }
+
+  auto thumbnail = (number_of_channels == 3)
+                       ? std::unique_ptr<Image<uint16_t>>(
+                             std::make_unique<RGBImage<uint16_t>>(
+                                 width, height, bpp))
+                       : std::unique_ptr<Image<uint16_t>>(
+                             std::make_unique<UndefinedImage<uint16_t>>(
+                                 width, height, bpp, number_of_channels));
+
+  for (auto c = decltype(number_of_channels){0}; c < number_of_channels;
+       ++c) {
+    auto& channel = thumbnail->get_channel(c);
+    const auto* channel_sums = sums.data() + c * height * width;
+    for (auto i = decltype(height){0}; i < height; ++i) {
+      auto* row = channel[i];
+      for (auto j = decltype(width){0}; j < width; ++j) {
+        const auto count = counts[i * width + j];
+        row[j] = static_cast<uint16_t>(
+            (channel_sums[i * width + j] + count / 2) / count);
+      }
+    }
+  }
+
+  return thumbnail;
+}
+
+}  // namespace LightFieldThumbnailGenerator
+
+#endif /* end of include guard: JPLM_LIB_PART2_ENCODER_LIGHTFIELDTHUMBNAILGENERATOR_H__ */
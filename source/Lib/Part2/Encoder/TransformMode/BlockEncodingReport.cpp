@@ -0,0 +1,98 @@
+/* The copyright in this software is being made available under the BSD
+ * License, included below. This software may be subject to other third party
+ * and contributor rights, including patent rights, and no such rights are
+ * granted under this license.
+ *
+ * Copyright (c) 2010-2019, ITU/ISO/IEC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *  * Neither the name of the ITU/ISO/IEC nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** \file     BlockEncodingReport.cpp
+ *  \brief    Per 4D block encoding analytics
+ *  \details  
+ *  \date     2026-10-19
+ */
+
+#include "Lib/Part2/Encoder/TransformMode/BlockEncodingReport.h"
+#include <fstream>
+#include <iomanip>
+#include <limits>
+
+
+void BlockEncodingReport::write_csv(std::ostream& stream) const {
+  stream << "channel,t,s,v,u,length_t,length_s,length_v,length_u,bytes,"
+            "estimated_sse,partition_code,inferior_bit_plane,"
+            "number_of_transform_leaves,encoding_time_ms\n";
+  const auto previous_precision = stream.precision();
+  stream << std::setprecision(std::numeric_limits<double>::digits10);
+  for (const auto& record : records) {
+    stream << record.channel << ',' << record.position.get_t() << ','
+           << record.position.get_s() << ',' << record.position.get_v() << ','
+           << record.position.get_u() << ',' << record.size.get_t() << ','
+           << record.size.get_s() << ',' << record.size.get_v() << ','
+           << record.size.get_u() << ',' << record.bytes << ','
+           << record.estimated_sse << ',' << record.partition_code << ','
+           << record.inferior_bit_plane << ','
+           << record.number_of_transform_leaves << ','
+           << record.encoding_time_ms << '\n';
+  }
+  stream.precision(previous_precision);
+}
+
+
+nlohmann::json BlockEncodingReport::to_json() const {
+  auto blocks = nlohmann::json::array();
+  for (const auto& record : records) {
+    blocks.push_back({{"channel", record.channel},
+        {"position",
+            {record.position.get_t(), record.position.get_s(),
+                record.position.get_v(), record.position.get_u()}},
+        {"size",
+            {record.size.get_t(), record.size.get_s(), record.size.get_v(),
+                record.size.get_u()}},
+        {"bytes", record.bytes}, {"estimated_sse", record.estimated_sse},
+        {"partition_code", record.partition_code},
+        {"inferior_bit_plane", record.inferior_bit_plane},
+        {"number_of_transform_leaves", record.number_of_transform_leaves},
+        {"encoding_time_ms", record.encoding_time_ms}});
+  }
+  return {{"blocks", blocks}};
+}
+
+
+void BlockEncodingReport::write(const std::filesystem::path& path) const {
+  auto file = std::ofstream(path);
+  if (!file.is_open()) {
+    std::cerr << "Error opening block report file " << path << std::endl;
+    return;
+  }
+  if (path.extension() == ".csv") {
+    write_csv(file);
+  } else {
+    file << std::setw(2) << to_json() << std::endl;
+  }
+}
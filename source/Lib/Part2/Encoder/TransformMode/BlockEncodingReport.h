@@ -0,0 +1,108 @@
+/* The copyright in this software is being made available under the BSD
+ * License, included below. This software may be subject to other third party
+ * and contributor rights, including patent rights, and no such rights are
+ * granted under this license.
+ *
+ * Copyright (c) 2010-2019, ITU/ISO/IEC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *  * Neither the name of the ITU/ISO/IEC nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** \file     BlockEncodingReport.h
+ *  \brief    Per 4D block encoding analytics
+ *  \details  Keeps one record per encoded 4D block (and channel) with its
+ *            position, size, rate, estimated distortion, chosen partition and
+ *            encoding time. The report is written as CSV or JSON, e.g., to
+ *            tune transform sizes and lambda or to find pathological blocks.
+ *  \date     2026-10-19
+ */
+
+#ifndef JPLM_LIB_PART2_ENCODER_TRANSFORMMODE_BLOCKENCODINGREPORT_H__
+#define JPLM_LIB_PART2_ENCODER_TRANSFORMMODE_BLOCKENCODINGREPORT_H__
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "Lib/Part2/Common/LightfieldCoordinate.h"
+#include "Lib/Part2/Common/LightfieldDimension.h"
+#include "nlohmann/json.hpp"
+
+
+struct BlockEncodingRecord {
+  uint32_t channel;
+  LightfieldCoordinate<uint32_t> position;
+  LightfieldDimension<uint32_t> size;
+  std::size_t bytes;  //!< Including the SOB marker
+  double estimated_sse;  //!< Sum of squared errors estimated during RDO
+  std::string partition_code;  //!< T, S and V flags (see TransformPartition)
+  uint32_t inferior_bit_plane;
+  std::size_t number_of_transform_leaves;
+  double encoding_time_ms;
+};
+
+
+class BlockEncodingReport {
+ protected:
+  std::vector<BlockEncodingRecord> records;
+
+ public:
+  BlockEncodingReport() = default;
+
+
+  ~BlockEncodingReport() = default;
+
+
+  void add_record(BlockEncodingRecord&& record) {
+    records.push_back(std::move(record));
+  }
+
+
+  const std::vector<BlockEncodingRecord>& get_records() const noexcept {
+    return records;
+  }
+
+
+  /**
+   * @brief      Writes the records as comma separated values, with a header
+   *             line
+   */
+  void write_csv(std::ostream& stream) const;
+
+
+  nlohmann::json to_json() const;
+
+
+  /**
+   * @brief      Writes the report to the given file: CSV if its extension is
+   *             .csv, JSON otherwise
+   */
+  void write(const std::filesystem::path& path) const;
+};
+
+#endif /* end of include guard: JPLM_LIB_PART2_ENCODER_TRANSFORMMODE_BLOCKENCODINGREPORT_H__ */
@@ -80,6 +80,66 @@ class DimensionFromConfigurationDoesNotMatchFilesException : public std::excepti
   }
 };
 
+
+class TargetBitrateTooLowException : public std::exception {
+ protected:
+  std::string message;
+
+ public:
+  TargetBitrateTooLowException(double target_bpp)
+      : message("The target bitrate of " + std::to_string(target_bpp) +
+                " bpp is too low: it does not leave at least two bytes (the "
+                "SOB marker) per 4D block after the headers") {
+  }
+
+
+  const char* what() const noexcept override {
+    return message.c_str();
+  }
+};
+
+
+class UncalibratedRateControlException : public std::exception {
+ public:
+  const char* what() const noexcept override {
+    return "The rate control has no calibration point";
+  }
+};
+
+
+class InvalidCheckpointException : public std::exception {
+ protected:
+  std::string message;
+
+ public:
+  InvalidCheckpointException(const std::string& reason)
+      : message("The encoding cannot be resumed from the checkpoint: " +
+                reason) {
+  }
+
+
+  const char* what() const noexcept override {
+    return message.c_str();
+  }
+};
+
+
+class CheckpointWriteException : public std::exception {
+ protected:
+  std::string message;
+
+ public:
+  CheckpointWriteException(const std::string& filename)
+      : message("Unable to write the checkpoint " + filename +
+                " (the previous one is kept)") {
+  }
+
+
+  const char* what() const noexcept override {
+    return message.c_str();
+  }
+};
+
 }  // namespace JPLM4DTransformModeLightFieldEncoderExceptions
 
 #endif  // JPLM_LIB_PART2_ENCODER_TRANSFORMMODE_COMMON_EXCEPTIONS_H
\ No newline at end of file
@@ -0,0 +1,233 @@
+/* The copyright in this software is being made available under the BSD
+ * License, included below. This software may be subject to other third party
+ * and contributor rights, including patent rights, and no such rights are
+ * granted under this license.
+ *
+ * Copyright (c) 2010-2019, ITU/ISO/IEC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *  * Neither the name of the ITU/ISO/IEC nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** \file     EncodingCheckpoint.cpp
+ *  \brief    State of an interrupted encoding, to be resumed later
+ *  \details
+ *  \date     2026-10-19
+ */
+
+#include "Lib/Part2/Encoder/TransformMode/EncodingCheckpoint.h"
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <system_error>
+#include <type_traits>
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+#include "Lib/Part2/Encoder/TransformMode/CommonExceptions.h"
+#include "Lib/Utils/Stream/BinaryTools.h"
+
+
+namespace {
+
+constexpr char magic[] = {'J', 'P', 'L', 'M', 'C', 'K', 'P', 'T'};
+
+
+template<typename T>
+void append_vector(
+    std::vector<std::byte>& bytes, const std::vector<T>& values) {
+  BinaryTools::append_big_endian_bytes(bytes, uint64_t(values.size()));
+  for (const auto& value : values) {
+    BinaryTools::append_big_endian_bytes(bytes, value);
+  }
+}
+
+
+/**
+ * \brief      Reads the values of a checkpoint in sequence, throwing
+ * std::out_of_range past its end
+ */
+class CheckpointParser {
+ private:
+  const std::vector<std::byte>& bytes;
+  std::size_t position = 0;
+
+ public:
+  explicit CheckpointParser(const std::vector<std::byte>& bytes)
+      : bytes(bytes) {
+  }
+
+
+  template<typename T>
+  T get_value() {
+    if constexpr (std::is_same_v<T, std::byte>) {
+      return bytes.at(position++);
+    } else {
+      const auto value = BinaryTools::get_value_from_big_endian_byte_vector<T>(
+          bytes, position);
+      position += sizeof(T);
+      return value;
+    }
+  }
+
+
+  template<typename T>
+  std::vector<T> get_vector() {
+    const auto size = get_value<uint64_t>();
+    if (size > (bytes.size() - position) / sizeof(T)) {
+      throw std::out_of_range("vector past the end of the checkpoint");
+    }
+    if constexpr (std::is_same_v<T, std::byte>) {
+      const auto begin = bytes.begin() + position;
+      position += size;
+      return std::vector<std::byte>(begin, begin + size);
+    }
+    auto values = std::vector<T>();
+    values.reserve(size);
+    for (auto i = uint64_t(0); i < size; ++i) {
+      values.push_back(get_value<T>());
+    }
+    return values;
+  }
+
+
+  bool is_at_end() const noexcept {
+    return position == bytes.size();
+  }
+};
+
+
+bool flush_to_disk(const std::filesystem::path& path) {
+#ifdef _WIN32
+  return true;
+#else
+  const auto descriptor = open(path.c_str(), O_WRONLY);
+  if (descriptor < 0) {
+    return false;
+  }
+  const auto is_synchronized = (fsync(descriptor) == 0);
+  return (close(descriptor) == 0) && is_synchronized;
+#endif
+}
+
+}  // namespace
+
+
+void EncodingCheckpoint::write_to(std::ostream& stream,
+    const std::vector<const ContiguousCodestreamCode*>& codestreams) const {
+  auto bytes = std::vector<std::byte>();
+  for (const auto& character : magic) {
+    bytes.push_back(static_cast<std::byte>(character));
+  }
+  BinaryTools::append_big_endian_bytes(bytes, version);
+  BinaryTools::append_big_endian_bytes(bytes, number_of_encoded_blocks);
+  BinaryTools::append_big_endian_bytes(bytes, uint64_t(encodings.size()));
+  stream.write(reinterpret_cast<const char*>(bytes.data()), bytes.size());
+  for (auto i = std::size_t(0); i < encodings.size(); ++i) {
+    const auto& encoding = encodings[i];
+    const auto& codestream = *(codestreams.at(i));
+    bytes.clear();
+    BinaryTools::append_big_endian_bytes(bytes, encoding.lambda);
+    append_vector(bytes, encoding.sse_per_channel);
+    append_vector(bytes, encoding.bytes_per_channel);
+    append_vector(bytes, encoding.byte_index_for_pnt);
+    BinaryTools::append_big_endian_bytes(bytes, codestream.size());
+    stream.write(reinterpret_cast<const char*>(bytes.data()), bytes.size());
+    codestream.write_to(stream);
+  }
+}
+
+
+EncodingCheckpoint EncodingCheckpoint::from_bytes(
+    const std::vector<std::byte>& bytes) {
+  using JPLM4DTransformModeLightFieldEncoderExceptions::
+      InvalidCheckpointException;
+  auto parser = CheckpointParser(bytes);
+  auto checkpoint = EncodingCheckpoint();
+  try {
+    for (const auto& character : magic) {
+      if (parser.get_value<std::byte>() != static_cast<std::byte>(character)) {
+        throw InvalidCheckpointException("it is not a JPLM checkpoint");
+      }
+    }
+    if (parser.get_value<uint32_t>() != version) {
+      throw InvalidCheckpointException("its version is not supported");
+    }
+    checkpoint.number_of_encoded_blocks = parser.get_value<uint64_t>();
+    const auto number_of_encodings = parser.get_value<uint64_t>();
+    for (auto i = uint64_t(0); i < number_of_encodings; ++i) {
+      auto encoding = EncodingState();
+      encoding.lambda = parser.get_value<double>();
+      encoding.sse_per_channel = parser.get_vector<double>();
+      encoding.bytes_per_channel = parser.get_vector<uint64_t>();
+      encoding.byte_index_for_pnt = parser.get_vector<uint64_t>();
+      encoding.codestream = parser.get_vector<std::byte>();
+      checkpoint.encodings.push_back(std::move(encoding));
+    }
+  } catch (const std::out_of_range&) {
+    throw InvalidCheckpointException("it is truncated");
+  }
+  if (!parser.is_at_end()) {
+    throw InvalidCheckpointException("it has trailing bytes");
+  }
+  return checkpoint;
+}
+
+
+void EncodingCheckpoint::write(const std::filesystem::path& path,
+    const std::vector<const ContiguousCodestreamCode*>& codestreams) const {
+  auto temporary_path = path;
+  temporary_path += ".tmp";
+  auto is_written = false;
+  {
+    std::ofstream file(temporary_path, std::ofstream::binary);
+    if (file.is_open()) {
+      write_to(file, codestreams);
+      file.close();
+      is_written = !file.fail();
+    }
+  }
+  //the previous checkpoint is only replaced by a complete one
+  if (!is_written || !flush_to_disk(temporary_path)) {
+    auto error = std::error_code();
+    std::filesystem::remove(temporary_path, error);
+    throw JPLM4DTransformModeLightFieldEncoderExceptions::
+        CheckpointWriteException(temporary_path.string());
+  }
+  std::filesystem::rename(temporary_path, path);
+}
+
+
+std::optional<EncodingCheckpoint> EncodingCheckpoint::read(
+    const std::filesystem::path& path) {
+  if (!std::filesystem::exists(path)) {
+    return std::nullopt;
+  }
+  std::ifstream file(path, std::ifstream::binary);
+  auto bytes = std::vector<std::byte>(std::filesystem::file_size(path));
+  file.read(reinterpret_cast<char*>(bytes.data()), bytes.size());
+  return from_bytes(bytes);
+}
@@ -0,0 +1,111 @@
+/* The copyright in this software is being made available under the BSD
+ * License, included below. This software may be subject to other third party
+ * and contributor rights, including patent rights, and no such rights are
+ * granted under this license.
+ *
+ * Copyright (c) 2010-2019, ITU/ISO/IEC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *  * Neither the name of the ITU/ISO/IEC nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** \file     EncodingCheckpoint.h
+ *  \brief    State of an interrupted encoding, to be resumed later
+ *  \details  The 4D blocks are coded independently (the probability models
+ *            are reset and the arithmetic coder is flushed after each one),
+ *            thus, between two blocks, the state of the encoding with each
+ *            lambda is its codestream so far, the indices of the codestream
+ *            pointer set and the SSE and bytes per channel. The checkpoint
+ *            is written in big endian, and the file is replaced atomically,
+ *            so that an interruption while writing keeps the previous one.
+ *  \date     2026-10-19
+ */
+
+#ifndef JPLM_LIB_PART2_ENCODER_TRANSFORMMODE_ENCODINGCHECKPOINT_H__
+#define JPLM_LIB_PART2_ENCODER_TRANSFORMMODE_ENCODINGCHECKPOINT_H__
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <ostream>
+#include <vector>
+#include "Lib/Common/Boxes/Generic/ContiguousCodestreamCode.h"
+
+
+struct EncodingCheckpoint {
+  static constexpr uint32_t version = 1;
+
+  struct EncodingState {
+    double lambda;
+    std::vector<double> sse_per_channel;
+    std::vector<uint64_t> bytes_per_channel;
+    std::vector<uint64_t> byte_index_for_pnt;  //!< Without the box offsets
+    std::vector<std::byte>
+        codestream;  //!< From the SOC marker (only filled when read)
+  };
+
+  uint64_t number_of_encoded_blocks = 0;  //!< Of all channels
+  std::vector<EncodingState> encodings;  //!< One per lambda
+
+
+  /**
+   * \brief      Writes the checkpoint to stream, with the codestream of each
+   * encoding (from the SOC marker) given apart, so that it is written
+   * directly instead of being copied into the checkpoint
+   */
+  void write_to(std::ostream& stream,
+      const std::vector<const ContiguousCodestreamCode*>& codestreams) const;
+
+
+  /**
+   * \brief      Parses a checkpoint
+   *
+   * \throws     InvalidCheckpointException if the bytes are not a checkpoint
+   * of this version
+   */
+  static EncodingCheckpoint from_bytes(const std::vector<std::byte>& bytes);
+
+
+  /**
+   * \brief      Writes the checkpoint (see write_to) to a temporary file,
+   * which, once flushed to the disk, replaces the given one
+   *
+   * \throws     CheckpointWriteException if the temporary file cannot be
+   * written, in which case the given file is kept
+   */
+  void write(const std::filesystem::path& path,
+      const std::vector<const ContiguousCodestreamCode*>& codestreams) const;
+
+
+  /**
+   * \brief      Reads the checkpoint from the given file (std::nullopt if it
+   * does not exist)
+   */
+  static std::optional<EncodingCheckpoint> read(
+      const std::filesystem::path& path);
+};
+
+#endif /* end of include guard: JPLM_LIB_PART2_ENCODER_TRANSFORMMODE_ENCODINGCHECKPOINT_H__ */
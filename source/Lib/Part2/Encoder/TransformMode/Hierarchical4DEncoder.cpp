@@ -62,6 +62,7 @@ Hierarchical4DEncoder::move_codestream_code_out() {
 void Hierarchical4DEncoder::reset_probability_models() {
   Hierarchical4DCodec::reset_probability_models();
   optimization_probability_models.reset();
+  const auto event = TraceEvents::ScopedEvent("codestream_flush", "io");
   mEntropyCoder.flush_byte();
 }
 
@@ -132,6 +133,31 @@ void Hierarchical4DEncoder::create_temporary_buffer() {
 }
 
 
+std::unique_ptr<Hierarchical4DEncoder>
+Hierarchical4DEncoder::make_optimization_copy() const {
+  auto copy = std::make_unique<Hierarchical4DEncoder>();
+  copy->probability_models = probability_models;
+  copy->optimization_probability_models = optimization_probability_models;
+  copy->mPGMScale = mPGMScale;
+  copy->superior_bit_plane = superior_bit_plane;
+  copy->inferior_bit_plane = inferior_bit_plane;
+  copy->mTransformLength_t = mTransformLength_t;
+  copy->mTransformLength_s = mTransformLength_s;
+  copy->mTransformLength_v = mTransformLength_v;
+  copy->mTransformLength_u = mTransformLength_u;
+  copy->mMinimumTransformLength_t = mMinimumTransformLength_t;
+  copy->mMinimumTransformLength_s = mMinimumTransformLength_s;
+  copy->mMinimumTransformLength_v = mMinimumTransformLength_v;
+  copy->mMinimumTransformLength_u = mMinimumTransformLength_u;
+  copy->mNumberOfVerticalViews = mNumberOfVerticalViews;
+  copy->mNumberOfHorizontalViews = mNumberOfHorizontalViews;
+  copy->mNumberOfViewLines = mNumberOfViewLines;
+  copy->mNumberOfViewColumns = mNumberOfViewColumns;
+  copy->create_temporary_buffer();
+  return copy;
+}
+
+
 RDCostResult Hierarchical4DEncoder::get_rd_for_below_inferior_bit_plane(
     const LightfieldCoordinate<uint32_t>& position,
     const LightfieldDimension<uint32_t>& length) {
@@ -56,6 +56,7 @@
 #include "Lib/Part2/Common/TransformMode/ProbabilityModelsHandler.h"
 #include "Lib/Part2/Encoder/TransformMode/ABACEncoder.h"
 #include "Lib/Part2/Encoder/TransformMode/RDCostResult.h"
+#include "Lib/Utils/Stats/TraceEvents.h"
 #include "Lib/Utils/Stream/BinaryTools.h"
 //#include "Lib/Common/JPLMEncoderConfigurationLightField4DTransformMode.h"
 
@@ -113,6 +114,15 @@ class Hierarchical4DEncoder : public Hierarchical4DCodec {
   void create_temporary_buffer();
 
 
+  /**
+   * \brief      Creates an encoder with the state used by the
+   * rate-distortion optimization (bit planes, transform dimension and
+   * probability models), to be used by a concurrent partition search. Its
+   * codestream is empty and must not be used.
+   */
+  std::unique_ptr<Hierarchical4DEncoder> make_optimization_copy() const;
+
+
   void show_inferior_bit_plane() const;
 
 
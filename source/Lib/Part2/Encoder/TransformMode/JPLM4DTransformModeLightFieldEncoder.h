@@ -41,15 +41,51 @@
 #ifndef JPLM_LIB_PART2_ENCODER_JPLM4DTRANSFORMMODELIGHTFIELDENCODER_H__
 #define JPLM_LIB_PART2_ENCODER_JPLM4DTRANSFORMMODELIGHTFIELDENCODER_H__
 
+#include <chrono>
+#include <memory>
+#include <numeric>
 #include "CppConsoleTable/CppConsoleTable.hpp"
 #include "Lib/Common/JPLMEncoderConfigurationLightField4DTransformMode.h"
 #include "Lib/Part2/Common/TransformMode/BorderBlocksPolicy.h"
 #include "Lib/Part2/Common/TransformMode/JPLM4DTransformModeLightFieldCodec.h"
 #include "Lib/Part2/Common/TransformMode/LightFieldConfigurationMarkerSegment.h"
 #include "Lib/Part2/Encoder/JPLMLightFieldEncoder.h"
+#include "Lib/Part2/Encoder/TransformMode/BlockEncodingReport.h"
+#include "Lib/Part2/Encoder/TransformMode/EncodingCheckpoint.h"
 #include "Lib/Part2/Encoder/TransformMode/Hierarchical4DEncoder.h"
+#include "Lib/Part2/Encoder/TransformMode/RateControl.h"
+#include "Lib/Part2/Encoder/TransformMode/TimeBudget.h"
+#include "Lib/Part2/Encoder/TransformMode/TransformCache.h"
 #include "Lib/Part2/Encoder/TransformMode/TransformPartition.h"
 #include "Lib/Utils/Image/ImageChannelUtils.h"
+#include "Lib/Utils/Parallel/ParallelFor.h"
+#include "Lib/Utils/Parallel/TaskScheduler.h"
+
+
+/**
+ * \brief      The state of the encoding of a light field with one lambda:
+ * its entropy coder (and codestream), partition search and statistics.
+ */
+struct LightFieldEncodingForLambda {
+  double lambda;
+  Hierarchical4DEncoder hierarchical_4d_encoder;
+  TransformPartition transform_partition;
+  std::vector<std::variant<uint32_t, uint64_t>> byte_index_for_pnt;
+  std::vector<double> sse_per_channel;
+  std::vector<std::size_t>
+      bytes_per_channel;  //<! Accumulates the total number of encoded bytes of each channel. Does not include header information.
+  std::unique_ptr<BlockEncodingReport>
+      block_report;  //<! Only created when a block report was requested
+  std::unique_ptr<ContiguousCodestreamBox>
+      contiguous_codestream_box;  //<! Set at finalization, unless selected
+
+
+  LightFieldEncodingForLambda(double lambda,
+      const LightfieldDimension<uint32_t>& minimum_transform_dimension)
+      : lambda(lambda), transform_partition(minimum_transform_dimension) {
+  }
+};
+
 
 template<typename PelType = uint16_t>
 class JPLM4DTransformModeLightFieldEncoder
@@ -58,18 +94,28 @@ class JPLM4DTransformModeLightFieldEncoder
  protected:
   std::shared_ptr<JPLMEncoderConfigurationLightField4DTransformMode>
       transform_mode_encoder_configuration;
-  Hierarchical4DEncoder hierarchical_4d_encoder;
-  TransformPartition transform_partition;
+  std::vector<std::unique_ptr<LightFieldEncodingForLambda>>
+      encodings;  //<! One per lambda, in the order they were given
+  std::unique_ptr<TransformCache>
+      transform_cache;  //<! Only created when encoding with several lambdas
+  std::unique_ptr<Parallel::TaskScheduler>
+      task_scheduler;  //<! Only created for a parallel partition search
+  std::size_t selected_encoding = 0;  //<! Its codestream is in the jpl file
+  std::unique_ptr<RateControl>
+      rate_control;  //<! Only created when encoding for a target bitrate
+  std::size_t number_of_blocks = 0;  //<! Used by the rate control
+  std::size_t number_of_encoded_blocks = 0;  //<! Used by the rate control
+  std::unique_ptr<TimeBudget>
+      time_budget;  //<! Only created when encoding within a time budget
+  std::chrono::steady_clock::time_point
+      encoding_start;  //<! Of the run, including the rate control
+  std::size_t number_of_resumed_blocks =
+      0;  //<! Restored from a checkpoint, thus skipped
   LightFieldTransformMode<PelType>& ref_to_lightfield;
   LightFieldConfigurationMarkerSegment lightfield_configuration_marker_segment;
 
-  std::vector<std::variant<uint32_t, uint64_t>> byte_index_for_pnt;
   std::size_t first_sob_position = 0;
 
-  std::vector<double> sse_per_channel;
-  std::vector<std::size_t>
-      bytes_per_channel;  //<! Accumulates the total number of encoded bytes of each channel. Does not include header information.
-
 
   virtual uint16_t get_number_of_colour_components() const override {
     return transform_mode_encoder_configuration
@@ -88,10 +134,11 @@ class JPLM4DTransformModeLightFieldEncoder
 
 
   template<typename type_of_pnt_entry>
-  bool contiguous_codestream_box_will_use_XMBox_field() const noexcept {
+  bool contiguous_codestream_box_will_use_XMBox_field(
+      const LightFieldEncodingForLambda& encoding) const noexcept {
     //begins with 8, which is the size of LBox and TBox, assuming that XLBox is not used.
     auto n_bytes = std::size_t(8);
-    for (const auto& bytes_in_channel : bytes_per_channel) {
+    for (const auto& bytes_in_channel : encoding.bytes_per_channel) {
       n_bytes += bytes_in_channel;
     }
     n_bytes += get_size_of_pnt<type_of_pnt_entry>();
@@ -103,9 +150,11 @@ class JPLM4DTransformModeLightFieldEncoder
 
 
   template<typename type_of_pnt_entry>
-  uint64_t get_offset_from_box_header_and_pnt() const noexcept {
+  uint64_t get_offset_from_box_header_and_pnt(
+      const LightFieldEncodingForLambda& encoding) const noexcept {
     auto offset = uint64_t(
-        contiguous_codestream_box_will_use_XMBox_field<type_of_pnt_entry>()
+        contiguous_codestream_box_will_use_XMBox_field<type_of_pnt_entry>(
+            encoding)
             ? 16
             : 8);
     offset += get_size_of_pnt<type_of_pnt_entry>();
@@ -113,12 +162,13 @@ class JPLM4DTransformModeLightFieldEncoder
   }
 
 
-  bool is_possible_to_use_32bits_to_encode_all_ptrs() const {
+  bool is_possible_to_use_32bits_to_encode_all_ptrs(
+      const LightFieldEncodingForLambda& encoding) const {
     //at this point the variant shall contain uint64_t only
-    auto last_index = std::get<uint64_t>(byte_index_for_pnt.back());
+    auto last_index = std::get<uint64_t>(encoding.byte_index_for_pnt.back());
     //the bytes from initial markers are already accounted for.
     //need to add 8 or 16 bytes (depending on whether the lenght of the codestream box is larger)
-    last_index += get_offset_from_box_header_and_pnt<uint32_t>();
+    last_index += get_offset_from_box_header_and_pnt<uint32_t>(encoding);
 
     if (last_index > std::numeric_limits<uint32_t>::max()) {
       return false;
@@ -127,20 +177,24 @@ class JPLM4DTransformModeLightFieldEncoder
   }
 
 
-  std::unique_ptr<CodestreamPointerSetMarkerSegment> get_pnt_marker_segment() {
+  std::unique_ptr<CodestreamPointerSetMarkerSegment> get_pnt_marker_segment(
+      LightFieldEncodingForLambda& encoding) {
     // CodestreamPointerSetMarkerSegment
     if (!transform_mode_encoder_configuration
              ->insert_codestream_pointer_set()) {
       return nullptr;
     }
-    if (is_possible_to_use_32bits_to_encode_all_ptrs()) {
-      const auto& offset = get_offset_from_box_header_and_pnt<uint32_t>();
+    auto& byte_index_for_pnt = encoding.byte_index_for_pnt;
+    if (is_possible_to_use_32bits_to_encode_all_ptrs(encoding)) {
+      const auto& offset =
+          get_offset_from_box_header_and_pnt<uint32_t>(encoding);
       std::transform(byte_index_for_pnt.begin(), byte_index_for_pnt.end(),
           byte_index_for_pnt.begin(), [offset](const auto v) {
             return static_cast<uint32_t>(std::get<uint64_t>(v) + offset);
           });
     } else {
-      const auto& offset = get_offset_from_box_header_and_pnt<uint64_t>();
+      const auto& offset =
+          get_offset_from_box_header_and_pnt<uint64_t>(encoding);
       std::transform(byte_index_for_pnt.begin(), byte_index_for_pnt.end(),
           byte_index_for_pnt.begin(), [offset](const auto v) {
             return static_cast<uint64_t>(std::get<uint64_t>(v) + offset);
@@ -151,11 +205,12 @@ class JPLM4DTransformModeLightFieldEncoder
   }
 
 
-  std::unique_ptr<ContiguousCodestreamBox> get_contiguous_codestream_box() {
-    auto codestream_code =
-        std::move(hierarchical_4d_encoder.move_codestream_code_out());
+  std::unique_ptr<ContiguousCodestreamBox> get_contiguous_codestream_box(
+      LightFieldEncodingForLambda& encoding) {
+    auto codestream_code = std::move(
+        encoding.hierarchical_4d_encoder.move_codestream_code_out());
 
-    auto pnt = get_pnt_marker_segment();
+    auto pnt = get_pnt_marker_segment(encoding);
     if (pnt) {
       codestream_code->insert_bytes(first_sob_position, pnt->get_bytes());
     }
@@ -176,10 +231,200 @@ class JPLM4DTransformModeLightFieldEncoder
   }
 
 
+  /**
+   * \brief      Gets the average number of bytes per 4D block (of a channel)
+   * that reaches the target bitrate, given the size of the headers
+   */
+  double get_target_bytes_per_block() const {
+    const auto target_bpp =
+        transform_mode_encoder_configuration->get_target_bpp();
+    const auto target_bytes =
+        target_bpp *
+        static_cast<double>(
+            ref_to_lightfield.get_total_number_of_pixels_per_channel()) /
+        8.0;
+    //the jpl file does not have the contiguous codestream box yet
+    auto header_bytes = static_cast<double>(
+        this->jpl_file->size() + 8 + first_sob_position);
+    if (transform_mode_encoder_configuration
+            ->insert_codestream_pointer_set()) {
+      header_bytes += get_size_of_pnt<uint32_t>();
+    }
+    const auto target_bytes_per_block =
+        (target_bytes - header_bytes) / static_cast<double>(number_of_blocks);
+    if (target_bytes_per_block < 2.0) {
+      throw JPLM4DTransformModeLightFieldEncoderExceptions::
+          TargetBitrateTooLowException(target_bpp);
+    }
+    return target_bytes_per_block;
+  }
+
+
+  /**
+   * \brief      Gets the average number of bytes spent in the given blocks
+   * when encoded with lambda (in a codestream that is discarded)
+   */
+  template<typename Blocks>
+  double get_average_bytes_per_block(const Blocks& blocks, double lambda) {
+    auto encoding = LightFieldEncodingForLambda(
+        lambda, transform_mode_encoder_configuration
+                    ->get_minimal_transform_dimension());
+    setup_encoding(encoding);
+    int level_shift = -std::pow(2.0, ref_to_lightfield.get_views_bpp() - 1);
+    for (const auto& [position, size, channel] : blocks) {
+      auto block_4d = ref_to_lightfield.get_block_4D_from(
+          channel, position, size, level_shift);
+      if (transform_cache) {
+        transform_cache->clear();
+      }
+      run_for_block_4d(encoding, channel, position, size, block_4d,
+          std::chrono::steady_clock::now());
+    }
+    const auto bytes =
+        std::accumulate(encoding.bytes_per_channel.begin(),
+            encoding.bytes_per_channel.end(), std::size_t(0));
+    return static_cast<double>(bytes) / static_cast<double>(blocks.size());
+  }
+
+
+  /**
+   * \brief      Chooses the lambda that reaches the target bitrate, with
+   * the rate of a subsample of the 4D blocks for a few lambdas
+   */
+  void calibrate_lambda() {
+    const auto event = TraceEvents::ScopedEvent("rate_control", "codec");
+    const auto& blocks = this->get_block_coordinates_and_sizes();
+    number_of_blocks = blocks.size();
+    rate_control = std::make_unique<RateControl>(get_target_bytes_per_block());
+
+    auto calibration_blocks = std::vector<typename std::decay_t<
+        decltype(blocks)>::value_type>();
+    for (const auto& index :
+        RateControl::get_calibration_block_indices(number_of_blocks)) {
+      calibration_blocks.push_back(blocks[index]);
+    }
+
+    auto& encoding = *(encodings.front());
+    auto lambda = encoding.lambda;
+    for (auto i = std::size_t(0);
+         i < RateControl::maximum_calibration_iterations; ++i) {
+      const auto bytes_per_block =
+          get_average_bytes_per_block(calibration_blocks, lambda);
+      rate_control->add_calibration_point(lambda, bytes_per_block);
+      if (transform_mode_encoder_configuration->is_verbose()) {
+        std::cout << "Rate control: lambda " << lambda << " spends "
+                  << bytes_per_block << " bytes per 4D block (target "
+                  << rate_control->get_target_bytes_per_block() << ")\n";
+      }
+      if (rate_control->is_calibrated(RateControl::calibration_tolerance)) {
+        break;
+      }
+      lambda = rate_control->get_lambda();
+    }
+    encoding.lambda = rate_control->get_lambda();
+    if (transform_mode_encoder_configuration->is_verbose()) {
+      std::cout << "Rate control: using lambda " << encoding.lambda << '\n';
+    }
+  }
+
+
+  /**
+   * \brief      Writes the state of the encodings to the checkpoint file,
+   * with their codestreams written directly (without copies)
+   */
+  void write_checkpoint() const {
+    auto checkpoint = EncodingCheckpoint();
+    checkpoint.number_of_encoded_blocks = number_of_encoded_blocks;
+    auto codestreams = std::vector<const ContiguousCodestreamCode*>();
+    for (const auto& encoding : encodings) {
+      auto state = EncodingCheckpoint::EncodingState();
+      state.lambda = encoding->lambda;
+      state.sse_per_channel = encoding->sse_per_channel;
+      state.bytes_per_channel.assign(encoding->bytes_per_channel.begin(),
+          encoding->bytes_per_channel.end());
+      for (const auto& index : encoding->byte_index_for_pnt) {
+        state.byte_index_for_pnt.push_back(std::get<uint64_t>(index));
+      }
+      codestreams.push_back(
+          &encoding->hierarchical_4d_encoder.get_ref_to_codestream_code());
+      checkpoint.encodings.push_back(std::move(state));
+    }
+    checkpoint.write(
+        transform_mode_encoder_configuration->get_checkpoint_filename(),
+        codestreams);
+  }
+
+
+  /**
+   * \brief      Restores the encodings from the checkpoint file, if there is
+   * one, so that the 4D blocks it contains are skipped
+   */
+  void resume_from_checkpoint() {
+    using JPLM4DTransformModeLightFieldEncoderExceptions::
+        InvalidCheckpointException;
+    const auto checkpoint = EncodingCheckpoint::read(
+        transform_mode_encoder_configuration->get_checkpoint_filename());
+    if (!checkpoint) {
+      return;
+    }
+    const auto number_of_resumed_encoded_blocks =
+        checkpoint->number_of_encoded_blocks;
+    if (checkpoint->encodings.size() != encodings.size()) {
+      throw InvalidCheckpointException("it has other lambdas");
+    }
+    if (number_of_resumed_encoded_blocks >
+        this->get_block_coordinates_and_sizes().size()) {
+      throw InvalidCheckpointException("it has other 4D blocks");
+    }
+    for (auto i = std::size_t(0); i < encodings.size(); ++i) {
+      auto& encoding = *(encodings[i]);
+      const auto& state = checkpoint->encodings[i];
+      //with a target bitrate, the lambda is the calibrated one
+      if (!transform_mode_encoder_configuration->has_target_bpp() &&
+          (state.lambda != encoding.lambda)) {
+        throw InvalidCheckpointException("it has other lambdas");
+      }
+      if ((state.byte_index_for_pnt.size() !=
+              number_of_resumed_encoded_blocks) ||
+          (state.sse_per_channel.size() != encoding.sse_per_channel.size()) ||
+          (state.bytes_per_channel.size() !=
+              encoding.bytes_per_channel.size())) {
+        throw InvalidCheckpointException("it has other 4D blocks");
+      }
+      //the headers already written must be the ones of the checkpoint
+      auto& codestream =
+          encoding.hierarchical_4d_encoder.get_ref_to_codestream_code();
+      const auto header_size = codestream.size();
+      if (state.codestream.size() < header_size) {
+        throw InvalidCheckpointException("its codestream is truncated");
+      }
+      for (auto j = uint64_t(0); j < header_size; ++j) {
+        if (codestream.get_byte_at(j) != state.codestream[j]) {
+          throw InvalidCheckpointException(
+              "its light field configuration is different");
+        }
+      }
+      codestream.insert_bytes(header_size,
+          std::vector<std::byte>(
+              state.codestream.begin() + header_size, state.codestream.end()));
+      encoding.lambda = state.lambda;
+      encoding.sse_per_channel = state.sse_per_channel;
+      encoding.bytes_per_channel.assign(
+          state.bytes_per_channel.begin(), state.bytes_per_channel.end());
+      encoding.byte_index_for_pnt.assign(
+          state.byte_index_for_pnt.begin(), state.byte_index_for_pnt.end());
+    }
+    number_of_resumed_blocks = number_of_resumed_encoded_blocks;
+    if (transform_mode_encoder_configuration->is_verbose()) {
+      std::cout << "Resuming the encoding after " << number_of_resumed_blocks
+                << " 4D blocks\n";
+    }
+  }
+
+
   void check_lightfield_size() const {
     const auto& size_from_configuration = this->
-        transform_mode_encoder_configuration->
-        get_lightfield_io_configurations().get_size();
+        transform_mode_encoder_configuration->get_lightfield_dimension();
     const auto& size_from_files = this->light_field->get_dimensions();
     if (size_from_configuration != size_from_files) {
       throw JPLM4DTransformModeLightFieldEncoderExceptions::
@@ -194,23 +439,33 @@ class JPLM4DTransformModeLightFieldEncoder
   JPLM4DTransformModeLightFieldEncoder(
       std::shared_ptr<JPLMEncoderConfigurationLightField4DTransformMode>
           configuration)
-      : JPLMLightFieldCodec<PelType>(
+      : JPLM4DTransformModeLightFieldEncoder(configuration,
             std::make_unique<LightFieldTransformMode<PelType>>(
-                configuration->get_lightfield_io_configurations()),
-            *configuration),
+                configuration->get_lightfield_io_configurations())) {
+  }
+
+
+  /**
+   * \brief      Constructs a new instance that encodes the given light field
+   *
+   * \param[in]  configuration  The configuration (its input path is not used)
+   * \param      light_field    The light field, e.g., with views in memory
+   */
+  JPLM4DTransformModeLightFieldEncoder(
+      std::shared_ptr<JPLMEncoderConfigurationLightField4DTransformMode>
+          configuration,
+      std::unique_ptr<LightFieldTransformMode<PelType>>&& light_field)
+      : JPLMLightFieldCodec<PelType>(std::move(light_field), *configuration),
         JPLM4DTransformModeLightFieldCodec<PelType>(
-            {configuration->get_lightfield_io_configurations().get_size()},
+            {configuration->get_lightfield_dimension()},
             {configuration->get_maximal_transform_sizes()}, *configuration),
         JPLMLightFieldEncoder<PelType>(*configuration),
         transform_mode_encoder_configuration(configuration),
-        transform_partition(transform_mode_encoder_configuration
-                                ->get_minimal_transform_dimension()),
         ref_to_lightfield(static_cast<LightFieldTransformMode<PelType>&>(
             *(this->light_field))),
         lightfield_configuration_marker_segment(
             {transform_mode_encoder_configuration
-                    ->get_lightfield_io_configurations()
-                    .get_size()},  //lightfield_dimension,
+                    ->get_lightfield_dimension()},  //lightfield_dimension,
             transform_mode_encoder_configuration->get_bitdepths(),  //Ssiz
             {transform_mode_encoder_configuration
                     ->get_maximal_transform_sizes()},  //block_dimension,
@@ -220,39 +475,75 @@ class JPLM4DTransformModeLightFieldEncoder
 
           check_lightfield_size();
 
-    transform_partition.mPartitionData.set_dimension(
-        transform_mode_encoder_configuration
-            ->get_maximal_transform_dimension());
-    setup_hierarchical_4d_encoder();
-
-    this->setup_transform_coefficients(true,
+    this->setup_transform_coefficients(
         transform_mode_encoder_configuration->get_maximal_transform_sizes(),
         transform_mode_encoder_configuration->get_transform_scalings());
 
-
-    // write_initial_data_to_codestream();
-    hierarchical_4d_encoder.write_marker(
-        Marker::SOC);  //writes the start of codestream
-    hierarchical_4d_encoder.write_lightfield_configuration_marker_segment(
-        lightfield_configuration_marker_segment);
+    const auto lambdas = transform_mode_encoder_configuration->get_lambdas();
+    if (lambdas.size() > 1) {
+      //the transforms of a block are computed once and shared by all lambdas
+      transform_cache = std::make_unique<TransformCache>();
+    }
+    const auto partition_search_threads = Parallel::get_number_of_threads(
+        transform_mode_encoder_configuration->get_partition_search_threads());
+    if (partition_search_threads > 1) {
+      task_scheduler =
+          std::make_unique<Parallel::TaskScheduler>(partition_search_threads);
+    }
+    for (const auto& lambda : lambdas) {
+      encodings.push_back(std::make_unique<LightFieldEncodingForLambda>(
+          lambda, transform_mode_encoder_configuration
+                      ->get_minimal_transform_dimension()));
+      setup_encoding(*encodings.back());
+    }
 
     this->initialize_extension_lengths();
 
+    first_sob_position = encodings.front()
+                             ->hierarchical_4d_encoder
+                             .get_ref_to_codestream_code()
+                             .size();
+  }
+
+
+  void setup_encoding(LightFieldEncodingForLambda& encoding) {
+    auto& transform_partition = encoding.transform_partition;
+    transform_partition.set_trace_depth(
+        transform_mode_encoder_configuration->get_trace_partition_depth());
+    transform_partition.set_dct_coefficients(this->dct_coefficients.get());
+    transform_partition.set_transform_cache(transform_cache.get());
+    transform_partition.set_task_scheduler(task_scheduler.get(),
+        transform_mode_encoder_configuration->get_parallel_partition_depth());
+    transform_partition.set_search_precision(
+        transform_mode_encoder_configuration
+            ->get_partition_search_precision());
+    if (!transform_mode_encoder_configuration->get_block_report_filename()
+             .empty()) {
+      encoding.block_report = std::make_unique<BlockEncodingReport>();
+    }
+    transform_partition.mPartitionData.set_dimension(
+        transform_mode_encoder_configuration
+            ->get_maximal_transform_dimension());
+    setup_hierarchical_4d_encoder(encoding.hierarchical_4d_encoder);
+
+    // write_initial_data_to_codestream();
+    encoding.hierarchical_4d_encoder.write_marker(
+        Marker::SOC);  //writes the start of codestream
+    encoding.hierarchical_4d_encoder
+        .write_lightfield_configuration_marker_segment(
+            lightfield_configuration_marker_segment);
 
     auto number_of_channels =
         ref_to_lightfield.get_number_of_channels_in_view();
 
     for (auto i = decltype(number_of_channels){0}; i < number_of_channels;
          ++i) {
-      sse_per_channel.push_back(0.0);
-      bytes_per_channel.push_back(0);
+      encoding.sse_per_channel.push_back(0.0);
+      encoding.bytes_per_channel.push_back(0);
     }
     //the number of indices will be the number of 4d blocks. Thus,
-    byte_index_for_pnt.reserve(
+    encoding.byte_index_for_pnt.reserve(
         lightfield_configuration_marker_segment.get_number_of_4d_blocks());
-
-    first_sob_position =
-        hierarchical_4d_encoder.get_ref_to_codestream_code().size();
   }
 
 
@@ -262,7 +553,8 @@ class JPLM4DTransformModeLightFieldEncoder
   }
 
 
-  void setup_hierarchical_4d_encoder() {
+  void setup_hierarchical_4d_encoder(
+      Hierarchical4DEncoder& hierarchical_4d_encoder) {
     hierarchical_4d_encoder.set_transform_dimension(
         transform_mode_encoder_configuration
             ->get_maximal_transform_dimension());
@@ -292,11 +584,73 @@ class JPLM4DTransformModeLightFieldEncoder
   virtual ~JPLM4DTransformModeLightFieldEncoder() = default;
 
 
+  /**
+   * @brief      Gets the per 4D block report of the selected lambda (nullptr
+   *             if no report was requested with --block-report)
+   */
+  const BlockEncodingReport* get_block_report() const noexcept {
+    return encodings.at(selected_encoding)->block_report.get();
+  }
+
+
+  /**
+   * @brief      Gets the number of lambdas the light field is encoded with
+   *             (see --lambdas)
+   */
+  std::size_t get_number_of_lambdas() const noexcept {
+    return encodings.size();
+  }
+
+
+  double get_lambda(std::size_t index) const {
+    return encodings.at(index)->lambda;
+  }
+
+
+  /**
+   * @brief      Places the codestream encoded with the lambda of the given
+   *             index in the jpl file (after run). The first lambda is
+   *             selected by default.
+   */
+  void select_lambda(std::size_t index);
+
+
+  virtual void run() override {
+    encoding_start = std::chrono::steady_clock::now();
+    if (transform_mode_encoder_configuration->resumes()) {
+      resume_from_checkpoint();
+    }
+    if (transform_mode_encoder_configuration->has_time_budget()) {
+      time_budget = std::make_unique<TimeBudget>(
+          transform_mode_encoder_configuration->get_time_budget(),
+          this->get_block_coordinates_and_sizes().size() -
+              number_of_resumed_blocks,
+          TimeBudget::get_maximum_partition_depth(
+              transform_mode_encoder_configuration
+                  ->get_maximal_transform_dimension(),
+              transform_mode_encoder_configuration
+                  ->get_minimal_transform_dimension()));
+    }
+    //a resumed encoding keeps the lambda of the checkpoint
+    if (transform_mode_encoder_configuration->has_target_bpp() &&
+        (number_of_resumed_blocks == 0)) {
+      calibrate_lambda();
+    }
+    JPLM4DTransformModeLightFieldCodec<PelType>::run();
+  }
+
+
   void run_for_block_4d(const uint32_t channel,
       const LightfieldCoordinate<uint32_t>& position,
       const LightfieldDimension<uint32_t>& size) override;
 
 
+  void run_for_block_4d(LightFieldEncodingForLambda& encoding,
+      const uint32_t channel, const LightfieldCoordinate<uint32_t>& position,
+      const LightfieldDimension<uint32_t>& size, Block4D& block_4d,
+      std::chrono::steady_clock::time_point start);
+
+
   samilton::ConsoleTable get_console_table() {
     samilton::ConsoleTable table(1, 1, samilton::Alignment::centre);
     samilton::ConsoleTable::TableChars chars;
@@ -315,12 +669,15 @@ class JPLM4DTransformModeLightFieldEncoder
     return table;
   }
 
-  void show_error_estimate();
+  void show_error_estimate(const LightFieldEncodingForLambda& encoding);
 };
 
 
 template<typename PelType>
-void JPLM4DTransformModeLightFieldEncoder<PelType>::show_error_estimate() {
+void JPLM4DTransformModeLightFieldEncoder<PelType>::show_error_estimate(
+    const LightFieldEncodingForLambda& encoding) {
+  const auto& sse_per_channel = encoding.sse_per_channel;
+  const auto& bytes_per_channel = encoding.bytes_per_channel;
   auto number_of_channels = ref_to_lightfield.get_number_of_channels_in_view();
   auto number_of_pels =
       ref_to_lightfield.get_total_number_of_pixels_per_channel();
@@ -336,6 +693,9 @@ void JPLM4DTransformModeLightFieldEncoder<PelType>::show_error_estimate() {
 
   if (transform_mode_encoder_configuration->show_error_estimate()) {
     std::cout << "\n############### Estimated error ###############\n";
+    if (transform_mode_encoder_configuration->has_multiple_lambdas()) {
+      std::cout << "Lambda: " << encoding.lambda << '\n';
+    }
 
     auto table = get_console_table();
     auto line = 0;
@@ -371,7 +731,9 @@ void JPLM4DTransformModeLightFieldEncoder<PelType>::show_error_estimate() {
 
 
 template<typename PelType>
-void JPLM4DTransformModeLightFieldEncoder<PelType>::finalization() {
+void JPLM4DTransformModeLightFieldEncoder<PelType>::select_lambda(
+    std::size_t index) {
+  auto& encoding = *(encodings.at(index));
   auto& codestreams = this->jpl_file->get_reference_to_codestreams();
   auto& first_codestream = *(codestreams.at(0));
   auto& first_codestream_as_part2 =
@@ -379,11 +741,50 @@ void JPLM4DTransformModeLightFieldEncoder<PelType>::finalization() {
   auto& lightfield_box_contents =
       first_codestream_as_part2.get_ref_to_contents();
 
-  auto codestream_box = get_contiguous_codestream_box();
+  auto previous_box =
+      lightfield_box_contents.release_contiguous_codestream_box();
+  if (previous_box) {
+    encodings.at(selected_encoding)->contiguous_codestream_box =
+        std::move(previous_box);
+  }
   lightfield_box_contents.add_contiguous_codestream_box(
-      std::move(codestream_box));
+      std::move(encoding.contiguous_codestream_box));
+  selected_encoding = index;
+}
+
+
+template<typename PelType>
+void JPLM4DTransformModeLightFieldEncoder<PelType>::finalization() {
+  {
+    const auto event =
+        TraceEvents::ScopedEvent("codestream_finalization", "io");
+    for (auto& encoding : encodings) {
+      encoding->contiguous_codestream_box =
+          get_contiguous_codestream_box(*encoding);
+    }
+  }
+
+  if (transform_cache) {
+    transform_cache->clear();
+  }
 
-  this->show_error_estimate();
+  const auto& block_report_filename =
+      transform_mode_encoder_configuration->get_block_report_filename();
+  for (auto i = std::size_t(0); i < encodings.size(); ++i) {
+    const auto& encoding = *(encodings[i]);
+    select_lambda(i);
+    this->show_error_estimate(encoding);
+
+    if (encoding.block_report) {
+      encoding.block_report->write(
+          transform_mode_encoder_configuration->has_multiple_lambdas()
+              ? JPLMEncoderConfigurationLightField4DTransformMode::
+                    get_filename_for_lambda(
+                        block_report_filename, encoding.lambda)
+              : block_report_filename);
+    }
+  }
+  select_lambda(0);
 }
 
 
@@ -391,6 +792,85 @@ template<typename PelType>
 void JPLM4DTransformModeLightFieldEncoder<PelType>::run_for_block_4d(
     const uint32_t channel, const LightfieldCoordinate<uint32_t>& position,
     const LightfieldDimension<uint32_t>& size) {
+  if (number_of_encoded_blocks < number_of_resumed_blocks) {
+    //its codestream was restored from the checkpoint
+    ++number_of_encoded_blocks;
+    return;
+  }
+
+  auto start = std::chrono::steady_clock::now();
+  const auto block_start = start;
+
+  auto depth = uint32_t(0);
+  if (time_budget) {
+    depth = time_budget->get_depth(
+        std::chrono::duration<double>(start - encoding_start).count());
+    for (auto& encoding : encodings) {
+      encoding->transform_partition.set_maximum_depth(depth);
+    }
+    if (transform_mode_encoder_configuration->is_verbose()) {
+      std::cout << "Time budget: partition search depth " << depth << " of "
+                << time_budget->get_maximum_depth() << '\n';
+    }
+  }
+
+  //a new row of 4D blocks starts at u = 0, with its first channel
+  if (rate_control &&
+      transform_mode_encoder_configuration->refines_lambda_per_row() &&
+      (position.get_u() == 0) && (channel == 0) &&
+      (number_of_encoded_blocks > 0)) {
+    auto& encoding = *(encodings.front());
+    const auto encoded_bytes =
+        std::accumulate(encoding.bytes_per_channel.begin(),
+            encoding.bytes_per_channel.end(), std::size_t(0));
+    rate_control->add_encoded_blocks(encoding.lambda,
+        number_of_encoded_blocks - rate_control->get_number_of_encoded_blocks(),
+        encoded_bytes - rate_control->get_encoded_bytes());
+    encoding.lambda = rate_control->get_refined_lambda(number_of_blocks);
+    if (transform_mode_encoder_configuration->is_verbose()) {
+      std::cout << "Rate control: " << encoded_bytes << " bytes in "
+                << number_of_encoded_blocks << " 4D blocks, using lambda "
+                << encoding.lambda << '\n';
+    }
+  }
+
+  int level_shift = -std::pow(2.0, ref_to_lightfield.get_views_bpp() - 1);
+
+  auto block_4d = ref_to_lightfield.get_block_4D_from(
+      channel, position, size, level_shift);
+
+  if (transform_cache) {
+    transform_cache->clear();
+  }
+
+  for (auto& encoding : encodings) {
+    run_for_block_4d(*encoding, channel, position, size, block_4d, start);
+    start = std::chrono::steady_clock::now();
+  }
+  ++number_of_encoded_blocks;
+  if (time_budget) {
+    time_budget->add_encoded_block(
+        depth, std::chrono::duration<double>(start - block_start).count());
+  }
+
+  const auto checkpoint_interval =
+      transform_mode_encoder_configuration->get_checkpoint_interval();
+  if ((checkpoint_interval > 0) &&
+      (number_of_encoded_blocks % checkpoint_interval == 0)) {
+    const auto event = TraceEvents::ScopedEvent("checkpoint", "io");
+    write_checkpoint();
+  }
+}
+
+
+template<typename PelType>
+void JPLM4DTransformModeLightFieldEncoder<PelType>::run_for_block_4d(
+    LightFieldEncodingForLambda& encoding, const uint32_t channel,
+    const LightfieldCoordinate<uint32_t>& position,
+    const LightfieldDimension<uint32_t>& size, Block4D& block_4d,
+    std::chrono::steady_clock::time_point start) {
+  auto& hierarchical_4d_encoder = encoding.hierarchical_4d_encoder;
+  auto& transform_partition = encoding.transform_partition;
   const auto number_of_bytes_in_codestream_before_encoding_block =
       hierarchical_4d_encoder.get_ref_to_codestream_code().size();
 
@@ -398,23 +878,16 @@ void JPLM4DTransformModeLightFieldEncoder<PelType>::run_for_block_4d(
   //adds the size as it points to the first byte of the SOB marker
   //the cast is to ensure the variant will contain only uint64_t at first
   //thus avoinding possible overflow with uint32_T
-  byte_index_for_pnt.push_back(static_cast<uint64_t>(
+  encoding.byte_index_for_pnt.push_back(static_cast<uint64_t>(
       number_of_bytes_in_codestream_before_encoding_block));
   hierarchical_4d_encoder.write_marker(Marker::SOB);
 
-  auto block_4d = ref_to_lightfield.get_block_4D_from(channel, position, size);
-
-  int level_shift = -std::pow(2.0, ref_to_lightfield.get_views_bpp() - 1);
-
-  block_4d += level_shift;
-
-
-  const auto lambda = transform_mode_encoder_configuration->get_lambda();
+  const auto lambda = encoding.lambda;
   auto rd_cost = transform_partition.rd_optimize_transform(
       block_4d, hierarchical_4d_encoder, lambda);
   //<! \todo check what happens to the metrics for shrink = 0;
 
-  sse_per_channel.at(channel) += rd_cost.get_error();
+  encoding.sse_per_channel.at(channel) += rd_cost.get_error();
 
   if (transform_mode_encoder_configuration->is_verbose()) {
     transform_partition.show_partition_codes_and_inferior_bit_plane();
@@ -432,7 +905,18 @@ void JPLM4DTransformModeLightFieldEncoder<PelType>::run_for_block_4d(
       hierarchical_4d_encoder.get_ref_to_codestream_code().size() -
       number_of_bytes_in_codestream_before_encoding_block;
 
-  bytes_per_channel.at(channel) += increase_in_bytes;
+  encoding.bytes_per_channel.at(channel) += increase_in_bytes;
+
+  if (encoding.block_report) {
+    const auto encoding_time = std::chrono::duration<double, std::milli>(
+        std::chrono::steady_clock::now() - start);
+    encoding.block_report->add_record({channel, position, size,
+        increase_in_bytes, rd_cost.get_error(),
+        transform_partition.get_partition_code_as_string(),
+        static_cast<uint32_t>(hierarchical_4d_encoder.get_inferior_bit_plane()),
+        transform_partition.get_number_of_transform_leaves(),
+        encoding_time.count()});
+  }
 }
 
 #endif /* end of include guard: JPLM_LIB_PART2_ENCODER_JPLM4DTRANSFORMMODELIGHTFIELDENCODER_H__ */
\ No newline at end of file
@@ -0,0 +1,241 @@
+/* The copyright in this software is being made available under the BSD
+ * License, included below. This software may be subject to other third party
+ * and contributor rights, including patent rights, and no such rights are
+ * granted under this license.
+ *
+ * Copyright (c) 2010-2019, ITU/ISO/IEC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *  * Neither the name of the ITU/ISO/IEC nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** \file     RateControl.cpp
+ *  \brief    Choice of lambda for a target bitrate
+ *  \details
+ *  \date     2026-10-19
+ */
+
+#include "Lib/Part2/Encoder/TransformMode/RateControl.h"
+#include <algorithm>
+#include <cmath>
+#include <optional>
+#include "Lib/Part2/Encoder/TransformMode/CommonExceptions.h"
+
+
+RateControl::RateControl(double target_bytes_per_block)
+    : target_bytes_per_block(target_bytes_per_block) {
+}
+
+
+std::vector<std::size_t> RateControl::get_calibration_block_indices(
+    std::size_t number_of_blocks) {
+  const auto number_of_calibration_blocks = std::min(
+      std::clamp(number_of_blocks / calibration_subsampling,
+          minimum_number_of_calibration_blocks,
+          maximum_number_of_calibration_blocks),
+      number_of_blocks);
+  auto indices = std::vector<std::size_t>();
+  indices.reserve(number_of_calibration_blocks);
+  for (auto i = std::size_t(0); i < number_of_calibration_blocks; ++i) {
+    //the center of each of the number_of_calibration_blocks intervals
+    indices.push_back(
+        ((2 * i + 1) * number_of_blocks) / (2 * number_of_calibration_blocks));
+  }
+  return indices;
+}
+
+
+void RateControl::add_calibration_point(double lambda, double bytes_per_block) {
+  //a block has at least its SOB marker, thus the rate is never zero
+  calibration_points.emplace_back(lambda, std::max(bytes_per_block, 1.0));
+}
+
+
+bool RateControl::is_calibrated(double tolerance) const {
+  if (calibration_points.empty()) {
+    return false;
+  }
+  const auto& bytes_per_block = calibration_points.back().second;
+  return std::abs(bytes_per_block - target_bytes_per_block) <=
+         tolerance * target_bytes_per_block;
+}
+
+
+std::pair<const RateControl::Point*, const RateControl::Point*>
+RateControl::get_bracket() const {
+  const Point* above = nullptr;
+  const Point* below = nullptr;
+  for (const auto& point : calibration_points) {
+    const auto& [lambda, bytes_per_block] = point;
+    if (bytes_per_block >= target_bytes_per_block) {
+      if (!above || lambda > above->first) {
+        above = &point;
+      }
+    } else if (!below || lambda < below->first) {
+      below = &point;
+    }
+  }
+  return {above, below};
+}
+
+
+double RateControl::get_slope() const {
+  //least squares fit in the log-log plane of the points whose rate may be
+  //asked for by the refinement (the rate saturates away from the target) or,
+  //when there are not enough of them, the slope across the target
+  auto n = 0.0, sum_x = 0.0, sum_y = 0.0, sum_xx = 0.0, sum_xy = 0.0;
+  for (const auto& [lambda, bytes_per_block] : calibration_points) {
+    const auto ratio = bytes_per_block / target_bytes_per_block;
+    if (ratio < 1.0 / maximum_refinement_ratio ||
+        ratio > maximum_refinement_ratio) {
+      continue;
+    }
+    const auto x = std::log(lambda);
+    const auto y = std::log(bytes_per_block);
+    n += 1.0;
+    sum_x += x;
+    sum_y += y;
+    sum_xx += x * x;
+    sum_xy += x * y;
+  }
+  const auto variance = n * sum_xx - sum_x * sum_x;
+  auto slope = default_slope;
+  if (n >= 2.0 && variance > 0.0) {
+    slope = (n * sum_xy - sum_x * sum_y) / variance;
+  } else {
+    //the rate changes too fast around the target, which is bracketed by
+    //(at most) one of the points
+    const auto [above, below] = get_bracket();
+    if (!above || !below) {
+      return default_slope;
+    }
+    slope = std::log(below->second / above->second) /
+            std::log(below->first / above->first);
+  }
+  if (!std::isfinite(slope)) {
+    return default_slope;
+  }
+  return std::clamp(slope, minimum_slope, maximum_slope);
+}
+
+
+double RateControl::get_lambda() const {
+  if (calibration_points.empty()) {
+    throw JPLM4DTransformModeLightFieldEncoderExceptions::
+        UncalibratedRateControlException();
+  }
+  if (is_calibrated(calibration_tolerance)) {
+    return calibration_points.back().first;
+  }
+  const auto [above, below] = get_bracket();
+  if (above && below) {
+    //Illinois (regula falsi) on the log of the ratio between the rate and the
+    //target, as a function of the log of lambda. The residual of an end of
+    //the bracket is halved each time it is kept twice in a row, which avoids
+    //stalling on the ends where the rate saturates (very small and large
+    //lambdas).
+    auto residual = [this](const Point& point) {
+      return std::log(point.second / target_bytes_per_block);
+    };
+    auto above_residual = residual(*above);
+    auto below_residual = residual(*below);
+    const Point* last_above = nullptr;
+    const Point* last_below = nullptr;
+    auto last_was_above = std::optional<bool>();
+    for (const auto& point : calibration_points) {
+      const auto is_above = point.second >= target_bytes_per_block;
+      if (is_above) {
+        if (!last_above || point.first > last_above->first) {
+          last_above = &point;
+          above_residual = residual(point);
+        }
+        if (last_was_above == true) {
+          below_residual /= 2.0;
+        }
+      } else {
+        if (!last_below || point.first < last_below->first) {
+          last_below = &point;
+          below_residual = residual(point);
+        }
+        if (last_was_above == false) {
+          above_residual /= 2.0;
+        }
+      }
+      last_was_above = is_above;
+    }
+    const auto position = above_residual / (above_residual - below_residual);
+    return above->first * std::pow(below->first / above->first, position);
+  }
+  const auto& [lambda, bytes_per_block] = above ? *above : *below;
+  const auto step =
+      std::clamp(std::pow(target_bytes_per_block / bytes_per_block,
+                     1.0 / get_slope()),
+          1.0 / maximum_calibration_step, maximum_calibration_step);
+  return std::clamp(lambda * step, minimum_lambda, maximum_lambda);
+}
+
+
+double RateControl::get_lambda_for(double bytes_per_block) const {
+  return std::clamp(
+      get_lambda() *
+          std::pow(bytes_per_block / target_bytes_per_block, 1.0 / get_slope()),
+      minimum_lambda, maximum_lambda);
+}
+
+
+void RateControl::add_encoded_blocks(
+    double lambda, std::size_t number_of_blocks, std::size_t bytes) {
+  number_of_encoded_blocks += number_of_blocks;
+  encoded_bytes += bytes;
+  last_lambda = lambda;
+  predicted_bytes += static_cast<double>(number_of_blocks) *
+                     target_bytes_per_block *
+                     std::pow(lambda / get_lambda(), get_slope());
+}
+
+
+double RateControl::get_refined_lambda(std::size_t number_of_blocks) const {
+  if ((number_of_encoded_blocks >= number_of_blocks) ||
+      (predicted_bytes <= 0.0)) {
+    return get_lambda();
+  }
+  //the rate of the calibration blocks may differ from the one of the light
+  //field, thus the one predicted for the remaining blocks is corrected by
+  //what was observed in the encoded ones
+  const auto bias =
+      std::clamp(static_cast<double>(encoded_bytes) / predicted_bytes,
+          1.0 / maximum_refinement_ratio, maximum_refinement_ratio);
+  const auto remaining_blocks =
+      static_cast<double>(number_of_blocks - number_of_encoded_blocks);
+  const auto remaining_bytes =
+      target_bytes_per_block * static_cast<double>(number_of_blocks) -
+      static_cast<double>(encoded_bytes);
+  const auto ratio = std::clamp(
+      remaining_bytes / (remaining_blocks * bias * target_bytes_per_block),
+      1.0 / maximum_refinement_ratio, maximum_refinement_ratio);
+  return std::clamp(get_lambda_for(ratio * target_bytes_per_block),
+      last_lambda / maximum_refinement_step,
+      last_lambda * maximum_refinement_step);
+}
@@ -0,0 +1,191 @@
+/* The copyright in this software is being made available under the BSD
+ * License, included below. This software may be subject to other third party
+ * and contributor rights, including patent rights, and no such rights are
+ * granted under this license.
+ *
+ * Copyright (c) 2010-2019, ITU/ISO/IEC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *  * Neither the name of the ITU/ISO/IEC nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** \file     RateControl.h
+ *  \brief    Choice of lambda for a target bitrate
+ *  \details  The rate of the 4D transform mode encoder, in bytes per 4D
+ *            block, is modelled as a power of lambda (a line in the log-log
+ *            plane). The model is calibrated by encoding a subsample of the
+ *            4D blocks with a few lambdas, and is then used to choose the
+ *            lambda of the whole light field and, optionally, to correct it
+ *            after each row of 4D blocks given the bytes actually spent.
+ *  \date     2026-10-19
+ */
+
+#ifndef JPLM_LIB_PART2_ENCODER_TRANSFORMMODE_RATECONTROL_H__
+#define JPLM_LIB_PART2_ENCODER_TRANSFORMMODE_RATECONTROL_H__
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+
+class RateControl {
+ public:
+  static constexpr double default_slope =
+      -0.4;  //!< Log-log slope used while it cannot be fitted
+  static constexpr double minimum_slope = -3.0;
+  static constexpr double maximum_slope = -0.05;
+  static constexpr double minimum_lambda = 1e-2;
+  static constexpr double maximum_lambda = 1e9;
+  static constexpr double maximum_calibration_step =
+      100.0;  //!< Bounds the change of lambda before the target is bracketed
+  static constexpr double maximum_refinement_ratio =
+      4.0;  //!< Bounds the correction of the rate of the remaining blocks
+  static constexpr double maximum_refinement_step =
+      2.0;  //!< Bounds the change of lambda between refinements
+  static constexpr std::size_t calibration_subsampling =
+      16;  //!< One in this many 4D blocks is used in the calibration
+  static constexpr std::size_t minimum_number_of_calibration_blocks = 4;
+  static constexpr std::size_t maximum_number_of_calibration_blocks = 32;
+  static constexpr std::size_t maximum_calibration_iterations = 6;
+  static constexpr double calibration_tolerance = 0.02;
+
+ private:
+  using Point = std::pair<double, double>;  //!< (lambda, bytes per block)
+  double target_bytes_per_block;
+  std::vector<Point> calibration_points;
+  std::size_t number_of_encoded_blocks = 0;
+  std::size_t encoded_bytes = 0;
+  double predicted_bytes = 0.0;  //!< For the encoded blocks
+  double last_lambda = 0.0;  //!< Of the last encoded blocks
+
+  /**
+   * \brief      Gets the points with the largest lambda that spends at least
+   * the target and with the smallest lambda that spends less than it (if
+   * any)
+   */
+  std::pair<const Point*, const Point*> get_bracket() const;
+
+ public:
+  /**
+   * \brief      Constructs a new instance
+   *
+   * \param[in]  target_bytes_per_block  The average number of bytes per 4D
+   *                                     block (of a channel) to be reached
+   */
+  explicit RateControl(double target_bytes_per_block);
+
+
+  ~RateControl() = default;
+
+
+  double get_target_bytes_per_block() const noexcept {
+    return target_bytes_per_block;
+  }
+
+
+  /**
+   * \brief      Gets the indices of the blocks used in the calibration,
+   * evenly spread over all blocks (in their encoding order)
+   */
+  static std::vector<std::size_t> get_calibration_block_indices(
+      std::size_t number_of_blocks);
+
+
+  /**
+   * \brief      Adds the average number of bytes per block obtained when
+   * encoding the calibration blocks with lambda
+   */
+  void add_calibration_point(double lambda, double bytes_per_block);
+
+
+  std::size_t get_number_of_calibration_points() const noexcept {
+    return calibration_points.size();
+  }
+
+
+  /**
+   * \brief      Whether the last calibration point is within the (relative)
+   * tolerance of the target
+   */
+  bool is_calibrated(double tolerance) const;
+
+
+  /**
+   * \brief      Gets the slope of the rate in the log-log plane, fitted to
+   * the calibration points close to the target (or across it)
+   */
+  double get_slope() const;
+
+
+  /**
+   * \brief      Gets the lambda expected to reach the target: the one of the
+   * last point when it is within the calibration tolerance, the log-log
+   * interpolation between the points that bracket the target or, while it is
+   * not bracketed, a (bounded) step from the closest point.
+   */
+  double get_lambda() const;
+
+
+  /**
+   * \brief      Gets the lambda expected to encode the blocks with the given
+   * average number of bytes, relative to get_lambda()
+   */
+  double get_lambda_for(double bytes_per_block) const;
+
+
+  /**
+   * \brief      Adds blocks encoded with lambda, used to correct the rate
+   * predicted by the calibration for the remaining blocks
+   *
+   * \param[in]  lambda            The lambda used in the blocks
+   * \param[in]  number_of_blocks  The number of blocks
+   * \param[in]  bytes             The bytes spent in the blocks
+   */
+  void add_encoded_blocks(
+      double lambda, std::size_t number_of_blocks, std::size_t bytes);
+
+
+  std::size_t get_number_of_encoded_blocks() const noexcept {
+    return number_of_encoded_blocks;
+  }
+
+
+  std::size_t get_encoded_bytes() const noexcept {
+    return encoded_bytes;
+  }
+
+
+  /**
+   * \brief      Gets the lambda for the remaining blocks, such that the whole
+   * light field reaches the target given the bytes spent so far. The rate
+   * predicted for them is scaled by the ratio between the bytes spent in the
+   * encoded blocks and the ones predicted for those.
+   *
+   * \param[in]  number_of_blocks  The total number of blocks
+   */
+  double get_refined_lambda(std::size_t number_of_blocks) const;
+};
+
+#endif /* end of include guard: JPLM_LIB_PART2_ENCODER_TRANSFORMMODE_RATECONTROL_H__ */
@@ -0,0 +1,123 @@
+/* The copyright in this software is being made available under the BSD
+ * License, included below. This software may be subject to other third party
+ * and contributor rights, including patent rights, and no such rights are
+ * granted under this license.
+ *
+ * Copyright (c) 2010-2019, ITU/ISO/IEC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *  * Neither the name of the ITU/ISO/IEC nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** \file     TimeBudget.cpp
+ *  \brief    Choice of the partition search depth for a wall-clock budget
+ *  \details
+ *  \date     2026-10-19
+ */
+
+#include "Lib/Part2/Encoder/TransformMode/TimeBudget.h"
+#include <algorithm>
+#include <cmath>
+#include <optional>
+
+
+TimeBudget::TimeBudget(
+    double budget, std::size_t number_of_blocks, uint32_t maximum_depth)
+    : budget(budget), number_of_blocks(number_of_blocks),
+      maximum_depth(maximum_depth), seconds_per_depth(maximum_depth + 1, 0.0),
+      blocks_per_depth(maximum_depth + 1, 0) {
+}
+
+
+uint32_t TimeBudget::get_maximum_partition_depth(
+    const LightfieldDimension<uint32_t>& maximal_transform_dimension,
+    const LightfieldDimension<uint32_t>& minimal_transform_dimension) {
+  //the largest of the sub-blocks of a split has the rounded up half length
+  auto get_number_of_splits = [](uint32_t length_a, uint32_t length_b,
+                                  uint32_t minimum_a, uint32_t minimum_b) {
+    auto splits = uint32_t(0);
+    while ((length_a >= 2 * minimum_a) && (length_b >= 2 * minimum_b)) {
+      length_a -= length_a / 2;
+      length_b -= length_b / 2;
+      ++splits;
+    }
+    return splits;
+  };
+  const auto& [max_t, max_s, max_v, max_u] = maximal_transform_dimension;
+  const auto& [min_t, min_s, min_v, min_u] = minimal_transform_dimension;
+  return get_number_of_splits(max_v, max_u, min_v, min_u) +
+         get_number_of_splits(max_t, max_s, min_t, min_s);
+}
+
+
+double TimeBudget::get_estimated_seconds(uint32_t depth) const {
+  if (blocks_per_depth[depth] > 0) {
+    return seconds_per_depth[depth] /
+           static_cast<double>(blocks_per_depth[depth]);
+  }
+  //extrapolated from the closest measured depth (the deeper one in a tie)
+  auto closest = std::optional<uint32_t>();
+  for (auto measured = uint32_t(0); measured <= maximum_depth; ++measured) {
+    if (blocks_per_depth[measured] == 0) {
+      continue;
+    }
+    auto distance = [depth](uint32_t other) {
+      return other > depth ? other - depth : depth - other;
+    };
+    if (!closest || distance(measured) <= distance(*closest)) {
+      closest = measured;
+    }
+  }
+  if (!closest) {
+    return 0.0;
+  }
+  return get_estimated_seconds(*closest) *
+         std::pow(depth_time_ratio, static_cast<double>(depth) -
+                                        static_cast<double>(*closest));
+}
+
+
+uint32_t TimeBudget::get_depth(double elapsed_seconds) const {
+  const auto remaining_blocks =
+      number_of_blocks > number_of_encoded_blocks
+          ? number_of_blocks - number_of_encoded_blocks
+          : std::size_t(1);
+  const auto seconds_per_block =
+      (budget - elapsed_seconds) / static_cast<double>(remaining_blocks);
+  for (auto depth = maximum_depth; depth > 0; --depth) {
+    if (get_estimated_seconds(depth) <= seconds_per_block) {
+      return depth;
+    }
+  }
+  return 0;
+}
+
+
+void TimeBudget::add_encoded_block(uint32_t depth, double seconds) {
+  const auto index = std::min(depth, maximum_depth);
+  seconds_per_depth[index] += seconds;
+  ++blocks_per_depth[index];
+  ++number_of_encoded_blocks;
+}
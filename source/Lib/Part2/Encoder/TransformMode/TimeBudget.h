@@ -0,0 +1,124 @@
+/* The copyright in this software is being made available under the BSD
+ * License, included below. This software may be subject to other third party
+ * and contributor rights, including patent rights, and no such rights are
+ * granted under this license.
+ *
+ * Copyright (c) 2010-2019, ITU/ISO/IEC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *  * Neither the name of the ITU/ISO/IEC nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** \file     TimeBudget.h
+ *  \brief    Choice of the partition search depth for a wall-clock budget
+ *  \details  The time left is split evenly across the remaining 4D blocks,
+ *            and each block gets the deepest partition search whose time,
+ *            as measured in the earlier blocks, fits in its share. Depths
+ *            not measured yet are extrapolated from the closest measured
+ *            one. Depth zero (no partitioning) is always allowed, thus the
+ *            codestream stays valid however small the budget is.
+ *  \date     2026-10-19
+ */
+
+#ifndef JPLM_LIB_PART2_ENCODER_TRANSFORMMODE_TIMEBUDGET_H__
+#define JPLM_LIB_PART2_ENCODER_TRANSFORMMODE_TIMEBUDGET_H__
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "Lib/Part2/Common/LightfieldDimension.h"
+
+
+class TimeBudget {
+ public:
+  static constexpr double depth_time_ratio =
+      3.0;  //!< Assumed ratio between the times of consecutive depths
+
+ private:
+  double budget;  //!< In seconds
+  std::size_t number_of_blocks;
+  uint32_t maximum_depth;
+  std::vector<double> seconds_per_depth;  //!< Sum over the encoded blocks
+  std::vector<std::size_t> blocks_per_depth;
+  std::size_t number_of_encoded_blocks = 0;
+
+ public:
+  /**
+   * \brief      Constructs a new instance
+   *
+   * \param[in]  budget            The total time, in seconds
+   * \param[in]  number_of_blocks  The number of 4D blocks (of all channels)
+   * \param[in]  maximum_depth     The depth of the complete partition search
+   */
+  TimeBudget(
+      double budget, std::size_t number_of_blocks, uint32_t maximum_depth);
+
+
+  ~TimeBudget() = default;
+
+
+  /**
+   * \brief      Gets the largest depth a partition of a 4D block may reach,
+   * i.e., the number of spatial plus view splits before the minimal
+   * transform dimension
+   */
+  static uint32_t get_maximum_partition_depth(
+      const LightfieldDimension<uint32_t>& maximal_transform_dimension,
+      const LightfieldDimension<uint32_t>& minimal_transform_dimension);
+
+
+  uint32_t get_maximum_depth() const noexcept {
+    return maximum_depth;
+  }
+
+
+  /**
+   * \brief      Gets the estimated time, in seconds, of a block encoded with
+   * the partition search limited to depth (zero while nothing is measured)
+   */
+  double get_estimated_seconds(uint32_t depth) const;
+
+
+  /**
+   * \brief      Gets the depth of the partition search of the next block
+   *
+   * \param[in]  elapsed_seconds  The time already spent in the encoding
+   */
+  uint32_t get_depth(double elapsed_seconds) const;
+
+
+  /**
+   * \brief      Adds a block encoded with the partition search limited to
+   * depth, which took the given time
+   */
+  void add_encoded_block(uint32_t depth, double seconds);
+
+
+  std::size_t get_number_of_encoded_blocks() const noexcept {
+    return number_of_encoded_blocks;
+  }
+};
+
+#endif /* end of include guard: JPLM_LIB_PART2_ENCODER_TRANSFORMMODE_TIMEBUDGET_H__ */
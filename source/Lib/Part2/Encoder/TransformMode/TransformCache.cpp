@@ -0,0 +1,78 @@
+/* The copyright in this software is being made available under the BSD
+ * License, included below. This software may be subject to other third party
+ * and contributor rights, including patent rights, and no such rights are
+ * granted under this license.
+ *
+ * Copyright (c) 2010-2019, ITU/ISO/IEC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *  * Neither the name of the ITU/ISO/IEC nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** \file     TransformCache.cpp
+ *  \brief    Cache of the 4D transforms evaluated by the partition search
+ *  \details
+ *  \date     2026-10-19
+ */
+
+#include "Lib/Part2/Encoder/TransformMode/TransformCache.h"
+
+
+const TransformCache::Transform* TransformCache::find(
+    const std::tuple<int, int, int, int>& position,
+    const std::tuple<int, int, int, int>& lengths) const {
+  std::lock_guard<std::mutex> lock(mutex);
+  auto it = transforms.find({position, lengths});
+  if (it == transforms.end()) {
+    return nullptr;
+  }
+  return &(it->second);
+}
+
+
+void TransformCache::add(const std::tuple<int, int, int, int>& position,
+    const std::tuple<int, int, int, int>& lengths,
+    const Block4D& coefficients, double mult) {
+  std::lock_guard<std::mutex> lock(mutex);
+  //an existing transform is kept, as a concurrent search may be reading it
+  const auto [it, was_inserted] =
+      transforms.try_emplace({position, lengths});
+  if (was_inserted) {
+    it->second.coefficients = coefficients;
+    it->second.mult = mult;
+  }
+}
+
+
+void TransformCache::clear() noexcept {
+  std::lock_guard<std::mutex> lock(mutex);
+  transforms.clear();
+}
+
+
+std::size_t TransformCache::size() const noexcept {
+  std::lock_guard<std::mutex> lock(mutex);
+  return transforms.size();
+}
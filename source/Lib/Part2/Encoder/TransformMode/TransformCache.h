@@ -0,0 +1,106 @@
+/* The copyright in this software is being made available under the BSD
+ * License, included below. This software may be subject to other third party
+ * and contributor rights, including patent rights, and no such rights are
+ * granted under this license.
+ *
+ * Copyright (c) 2010-2019, ITU/ISO/IEC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *  * Neither the name of the ITU/ISO/IEC nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** \file     TransformCache.h
+ *  \brief    Cache of the 4D transforms evaluated by the partition search
+ *  \details  The 4D DCT of each sub-block visited by the partition search
+ *            depends only on the samples of the 4D block, and not on lambda.
+ *            When a block is optimized for several lambdas (--lambdas), the
+ *            transforms computed for the first lambda are reused by the
+ *            others.
+ *  \date     2026-10-19
+ */
+
+#ifndef JPLM_LIB_PART2_ENCODER_TRANSFORMMODE_TRANSFORMCACHE_H__
+#define JPLM_LIB_PART2_ENCODER_TRANSFORMMODE_TRANSFORMCACHE_H__
+
+#include <cstddef>
+#include <map>
+#include <mutex>
+#include <tuple>
+#include <utility>
+#include "Lib/Part2/Common/TransformMode/Block4D.h"
+
+
+class TransformCache {
+ public:
+  /**
+   * \brief      The 4D DCT of a sub-block and the gain of its coefficients
+   * (see DCT4DBlock::get_coefficients_mult)
+   */
+  struct Transform {
+    Block4D coefficients;
+    double mult = 1.0;
+  };
+
+ private:
+  using Key = std::pair<std::tuple<int, int, int, int>,
+      std::tuple<int, int, int, int>>;
+  std::map<Key, Transform> transforms;
+  mutable std::mutex mutex;  //!< The partition search may be concurrent
+
+ public:
+  TransformCache() = default;
+
+
+  ~TransformCache() = default;
+
+
+  /**
+   * \brief      Finds the transform of the sub-block at position with the
+   * given lengths (nullptr if it was not computed yet)
+   */
+  const Transform* find(const std::tuple<int, int, int, int>& position,
+      const std::tuple<int, int, int, int>& lengths) const;
+
+
+  /**
+   * \brief      Adds (a copy of) the transform of the sub-block at position
+   * with the given lengths, unless it is already there
+   */
+  void add(const std::tuple<int, int, int, int>& position,
+      const std::tuple<int, int, int, int>& lengths,
+      const Block4D& coefficients, double mult);
+
+
+  /**
+   * \brief      Removes all transforms. Must be called before the partition
+   * search of another 4D block.
+   */
+  void clear() noexcept;
+
+
+  std::size_t size() const noexcept;
+};
+
+#endif /* end of include guard: JPLM_LIB_PART2_ENCODER_TRANSFORMMODE_TRANSFORMCACHE_H__ */
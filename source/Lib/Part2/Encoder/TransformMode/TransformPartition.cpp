@@ -66,6 +66,7 @@ TransformPartition::TransformPartition(
 /*! Evaluates the Lagrangian cost of the optimum multiscale transform for the input block as well as the transformed block */
 RDCostResult TransformPartition::rd_optimize_transform(Block4D &input_block,
     Hierarchical4DEncoder &hierarchical_4d_encoder, double lambda) {
+  JPLM_STAGE_TIMER(partition_search);
   double scaled_lambda =
       lambda * hierarchical_4d_encoder.get_number_of_elements_in_transform();
 
@@ -82,6 +83,10 @@ RDCostResult TransformPartition::rd_optimize_transform(Block4D &input_block,
           lengths, hierarchical_4d_encoder, scaled_lambda, partition_code);
 
   mPartitionData = std::move(transformed_block);
+  if (search_precision != TransformPrecision::double_precision) {
+    transform_leaves_in_double_precision(
+        input_block, {0, 0, 0, 0}, lengths, 0);
+  }
 
   hierarchical_4d_encoder.load_optimizer_state();
 
@@ -89,27 +94,182 @@ RDCostResult TransformPartition::rd_optimize_transform(Block4D &input_block,
 }
 
 
+namespace {
+
+using Position = std::tuple<int, int, int, int>;
+
+
+/**
+ * \brief Gets the positions and lengths of the four sub-blocks of a split,
+ *        in the order they are coded
+ */
+std::array<std::pair<Position, Position>, 4> get_sub_blocks(
+    PartitionFlag split, const Position &position, const Position &lengths) {
+  const auto [t, s, v, u] = position;
+  const auto [length_t, length_s, length_v, length_u] = lengths;
+  if (split == PartitionFlag::spatialSplit) {
+    const auto half_v = length_v / 2;
+    const auto half_u = length_u / 2;
+    return {{{position, {length_t, length_s, half_v, half_u}},
+        {{t, s, v, u + half_u},
+            {length_t, length_s, half_v, length_u - half_u}},
+        {{t, s, v + half_v, u + half_u},
+            {length_t, length_s, length_v - half_v, length_u - half_u}},
+        {{t, s, v + half_v, u},
+            {length_t, length_s, length_v - half_v, half_u}}}};
+  }
+  const auto half_t = length_t / 2;
+  const auto half_s = length_s / 2;
+  return {{{position, {half_t, half_s, length_v, length_u}},
+      {{t, s + half_s, v, u},
+          {half_t, length_s - half_s, length_v, length_u}},
+      {{t + half_t, s + half_s, v, u},
+          {length_t - half_t, length_s - half_s, length_v, length_u}},
+      {{t + half_t, s, v, u},
+          {length_t - half_t, half_s, length_v, length_u}}}};
+}
+
+}  // namespace
+
+
 void scale_block(Block4D &transformed_block, double scaling_factor) {
   transformed_block *= scaling_factor;
 }
 
 
-void TransformPartition::show_partition_codes_and_inferior_bit_plane() const {
-  std::cerr << "Partition code: ";
+std::string TransformPartition::get_partition_code_as_string() const {
+  auto code = std::string();
+  code.reserve(partition_code.size());
   for (const auto &flag : partition_code) {
     switch (flag) {
       case PartitionFlag::transform:
-        std::cerr << 'T';
+        code.push_back('T');
         break;
       case PartitionFlag::spatialSplit:
-        std::cerr << 'S';
+        code.push_back('S');
         break;
       case PartitionFlag::viewSplit:
-        std::cerr << 'V';
+        code.push_back('V');
         break;
     }
   }
-  std::cerr << '\n';
+  return code;
+}
+
+
+std::size_t TransformPartition::get_number_of_transform_leaves() const {
+  return std::count(
+      partition_code.begin(), partition_code.end(), PartitionFlag::transform);
+}
+
+
+void TransformPartition::show_partition_codes_and_inferior_bit_plane() const {
+  std::cerr << "Partition code: " << get_partition_code_as_string() << '\n';
+}
+
+
+double TransformPartition::get_transform_of_sub_block(
+    const Block4D &input_block, const std::tuple<int, int, int, int> &position,
+    const std::tuple<int, int, int, int> &lengths,
+    Block4D &transformed_block) {
+  if (transform_cache) {
+    if (const auto *cached = transform_cache->find(position, lengths)) {
+      transformed_block = cached->coefficients;
+      return cached->mult;
+    }
+  }
+
+  transformed_block.set_dimension(lengths);
+  transformed_block.copy_sub_block_from(input_block, position);
+
+  //substituted the multiscale transform call for this new one
+  DCT4DBlock dctblock(transformed_block, *dct_coefficients, search_precision);
+  auto mult = dctblock.get_coefficients_mult();
+  dctblock.swap_data_with_block(transformed_block);
+
+  if (transform_cache) {
+    transform_cache->add(position, lengths, transformed_block, mult);
+  }
+  return mult;
+}
+
+
+/**
+ * \brief Replaces the transforms of the leaves of the partition (from the
+ *        flag at partition_code_index) by double precision ones
+ *
+ * \return The index of the flag following the ones of the node
+ */
+std::size_t TransformPartition::transform_leaves_in_double_precision(
+    const Block4D &input_block, const std::tuple<int, int, int, int> &position,
+    const std::tuple<int, int, int, int> &lengths,
+    std::size_t partition_code_index) {
+  const auto flag = partition_code[partition_code_index++];
+  if (flag != PartitionFlag::transform) {
+    for (const auto &[sub_block_position, sub_block_lengths] :
+        get_sub_blocks(flag, position, lengths)) {
+      partition_code_index = transform_leaves_in_double_precision(input_block,
+          sub_block_position, sub_block_lengths, partition_code_index);
+    }
+    return partition_code_index;
+  }
+
+  auto leaf = Block4D();
+  leaf.set_dimension(lengths);
+  leaf.copy_sub_block_from(input_block, position);
+  DCT4DBlock dctblock(leaf, *dct_coefficients);
+  dctblock.swap_data_with_block(leaf);
+  mPartitionData.copy_sub_block_from(leaf, {0, 0, 0, 0}, position);
+  return partition_code_index;
+}
+
+
+TransformPartition::SplitResult TransformPartition::rd_optimize_split(
+    PartitionFlag split, Block4D &input_block,
+    const std::tuple<int, int, int, int> &position,
+    const std::tuple<int, int, int, int> &lengths,
+    Hierarchical4DEncoder &hierarchical_4d_encoder, double lambda,
+    const RDCostResult *cost_to_beat, uint32_t depth) {
+  const auto sub_blocks = get_sub_blocks(split, position, lengths);
+  auto result = SplitResult();
+  auto transformed_sub_blocks = std::array<Block4D, 4>();
+  for (auto i = std::size_t{0}; i < sub_blocks.size(); ++i) {
+    const auto &[sub_block_position, sub_block_lengths] = sub_blocks[i];
+    auto rd_cost = rd_optimize_transform(input_block,
+        transformed_sub_blocks[i], sub_block_position, sub_block_lengths,
+        hierarchical_4d_encoder, lambda, result.partition_code, depth + 1);
+    if (i == 0) {
+      result.rd_cost = rd_cost;
+      result.rd_cost.add_to_j_cost(2.0 * lambda);
+      result.rd_cost.add_to_rate(2.0);
+    } else {
+      result.rd_cost += rd_cost;
+    }
+    //the remaining sub-blocks only increase the cost
+    if (cost_to_beat &&
+        !(result.rd_cost.get_j_cost() < cost_to_beat->get_j_cost())) {
+      return result;
+    }
+  }
+
+  result.is_complete = true;
+  result.probability_models =
+      hierarchical_4d_encoder.optimization_probability_models;
+  result.transformed_block.set_dimension(lengths);
+  for (auto i = std::size_t{0}; i < sub_blocks.size(); ++i) {
+    const auto &sub_block_position = std::get<0>(sub_blocks[i]);
+    result.transformed_block.copy_sub_block_from(transformed_sub_blocks[i],
+        {0, 0, 0, 0},
+        {std::get<LightFieldDimension::T>(sub_block_position) -
+                std::get<LightFieldDimension::T>(position),
+            std::get<LightFieldDimension::S>(sub_block_position) -
+                std::get<LightFieldDimension::S>(position),
+            std::get<LightFieldDimension::V>(sub_block_position) -
+                std::get<LightFieldDimension::V>(position),
+            std::get<LightFieldDimension::U>(sub_block_position) -
+                std::get<LightFieldDimension::U>(position)});
+  }
+  return result;
 }
 
 
@@ -117,25 +277,29 @@ RDCostResult TransformPartition::rd_optimize_transform(Block4D &input_block,
     Block4D &transformed_block, const std::tuple<int, int, int, int> &position,
     const std::tuple<int, int, int, int> &lengths,
     Hierarchical4DEncoder &hierarchical_4d_encoder, double lambda,
-    std::vector<PartitionFlag> &partition_code) {
+    std::vector<PartitionFlag> &partition_code, uint32_t depth) {
   using LF = LightFieldDimension;
+  auto event = TraceEvents::ScopedEvent(
+      "partition_node", "partition_search", depth < trace_depth);
+  if (event.is_recording()) {
+    event.add_argument("depth", depth);
+    event.add_argument("position",
+        std::vector<int>({std::get<LF::T>(position), std::get<LF::S>(position),
+            std::get<LF::V>(position), std::get<LF::U>(position)}));
+    event.add_argument("lengths",
+        std::vector<int>({std::get<LF::T>(lengths), std::get<LF::S>(lengths),
+            std::get<LF::V>(lengths), std::get<LF::U>(lengths)}));
+  }
   /*! returns the Lagrangian cost of one step of the optimization of the multiscale transform for the input
    * block as well as the transformed block */
-  // std::cerr << "in rd_optimize_transform (" << mEvaluateOptimumBitPlane << ")" << std::endl;
   //saves the current hierarchical_4d_encoder arithmetic model to initial_model.
-  auto initial_model = hierarchical_4d_encoder.optimization_probability_models;
-  std::vector<PartitionFlag> partition_code_spatialSplit;
-  std::vector<PartitionFlag> partition_code_viewSplit;
+  const auto initial_model =
+      hierarchical_4d_encoder.optimization_probability_models;
 
   //copy the input_block to block_0 and apply transformation using the appropriate scale from mt
   Block4D block_0;
-  block_0.set_dimension(lengths);
-  block_0.copy_sub_block_from(input_block, position);
-
-  //substituted the multiscale transform call for this new one
-  DCT4DBlock dctblock(block_0);
-  auto mult = dctblock.get_coefficients_mult();
-  dctblock.swap_data_with_block(block_0);
+  auto mult =
+      get_transform_of_sub_block(input_block, position, lengths, block_0);
   scale_block(block_0, 1.0);  //should use the data from SCC marker segment
 
   //copy the transformed input block to hierarchical_4d_encoder.mSubbandLF
@@ -143,232 +307,100 @@ RDCostResult TransformPartition::rd_optimize_transform(Block4D &input_block,
       block_0;  //copy, its not possible to move...
 
   if (mEvaluateOptimumBitPlane) {
+    JPLM_STAGE_TIMER(optimum_bit_plane_search);
     hierarchical_4d_encoder.set_inferior_bit_plane(
         hierarchical_4d_encoder.get_optimum_bit_plane(lambda));
     hierarchical_4d_encoder.load_optimizer_state();
     mEvaluateOptimumBitPlane = false;
   }
 
+  const bool can_split_spatially = (depth < maximum_depth) &&
+      (std::get<LF::U>(lengths) >= 2 * mlength_u_min) &&
+      (std::get<LF::V>(lengths) >= 2 * mlength_v_min);
+  const bool can_split_views = (depth < maximum_depth) &&
+      (std::get<LF::T>(lengths) >= 2 * mlength_t_min) &&
+      (std::get<LF::S>(lengths) >= 2 * mlength_s_min);
+
+  auto spatial_split = SplitResult();
+  auto view_split = SplitResult();
+  auto encoder_copies = std::vector<std::unique_ptr<Hierarchical4DEncoder>>();
+
+  //the splits are evaluated concurrently with the transform of the whole
+  //block, each from the initial model in its own copy of the encoder. As
+  //they are not stopped early, their costs are only compared at the end
+  auto tasks = std::optional<Parallel::TaskGroup>();
+  const auto run_split = [&](PartitionFlag split, SplitResult &result) {
+    encoder_copies.push_back(hierarchical_4d_encoder.make_optimization_copy());
+    auto &encoder = *encoder_copies.back();
+    encoder.set_optimization_model(initial_model);
+    tasks->run([&, split, &result = result, &encoder = encoder]() {
+      result = rd_optimize_split(split, input_block, position, lengths,
+          encoder, lambda, nullptr, depth);
+    });
+  };
+  if (task_scheduler && depth < parallel_depth &&
+      (can_split_spatially || can_split_views)) {
+    tasks.emplace(*task_scheduler);
+    if (can_split_spatially) {
+      run_split(PartitionFlag::spatialSplit, spatial_split);
+    }
+    if (can_split_views) {
+      run_split(PartitionFlag::viewSplit, view_split);
+    }
+  }
+
   //call rd_optimize_hexadecatree method from hierarchical_4d_encoder to evaluate J0
   hierarchical_4d_encoder.hexadecatree_flags.clear();
-
-  auto probability_model_for_transform = initial_model;
-  auto probability_model_for_spatialSplit = initial_model;
-  auto probability_model_for_viewSplit = initial_model;
-
-  hierarchical_4d_encoder.set_optimization_model(
-      probability_model_for_transform);
+  hierarchical_4d_encoder.set_optimization_model(initial_model);
 
   //initializing the best cost as the cost of not partitioning
-  auto best_rd_cost =
-      hierarchical_4d_encoder.rd_optimize_hexadecatree({0, 0, 0, 0},
-          {block_0.mlength_t, block_0.mlength_s, block_0.mlength_v,
-              block_0.mlength_u},
-          lambda, hierarchical_4d_encoder.get_superior_bit_plane(),
-          hierarchical_4d_encoder.hexadecatree_flags);
-
+  auto best_rd_cost = [&]() {
+    JPLM_STAGE_TIMER(hexadecatree_rd);
+    return hierarchical_4d_encoder.rd_optimize_hexadecatree({0, 0, 0, 0},
+        {block_0.mlength_t, block_0.mlength_s, block_0.mlength_v,
+            block_0.mlength_u},
+        lambda, hierarchical_4d_encoder.get_superior_bit_plane(),
+        hierarchical_4d_encoder.hexadecatree_flags);
+  }();
 
   best_rd_cost.add_to_j_cost(lambda);
   best_rd_cost.add_to_rate(1.0);
-
-  // best_rd_cost.set_error((best_rd_cost.get_error()) /
-  //                        static_cast<double>(block_0.get_number_of_elements()));
-
   best_rd_cost.set_error((best_rd_cost.get_error()) / mult);
 
-  auto partition_mode = PartitionFlag::transform;
-
-  //Restores the current arithmetic model using current_model.
-  probability_model_for_transform =
+  const auto probability_model_for_transform =
       hierarchical_4d_encoder.optimization_probability_models;
-  hierarchical_4d_encoder.set_optimization_model(
-      probability_model_for_spatialSplit);
-
-  Block4D transformed_block_S;
-
-  if ((std::get<LF::U>(lengths) >= 2 * mlength_u_min) &&
-      (std::get<LF::V>(lengths) >= 2 * mlength_v_min)) {
-    std::vector<PartitionFlag> partition_mode_s00;
-    Block4D transformed_block_S00;
-    auto rd_cost_of_spatial_split =
-        rd_optimize_transform(input_block, transformed_block_S00, position,
-            {std::get<LF::T>(lengths), std::get<LF::S>(lengths),
-                std::get<LF::V>(lengths) / 2, std::get<LF::U>(lengths) / 2},
-            hierarchical_4d_encoder, lambda, partition_mode_s00);
-    rd_cost_of_spatial_split.add_to_j_cost(2.0 * lambda);
-    rd_cost_of_spatial_split.add_to_rate(2.0);
-
-    if (rd_cost_of_spatial_split.get_j_cost() < best_rd_cost.get_j_cost()) {
-      std::vector<PartitionFlag> partition_mode_s01;
-      Block4D transformed_block_S01;
-      rd_cost_of_spatial_split +=
-          rd_optimize_transform(input_block, transformed_block_S01,
-              {std::get<LF::T>(position), std::get<LF::S>(position),
-                  std::get<LF::V>(position),
-                  std::get<LF::U>(position) + std::get<LF::U>(lengths) / 2},
-              {std::get<LF::T>(lengths), std::get<LF::S>(lengths),
-                  std::get<LF::V>(lengths) / 2,
-                  std::get<LF::U>(lengths) - std::get<LF::U>(lengths) / 2},
-              hierarchical_4d_encoder, lambda, partition_mode_s01);
-
-      if (rd_cost_of_spatial_split.get_j_cost() < best_rd_cost.get_j_cost()) {
-        std::vector<PartitionFlag> partition_mode_s11;
-        Block4D transformed_block_S11;
-        rd_cost_of_spatial_split +=
-            rd_optimize_transform(input_block, transformed_block_S11,
-                {std::get<LF::T>(position), std::get<LF::S>(position),
-                    std::get<LF::V>(position) + std::get<LF::V>(lengths) / 2,
-                    std::get<LF::U>(position) + std::get<LF::U>(lengths) / 2},
-                {std::get<LF::T>(lengths), std::get<LF::S>(lengths),
-                    std::get<LF::V>(lengths) - std::get<LF::V>(lengths) / 2,
-                    std::get<LF::U>(lengths) - std::get<LF::U>(lengths) / 2},
-                hierarchical_4d_encoder, lambda, partition_mode_s11);
-
-        if (rd_cost_of_spatial_split.get_j_cost() < best_rd_cost.get_j_cost()) {
-          std::vector<PartitionFlag> partition_mode_s10;
-          Block4D transformed_block_S10;
-          rd_cost_of_spatial_split +=
-              rd_optimize_transform(input_block, transformed_block_S10,
-                  {std::get<LF::T>(position), std::get<LF::S>(position),
-                      std::get<LF::V>(position) + std::get<LF::V>(lengths) / 2,
-                      std::get<LF::U>(position)},
-                  {std::get<LF::T>(lengths), std::get<LF::S>(lengths),
-                      std::get<LF::V>(lengths) - std::get<LF::V>(lengths) / 2,
-                      std::get<LF::U>(lengths) / 2},
-                  hierarchical_4d_encoder, lambda, partition_mode_s10);
-
-          if (rd_cost_of_spatial_split.get_j_cost() <
-              best_rd_cost.get_j_cost()) {
-            best_rd_cost = rd_cost_of_spatial_split;
-            partition_mode = PartitionFlag::spatialSplit;
-            partition_code_viewSplit.reserve(
-                partition_code_spatialSplit.size() + partition_mode_s00.size() +
-                partition_mode_s01.size() + partition_mode_s11.size() +
-                partition_mode_s10.size());
-            partition_code_spatialSplit.insert(
-                partition_code_spatialSplit.end(), partition_mode_s00.begin(),
-                partition_mode_s00.end());
-            partition_code_spatialSplit.insert(
-                partition_code_spatialSplit.end(), partition_mode_s01.begin(),
-                partition_mode_s01.end());
-            partition_code_spatialSplit.insert(
-                partition_code_spatialSplit.end(), partition_mode_s11.begin(),
-                partition_mode_s11.end());
-            partition_code_spatialSplit.insert(
-                partition_code_spatialSplit.end(), partition_mode_s10.begin(),
-                partition_mode_s10.end());
-            probability_model_for_spatialSplit =
-                hierarchical_4d_encoder.optimization_probability_models;
-
-            transformed_block_S.set_dimension(lengths);
-
-            transformed_block_S.copy_sub_block_from(transformed_block_S10, 0, 0,
-                0, 0, 0, 0, std::get<LF::V>(lengths) / 2, 0);
-            transformed_block_S.copy_sub_block_from(transformed_block_S11, 0, 0,
-                0, 0, 0, 0, std::get<LF::V>(lengths) / 2,
-                std::get<LF::U>(lengths) / 2);
-            transformed_block_S.copy_sub_block_from(transformed_block_S01, 0, 0,
-                0, 0, 0, 0, 0, std::get<LF::U>(lengths) / 2);
-            transformed_block_S.copy_sub_block_from(
-                transformed_block_S00, 0, 0, 0, 0);
-          }
-        }
-      }
-    }
-  }
 
-  hierarchical_4d_encoder.set_optimization_model(
-      probability_model_for_viewSplit);
-  Block4D transformed_block_V;
-
-  if ((std::get<LF::T>(lengths) >= 2 * mlength_t_min) &&
-      (std::get<LF::S>(lengths) >= 2 * mlength_s_min)) {
-    //optimize partition for Block_V returning JV, the transformed Block_V, partitionCode_S and arithmetic_model_S
-    std::vector<PartitionFlag> partition_mode_v00;
-    Block4D transformed_block_V00;
-    auto rd_cost_of_view_split =
-        rd_optimize_transform(input_block, transformed_block_V00, position,
-            {std::get<LF::T>(lengths) / 2, std::get<LF::S>(lengths) / 2,
-                std::get<LF::V>(lengths), std::get<LF::U>(lengths)},
-            hierarchical_4d_encoder, lambda, partition_mode_v00);
-    rd_cost_of_view_split.add_to_j_cost(2.0 * lambda);
-    rd_cost_of_view_split.add_to_rate(2.0);
-
-    if (rd_cost_of_view_split.get_j_cost() < best_rd_cost.get_j_cost()) {
-      std::vector<PartitionFlag> partition_mode_v01;
-      Block4D transformed_block_V01;
-      rd_cost_of_view_split +=
-          rd_optimize_transform(input_block, transformed_block_V01,
-              {std::get<LF::T>(position),
-                  std::get<LF::S>(position) + std::get<LF::S>(lengths) / 2,
-                  std::get<LF::V>(position), std::get<LF::U>(position)},
-              {std::get<LF::T>(lengths) / 2,
-                  std::get<LF::S>(lengths) - std::get<LF::S>(lengths) / 2,
-                  std::get<LF::V>(lengths), std::get<LF::U>(lengths)},
-              hierarchical_4d_encoder, lambda, partition_mode_v01);
-
-
-      if (rd_cost_of_view_split.get_j_cost() < best_rd_cost.get_j_cost()) {
-        std::vector<PartitionFlag> partition_mode_v11;
-        Block4D transformed_block_V11;
-        rd_cost_of_view_split +=
-            rd_optimize_transform(input_block, transformed_block_V11,
-                {std::get<LF::T>(position) + std::get<LF::T>(lengths) / 2,
-                    std::get<LF::S>(position) + std::get<LF::S>(lengths) / 2,
-                    std::get<LF::V>(position), std::get<LF::U>(position)},
-                {std::get<LF::T>(lengths) - std::get<LF::T>(lengths) / 2,
-                    std::get<LF::S>(lengths) - std::get<LF::S>(lengths) / 2,
-                    std::get<LF::V>(lengths), std::get<LF::U>(lengths)},
-                hierarchical_4d_encoder, lambda, partition_mode_v11);
-
-
-        if (rd_cost_of_view_split.get_j_cost() < best_rd_cost.get_j_cost()) {
-          std::vector<PartitionFlag> partition_mode_v10;
-          Block4D transformed_block_V10;
-          rd_cost_of_view_split +=
-              rd_optimize_transform(input_block, transformed_block_V10,
-                  {std::get<LF::T>(position) + std::get<LF::T>(lengths) / 2,
-                      std::get<LF::S>(position), std::get<LF::V>(position),
-                      std::get<LF::U>(position)},
-                  {std::get<LF::T>(lengths) - std::get<LF::T>(lengths) / 2,
-                      std::get<LF::S>(lengths) / 2, std::get<LF::V>(lengths),
-                      std::get<LF::U>(lengths)},
-                  hierarchical_4d_encoder, lambda, partition_mode_v10);
-
-
-          if (rd_cost_of_view_split.get_j_cost() < best_rd_cost.get_j_cost()) {
-            best_rd_cost = rd_cost_of_view_split;
-            partition_mode = PartitionFlag::viewSplit;
-            partition_code_viewSplit.reserve(
-                partition_code_viewSplit.size() + partition_mode_v00.size() +
-                partition_mode_v01.size() + partition_mode_v11.size() +
-                partition_mode_v10.size());
-            partition_code_viewSplit.insert(partition_code_viewSplit.end(),
-                partition_mode_v00.begin(), partition_mode_v00.end());
-            partition_code_viewSplit.insert(partition_code_viewSplit.end(),
-                partition_mode_v01.begin(), partition_mode_v01.end());
-            partition_code_viewSplit.insert(partition_code_viewSplit.end(),
-                partition_mode_v11.begin(), partition_mode_v11.end());
-            partition_code_viewSplit.insert(partition_code_viewSplit.end(),
-                partition_mode_v10.begin(), partition_mode_v10.end());
-            probability_model_for_viewSplit =
-                hierarchical_4d_encoder.optimization_probability_models;
-
-            transformed_block_V.set_dimension(lengths);
-
-            transformed_block_V.copy_sub_block_from(transformed_block_V10,
-                {0, 0, 0, 0}, {std::get<LF::T>(lengths) / 2, 0, 0, 0});
-            transformed_block_V.copy_sub_block_from(transformed_block_V11,
-                {0, 0, 0, 0},
-                {std::get<LF::T>(lengths) / 2, std::get<LF::S>(lengths) / 2, 0,
-                    0});
-            transformed_block_V.copy_sub_block_from(transformed_block_V01,
-                {0, 0, 0, 0}, {0, std::get<LF::S>(lengths) / 2, 0, 0});
-            transformed_block_V.copy_sub_block_from(
-                transformed_block_V00, {0, 0, 0, 0});
-          }
-        }
-      }
+  auto partition_mode = PartitionFlag::transform;
+  auto *chosen_split = static_cast<SplitResult *>(nullptr);
+  //a split stopped early in the serial search would not be cheaper, thus
+  //the serial and the parallel searches choose the same partition
+  const auto choose_if_cheaper = [&](PartitionFlag split, SplitResult &result) {
+    if (result.is_complete &&
+        result.rd_cost.get_j_cost() < best_rd_cost.get_j_cost()) {
+      best_rd_cost = result.rd_cost;
+      partition_mode = split;
+      chosen_split = &result;
+    }
+  };
+
+  if (tasks) {
+    tasks->wait();
+    choose_if_cheaper(PartitionFlag::spatialSplit, spatial_split);
+    choose_if_cheaper(PartitionFlag::viewSplit, view_split);
+  } else {
+    if (can_split_spatially) {
+      hierarchical_4d_encoder.set_optimization_model(initial_model);
+      spatial_split = rd_optimize_split(PartitionFlag::spatialSplit,
+          input_block, position, lengths, hierarchical_4d_encoder, lambda,
+          &best_rd_cost, depth);
+      choose_if_cheaper(PartitionFlag::spatialSplit, spatial_split);
+    }
+    if (can_split_views) {
+      hierarchical_4d_encoder.set_optimization_model(initial_model);
+      view_split = rd_optimize_split(PartitionFlag::viewSplit, input_block,
+          position, lengths, hierarchical_4d_encoder, lambda, &best_rd_cost,
+          depth);
+      choose_if_cheaper(PartitionFlag::viewSplit, view_split);
     }
   }
 
@@ -377,35 +409,17 @@ RDCostResult TransformPartition::rd_optimize_transform(Block4D &input_block,
   //inserts the chosen vector of partition flags in the current one
   //copies data from the chosen arithmetic coder model to the current model
   //moves the data from the chosen partition type to the transformed block
-
-  switch (partition_mode) {
-    case PartitionFlag::transform: {
-      hierarchical_4d_encoder.set_optimization_model(
-          probability_model_for_transform);
-      transformed_block = std::move(block_0);
-      break;
-    }
-    case PartitionFlag::spatialSplit: {
-      partition_code.reserve(
-          partition_code.size() + partition_code_spatialSplit.size());
-      partition_code.insert(partition_code.end(),
-          partition_code_spatialSplit.begin(),
-          partition_code_spatialSplit.end());
-      hierarchical_4d_encoder.set_optimization_model(
-          probability_model_for_spatialSplit);
-      transformed_block = std::move(transformed_block_S);
-      break;
-    }
-    case PartitionFlag::viewSplit: {
-      partition_code.reserve(
-          partition_code.size() + partition_code_viewSplit.size());
-      partition_code.insert(partition_code.end(),
-          partition_code_viewSplit.begin(), partition_code_viewSplit.end());
-      hierarchical_4d_encoder.set_optimization_model(
-          probability_model_for_viewSplit);
-      transformed_block = std::move(transformed_block_V);
-      break;
-    }
+  if (chosen_split) {
+    partition_code.insert(partition_code.end(),
+        chosen_split->partition_code.begin(),
+        chosen_split->partition_code.end());
+    hierarchical_4d_encoder.set_optimization_model(
+        chosen_split->probability_models);
+    transformed_block = std::move(chosen_split->transformed_block);
+  } else {
+    hierarchical_4d_encoder.set_optimization_model(
+        probability_model_for_transform);
+    transformed_block = std::move(block_0);
   }
 
   return best_rd_cost;
@@ -413,6 +427,7 @@ RDCostResult TransformPartition::rd_optimize_transform(Block4D &input_block,
 
 void TransformPartition::encode_partition(
     Hierarchical4DEncoder &hierarchical_4d_encoder, double lambda) {
+  JPLM_STAGE_TIMER(abac_encode);
   double scaled_lambda =
       lambda * hierarchical_4d_encoder.get_number_of_elements_in_transform();
 
@@ -43,9 +43,20 @@
 #define JPLM_LIB_PART2_ENCODER_TRANSFORMMODE_TRANSFORMPARTITION_H__
 
 
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <string>
 #include "Lib/Part2/Common/TransformMode/DCT4DBlock.h"
+#include "Lib/Part2/Common/TransformMode/TransformPrecision.h"
 #include "Lib/Part2/Encoder/TransformMode/CommonExceptions.h"
 #include "Lib/Part2/Encoder/TransformMode/Hierarchical4DEncoder.h"
+#include "Lib/Part2/Encoder/TransformMode/TransformCache.h"
+#include "Lib/Utils/Parallel/TaskScheduler.h"
+#include "Lib/Utils/Stats/StageInstrumentation.h"
+#include "Lib/Utils/Stats/TraceEvents.h"
 
 
 class TransformPartition {
@@ -55,6 +66,47 @@ class TransformPartition {
   int mlength_t_min, mlength_s_min, mlength_v_min, mlength_u_min;
   bool
       mEvaluateOptimumBitPlane; /*!< Toggles the optimum bit plane evaluation procedure on and off */
+  uint32_t trace_depth = 0; /*!< Partition nodes above this depth are traced */
+  const DCT4DCoefficientsRegistry *dct_coefficients =
+      nullptr; /*!< Coefficients of the forward transforms (not owned) */
+  TransformCache *transform_cache =
+      nullptr; /*!< Transforms shared with other searches (not owned) */
+  Parallel::TaskScheduler *task_scheduler =
+      nullptr; /*!< Runs the alternatives of the nodes (not owned) */
+  uint32_t parallel_depth =
+      0; /*!< Nodes above this depth evaluate their alternatives in parallel */
+  TransformPrecision search_precision =
+      TransformPrecision::double_precision; /*!< Of the candidate transforms */
+  uint32_t maximum_depth = std::numeric_limits<
+      uint32_t>::max(); /*!< Nodes of this depth are not split */
+
+  /**
+   * @brief      The result of evaluating a split alternative of a node
+   */
+  struct SplitResult {
+    RDCostResult rd_cost = RDCostResult(0.0, 0.0, 0.0, 0.0);
+    bool is_complete =
+        false; /*!< False if stopped early, as it could not be chosen */
+    std::vector<PartitionFlag> partition_code;
+    ProbabilityModelsHandler probability_models;
+    Block4D transformed_block;
+  };
+
+  SplitResult rd_optimize_split(PartitionFlag split, Block4D &input_block,
+      const std::tuple<int, int, int, int> &position,
+      const std::tuple<int, int, int, int> &lengths,
+      Hierarchical4DEncoder &entropyCoder, double lambda,
+      const RDCostResult *cost_to_beat, uint32_t depth);
+
+  double get_transform_of_sub_block(const Block4D &input_block,
+      const std::tuple<int, int, int, int> &position,
+      const std::tuple<int, int, int, int> &lengths,
+      Block4D &transformed_block);
+
+  std::size_t transform_leaves_in_double_precision(const Block4D &input_block,
+      const std::tuple<int, int, int, int> &position,
+      const std::tuple<int, int, int, int> &lengths,
+      std::size_t partition_code_index);
 
  public:
   Block4D mPartitionData; /*!< DCT of all subblocks of the partition */
@@ -69,13 +121,87 @@ class TransformPartition {
       Block4D &transformedBlock, const std::tuple<int, int, int, int> &position,
       const std::tuple<int, int, int, int> &lengths,
       Hierarchical4DEncoder &entropyCoder, double lambda,
-      std::vector<PartitionFlag> &partition_code);
+      std::vector<PartitionFlag> &partition_code, uint32_t depth = 0);
   void encode_partition(Hierarchical4DEncoder &entropyCoder, double lambda);
   RDCostResult encode_partition(const std::tuple<int, int, int, int> &position,
       const std::tuple<int, int, int, int> &lengths,
       Hierarchical4DEncoder &entropyCoder, double lambda);
 
   const std::vector<PartitionFlag> &get_partition_code() const;
+
+  /**
+   * @brief      Gets the partition code as a string, with one character per
+   *             flag (T for transform, S for spatial and V for view split)
+   */
+  std::string get_partition_code_as_string() const;
+
+  std::size_t get_number_of_transform_leaves() const;
+
+  /**
+   * @brief      Sets the depth above which the nodes of the partition search
+   *             are recorded as trace events (when tracing is enabled). Depth
+   *             zero is the 4D block itself.
+   */
+  void set_trace_depth(uint32_t depth) {
+    trace_depth = depth;
+  }
+
+
+  /**
+   * @brief      Sets the coefficients of the forward transforms, which must
+   *             be set before optimizing a block
+   */
+  void set_dct_coefficients(const DCT4DCoefficientsRegistry *coefficients) {
+    dct_coefficients = coefficients;
+  }
+
+
+  /**
+   * @brief      Sets the cache where the transforms of the sub-blocks are
+   *             looked up before being computed (and stored after). It is
+   *             shared by the searches of the same 4D block with different
+   *             lambdas and must be cleared by its owner between blocks.
+   *             Without a cache (nullptr, the default) nothing is kept.
+   */
+  void set_transform_cache(TransformCache *cache) {
+    transform_cache = cache;
+  }
+
+
+  /**
+   * @brief      Sets the scheduler that evaluates the alternatives of the
+   *             nodes (no split, spatial split and view split) of depth
+   *             smaller than maximum_depth as concurrent tasks, each with
+   *             its own copy of the encoder state. The result is the same of
+   *             the serial search. Without a scheduler (nullptr, the default)
+   *             the search is serial.
+   */
+  void set_task_scheduler(
+      Parallel::TaskScheduler *scheduler, uint32_t maximum_depth) {
+    task_scheduler = scheduler;
+    parallel_depth = maximum_depth;
+  }
+
+
+  /**
+   * @brief      Sets the precision of the transforms evaluated by the search.
+   *             In single precision the candidates are only approximated,
+   *             and the transforms of the chosen partition are computed
+   *             again in double precision at the end of the search, thus
+   *             mPartitionData is always the one that is decoded.
+   */
+  void set_search_precision(TransformPrecision precision) {
+    search_precision = precision;
+  }
+
+  /**
+   * @brief      Limits the depth of the partition search: the nodes of depth
+   *             maximum_depth are only transformed, thus zero evaluates only
+   *             the transform of the whole block.
+   */
+  void set_maximum_depth(uint32_t depth) {
+    maximum_depth = depth;
+  }
   void show_partition_codes_and_inferior_bit_plane() const;
 };
 
@@ -51,6 +51,7 @@
 #include "Lib/Utils/Image/Generic2DStructure.h"
 #include "Lib/Utils/Image/ImageExceptions.h"
 #include "Lib/Utils/Image/Metrics.h"
+#include "Lib/Utils/Stats/MemoryAccounting.h"
 
 /**
  * @brief Image Channel class inherits from Generic2DStructure
@@ -62,6 +63,7 @@ template<typename T>
 class ImageChannel : public Generic2DStructure<T> {
  private:
   const std::size_t bpp;
+  MemoryAccounting::TrackedBytes tracked_bytes;
 
  protected:
   /**
@@ -82,7 +84,9 @@ class ImageChannel : public Generic2DStructure<T> {
  public:
   ImageChannel(
       const std::size_t width, const std::size_t height, const std::size_t bpp)
-      : Generic2DStructure<T>(width, height, false), bpp(bpp) {
+      : Generic2DStructure<T>(width, height, false), bpp(bpp),
+        tracked_bytes(MemoryAccounting::Category::images,
+            width * height * sizeof(T)) {
     if (bpp == 0)
       throw ImageChannelExceptions::InvalidSizeException();
     this->alloc_all_resources();
@@ -90,7 +94,9 @@ class ImageChannel : public Generic2DStructure<T> {
 
 
   ImageChannel(const ImageChannel<T>& other) noexcept
-      : Generic2DStructure<T>(other.width, other.height), bpp(other.bpp) {
+      : Generic2DStructure<T>(other.width, other.height), bpp(other.bpp),
+        tracked_bytes(MemoryAccounting::Category::images,
+            this->number_of_elements * sizeof(T)) {
     //FIXME: this should be part of Generic2DStructure copy contructor
     std::memcpy(this->elements.get(), other.elements.get(),
         this->number_of_elements * sizeof(T));
@@ -98,7 +104,8 @@ class ImageChannel : public Generic2DStructure<T> {
 
 
   ImageChannel(ImageChannel<T>&& other) noexcept
-      : Generic2DStructure<T>(other.width, other.height), bpp(other.bpp) {
+      : Generic2DStructure<T>(other.width, other.height), bpp(other.bpp),
+        tracked_bytes(MemoryAccounting::Category::images) {
     //! \todo  check if it is possible to initiallyze the Generic2DStructure with false
     *this = std::move(other);
   }
@@ -108,6 +115,7 @@ class ImageChannel : public Generic2DStructure<T> {
     if (this != &other) {
       this->elements = std::move(other.elements);
       std::swap(this->elements_for_2d_access, other.elements_for_2d_access);
+      tracked_bytes = std::move(other.tracked_bytes);
     }
     return *this;
   }
@@ -41,9 +41,12 @@
 #ifndef JPLM_LIB_UTILS_IMAGE_IMAGECHANNELUTILS_H__
 #define JPLM_LIB_UTILS_IMAGE_IMAGECHANNELUTILS_H__
 
-
+#include <algorithm>
+#include <cstdint>
+#include <type_traits>
 #include "Lib/Utils/Image/ImageChannel.h"
 #include "Lib/Utils/Image/Metrics.h"
+#include "Lib/Utils/Image/StructuralSimilarity.h"
 
 namespace ImageChannelUtils {
 
@@ -83,7 +86,7 @@ double get_mse(const ImageChannel<T>& original_channel,
 }
 
 
-double get_peak_signal_to_noise_ratio(std::size_t bpp, double mse) {
+inline double get_peak_signal_to_noise_ratio(std::size_t bpp, double mse) {
   auto max_value = std::pow(2.0, static_cast<double>(bpp)) - 1;
   return 10.0 * std::log10((max_value * max_value) / mse);
 }
@@ -106,6 +109,106 @@ double get_maximum_absolute_error(const ImageChannel<T>& original_channel,
       typename std::make_signed<T>::type>(error_vector);
 }
 
+
+/**
+ * \brief      Errors between two channels, computed in a single pass
+ */
+struct ErrorStatistics {
+  double sum_of_squared_errors = 0.0;
+  double mean_squared_error = 0.0;
+  std::size_t maximum_absolute_error = 0;
+};
+
+
+/**
+ * \brief      Gets the sum of squared errors, the mean squared error and the
+ *             maximum absolute error between two channels
+ *
+ * \details    The samples of both channels are read once, without building
+ *             the difference image. The differences are accumulated in
+ *             integers, so the results are exact and match
+ *             get_sum_of_squared_errors, get_mse and
+ *             get_maximum_absolute_error for samples of up to 15 bits.
+ *
+ * \param[in]  original_channel  The original channel
+ * \param[in]  encoded_channel   The encoded channel (same size)
+ *
+ * \return     The error statistics.
+ */
+template<typename T>
+ErrorStatistics get_error_statistics(const ImageChannel<T>& original_channel,
+    const ImageChannel<T>& encoded_channel) {
+  static_assert(std::is_integral<T>::value,
+      "The fused error statistics require integral samples");
+  using DifferenceType =
+      typename std::conditional<(sizeof(T) < sizeof(int32_t)), int32_t,
+          int64_t>::type;
+  using SquareType = typename std::conditional<(sizeof(T) < sizeof(int32_t)),
+      uint32_t, uint64_t>::type;
+
+  const auto number_of_pixels = original_channel.get_number_of_pixels();
+  const auto* original = original_channel.data();
+  const auto* encoded = encoded_channel.data();
+
+  uint64_t sum_of_squared_errors = 0;
+  SquareType maximum_absolute_error = 0;
+  for (std::size_t i = 0; i < number_of_pixels; ++i) {
+    const auto difference = static_cast<DifferenceType>(original[i]) -
+                            static_cast<DifferenceType>(encoded[i]);
+    const auto absolute_difference =
+        static_cast<SquareType>(difference < 0 ? -difference : difference);
+    sum_of_squared_errors +=
+        static_cast<uint64_t>(absolute_difference * absolute_difference);
+    maximum_absolute_error =
+        std::max(maximum_absolute_error, absolute_difference);
+  }
+
+  ErrorStatistics statistics;
+  statistics.sum_of_squared_errors =
+      static_cast<double>(sum_of_squared_errors);
+  statistics.mean_squared_error = statistics.sum_of_squared_errors /
+                                  static_cast<double>(number_of_pixels);
+  statistics.maximum_absolute_error =
+      static_cast<std::size_t>(maximum_absolute_error);
+  return statistics;
+}
+
+
+/**
+ * \brief      Gets the samples of a channel as a plane for the structural
+ *             similarity computations
+ */
+template<typename T>
+StructuralSimilarity::Plane get_plane(const ImageChannel<T>& channel) {
+  StructuralSimilarity::Plane plane;
+  plane.width = channel.get_width();
+  plane.height = channel.get_height();
+  const auto* samples = channel.data();
+  plane.samples.assign(samples, samples + channel.get_number_of_pixels());
+  return plane;
+}
+
+
+template<typename T>
+double get_structural_similarity(const ImageChannel<T>& original_channel,
+    const ImageChannel<T>& encoded_channel) {
+  auto max_value =
+      std::pow(2.0, static_cast<double>(original_channel.get_bpp())) - 1;
+  return StructuralSimilarity::get_structural_similarity(
+      get_plane(original_channel), get_plane(encoded_channel), max_value);
+}
+
+
+template<typename T>
+double get_multiscale_structural_similarity(
+    const ImageChannel<T>& original_channel,
+    const ImageChannel<T>& encoded_channel) {
+  auto max_value =
+      std::pow(2.0, static_cast<double>(original_channel.get_bpp())) - 1;
+  return StructuralSimilarity::get_multiscale_structural_similarity(
+      get_plane(original_channel), get_plane(encoded_channel), max_value);
+}
+
 }  // namespace ImageChannelUtils
 
 #endif /* end of include guard: JPLM_LIB_UTILS_IMAGE_IMAGECHANNELUTILS_H__ */
\ No newline at end of file
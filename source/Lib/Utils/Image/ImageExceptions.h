@@ -283,6 +283,15 @@ class DifferentColorSpaceImagesException : public std::exception {
 };
 
 
+class ImageTooSmallForMetricException : public std::exception {
+ public:
+  const char* what() const noexcept override {
+    return "The images are too small for the window (and number of scales) "
+           "of the metric.";
+  }
+};
+
+
 }  // namespace MetricsExceptions
 
 namespace ImageUtilsExceptions {
@@ -49,7 +49,7 @@
 
 
 namespace ImageMetrics {
-enum class Available { PSNR, MSE, SSE, MAX_ABS_ERROR };
+enum class Available { PSNR, MSE, SSE, MAX_ABS_ERROR, SSIM, MS_SSIM };
 
 template<typename T>
 void check_image_properties(
@@ -148,6 +148,62 @@ std::vector<double> get_sum_of_squared_errors(
 }
 
 
+/**
+ * \brief      Gets the SSE, MSE and maximum absolute error of each channel in
+ *             a single pass over the samples of both images
+ */
+template<typename T>
+std::vector<ImageChannelUtils::ErrorStatistics> get_error_statistics(
+    const Image<T>& original_image, const Image<T>& encoded_image) {
+  check_image_properties(original_image, encoded_image);
+  auto number_of_channels = original_image.get_number_of_channels();
+  auto rect_vector = std::vector<ImageChannelUtils::ErrorStatistics>();
+  rect_vector.reserve(number_of_channels);
+
+  for (auto i = decltype(number_of_channels){0}; i < number_of_channels; ++i) {
+    rect_vector.emplace_back(ImageChannelUtils::get_error_statistics(
+        original_image.get_channel(i), encoded_image.get_channel(i)));
+  }
+
+  return rect_vector;
+}
+
+
+template<typename T>
+std::vector<double> get_structural_similarity(
+    const Image<T>& original_image, const Image<T>& encoded_image) {
+  check_image_properties(original_image, encoded_image);
+  auto number_of_channels = original_image.get_number_of_channels();
+  auto rect_vector = std::vector<double>();
+  rect_vector.reserve(number_of_channels);
+
+  for (auto i = decltype(number_of_channels){0}; i < number_of_channels; ++i) {
+    rect_vector.emplace_back(ImageChannelUtils::get_structural_similarity(
+        original_image.get_channel(i), encoded_image.get_channel(i)));
+  }
+
+  return rect_vector;
+}
+
+
+template<typename T>
+std::vector<double> get_multiscale_structural_similarity(
+    const Image<T>& original_image, const Image<T>& encoded_image) {
+  check_image_properties(original_image, encoded_image);
+  auto number_of_channels = original_image.get_number_of_channels();
+  auto rect_vector = std::vector<double>();
+  rect_vector.reserve(number_of_channels);
+
+  for (auto i = decltype(number_of_channels){0}; i < number_of_channels; ++i) {
+    rect_vector.emplace_back(
+        ImageChannelUtils::get_multiscale_structural_similarity(
+            original_image.get_channel(i), encoded_image.get_channel(i)));
+  }
+
+  return rect_vector;
+}
+
+
 template<typename T1, typename T2>
 void different_representations_message() {
   std::cerr << "Images have different representations (" << typeid(T1).name()
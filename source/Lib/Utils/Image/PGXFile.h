@@ -42,10 +42,12 @@
 #ifndef JPLM_LIB_UTILS_IMAGE_PGXFILE_H__
 #define JPLM_LIB_UTILS_IMAGE_PGXFILE_H__
 
+#include <algorithm>
 #include <cstddef>
 #include <type_traits>  //std::is_signed
 #include "Lib/Utils/Image/Image.h"
 #include "Lib/Utils/Image/ImageFile.h"
+#include "Lib/Utils/Image/RasterTools.h"
 #include "Lib/Utils/Image/UndefinedImage.h"
 #include "Lib/Utils/Stream/BinaryTools.h"
 
@@ -152,10 +154,10 @@ class PGXFile : public ImageFile {
     auto image = std::make_unique<UndefinedImage<T>>(
         this->width, this->height, this->depth, 1);
     auto number_of_samples = this->width * this->height;
-    std::vector<T> sample_vector(number_of_samples);
     auto number_of_bytes_required = number_of_samples * sizeof(T);
-    file.read(reinterpret_cast<char*>(sample_vector.data()),
-        number_of_bytes_required);
+    auto image_channel_ptr = image->get_channel(0).data();
+    file.read(
+        reinterpret_cast<char*>(image_channel_ptr), number_of_bytes_required);
 
 
     if (throw_if_missing_bytes && (!file)) {
@@ -163,22 +165,18 @@ class PGXFile : public ImageFile {
           this->filename, file.gcount(), number_of_bytes_required);
     }
 
+    if (auto number_of_samples_read = file.gcount() / sizeof(T);
+        number_of_samples_read < number_of_samples) {
+      std::fill(image_channel_ptr + number_of_samples_read,
+          image_channel_ptr + number_of_samples, T{0});
+    }
+
     if constexpr (sizeof(T) > 1) {
       if (is_different_endianess()) {
-        for (auto& value : sample_vector) {
-          value = change_endianess(value);
-        }
+        RasterTools::swap_endianess(image_channel_ptr, number_of_samples);
       }
     }
 
-    auto image_channel_ptr = image->get_channel(0).data();
-    auto vector_data = sample_vector.data();
-
-    for (auto i = decltype(number_of_samples){0}; i < number_of_samples; ++i) {
-      *image_channel_ptr = *(vector_data++);
-      ++image_channel_ptr;
-    }
-
     file.close();
 
     return image;
@@ -284,16 +282,17 @@ void PGXFile::write_image_to_file(const UndefinedImage<T>& image) {
 
   if constexpr (sizeof(T) > 1) {
     if (is_different_endianess()) {
-      std::vector<T> values;
-      values.reserve(image.get_number_of_pixels());
-      for (const auto& value : image.get_channel(0)) {
-        values.push_back(change_endianess(value));
+      constexpr auto samples_per_buffer = std::size_t(1 << 17);
+      const auto number_of_samples = image.get_number_of_pixels_per_channel();
+      const auto samples = image.get_channel(0).data();
+      std::vector<T> values(std::min(samples_per_buffer, number_of_samples));
+      for (auto i = decltype(number_of_samples){0}; i < number_of_samples;
+           i += values.size()) {
+        const auto count = std::min(values.size(), number_of_samples - i);
+        RasterTools::copy_swapping_endianess(samples + i, values.data(), count);
+        file.write(
+            reinterpret_cast<const char*>(values.data()), count * sizeof(T));
       }
-      // auto size_of_vector = image.get_number_of_pixels();
-      // std::cout << "considered endianess" << std::endl;
-      // std::cout << "values " << values.size() << std::endl;
-      file.write(reinterpret_cast<const char*>(values.data()),
-          image.get_number_of_pixels_per_channel() * sizeof(T));
       file.flush();
       file.close();
       return;
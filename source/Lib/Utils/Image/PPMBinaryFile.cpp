@@ -42,18 +42,6 @@
 #include "Lib/Utils/Stream/BinaryTools.h"
 
 
-void correct_endianess(
-    std::vector<std::tuple<uint16_t, uint16_t, uint16_t>>& pixel_vector) {
-  if constexpr (BinaryTools::using_little_endian()) {
-    for (auto& pixel : pixel_vector) {
-      pixel = std::apply(
-          [](auto... x) { return std::make_tuple((x << 8) | (x >> 8)...); },
-          pixel);
-    }
-  }
-}
-
-
 template<typename T>
 std::unique_ptr<RGBImage<T>> PPMBinaryFile::read_rgb_image_patch(
     std::pair<std::size_t, std::size_t> origin,
@@ -67,35 +55,14 @@ std::unique_ptr<RGBImage<T>> PPMBinaryFile::read_rgb_image_patch(
     auto g_ptr = patch_image->get_channel(1).data();
     auto b_ptr = patch_image->get_channel(2).data();
 
-    std::vector<std::tuple<T, T, T>> rgb_vector(patch_width);
-    std::streamoff vertical_offset(
-        std::get<0>(origin) * width * sizeof(std::tuple<T, T, T>));
+    std::streamoff vertical_offset(std::get<0>(origin) * width * 3 * sizeof(T));
     std::streamoff offset_in_image(
-        vertical_offset + std::get<1>(origin) * sizeof(std::tuple<T, T, T>));
+        vertical_offset + std::get<1>(origin) * 3 * sizeof(T));
 
     std::streamoff offset = raster_begin + offset_in_image;
     file.seekg(offset, std::ios::beg);
 
-    auto number_of_bytes_to_read =
-        rgb_vector.capacity() * sizeof(std::tuple<T, T, T>);
-    auto file_stride = std::streamoff(
-        sizeof(std::tuple<T, T, T>) * width - number_of_bytes_to_read);
-
-    for (decltype(patch_height) i = 0; i < patch_height; ++i) {
-      file.read(
-          reinterpret_cast<char*>(rgb_vector.data()), number_of_bytes_to_read);
-      file.seekg(file_stride, std::ios::cur);
-
-      if constexpr (std::is_same<T, uint16_t>()) {
-        correct_endianess(rgb_vector);
-      }
-
-      for (const auto& pixel : rgb_vector) {
-        *r_ptr++ = std::get<2>(pixel);
-        *g_ptr++ = std::get<1>(pixel);
-        *b_ptr++ = std::get<0>(pixel);
-      }
-    }
+    read_rgb_rows(r_ptr, g_ptr, b_ptr, patch_width, patch_height);
     return patch_image;
   }
   std::cerr << "Unable to open file..." << std::endl;
@@ -123,34 +90,18 @@ std::unique_ptr<RGBImage<T>> PPMBinaryFile::read_full_rgb_image() {
   if (file.is_open()) {
     auto image = std::make_unique<RGBImage<T>>(
         width, height, this->get_number_of_bits_per_pixel());
-    std::vector<std::tuple<T, T, T>> rgb_vector(
-        image->get_number_of_pixels_per_channel());
     file.seekg(raster_begin);
 
-    /* Equivalent to */
-    file.read(reinterpret_cast<char*>(rgb_vector.data()),
-        rgb_vector.size() * sizeof(std::tuple<T, T, T>));
-
-    if (!file) {
-      std::cerr << "Expecting "
-                << image->get_number_of_pixels_per_channel() *
-                       sizeof(std::tuple<T, T, T>)
-                << " bytes." << std::endl;
-      std::cerr << "Read only " << file.gcount() << std::endl;
-    }
-
-    if constexpr (std::is_same<T, uint16_t>()) {
-      correct_endianess(rgb_vector);
-    }
-
-    auto r_ptr = image->get_channel(0).data();
-    auto g_ptr = image->get_channel(1).data();
-    auto b_ptr = image->get_channel(2).data();
+    auto number_of_bytes_read = read_rgb_rows(image->get_channel(0).data(),
+        image->get_channel(1).data(), image->get_channel(2).data(), width,
+        height);
 
-    for (const auto& pixel : rgb_vector) {
-      *r_ptr++ = std::get<2>(pixel);
-      *g_ptr++ = std::get<1>(pixel);
-      *b_ptr++ = std::get<0>(pixel);
+    if (auto number_of_bytes_expected =
+            image->get_number_of_pixels_per_channel() * 3 * sizeof(T);
+        number_of_bytes_read != number_of_bytes_expected) {
+      std::cerr << "Expecting " << number_of_bytes_expected << " bytes."
+                << std::endl;
+      std::cerr << "Read only " << number_of_bytes_read << std::endl;
     }
     return image;
   }
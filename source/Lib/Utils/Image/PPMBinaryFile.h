@@ -41,13 +41,114 @@
 #ifndef JPLM_LIB_UTILS_IMAGE_PPMBINARYFILE_H__
 #define JPLM_LIB_UTILS_IMAGE_PPMBINARYFILE_H__
 
-#include <tuple>
+#include <algorithm>
+#include <vector>
 #include "Lib/Utils/Image/ImageColorSpacesConversor.h"
 #include "Lib/Utils/Image/PixelMapFileBinary.h"
+#include "Lib/Utils/Image/RasterTools.h"
 #include "Lib/Utils/Stream/BinaryTools.h"
 
 
 class PPMBinaryFile : public PixelMapFileBinary {
+ protected:
+  //! Size of the buffer used to (de)interleave the raster
+  static constexpr std::size_t raster_buffer_size_in_bytes = 1 << 18;
+
+
+  /**
+   * @brief      Checks if the (big endian) samples in file must be swapped
+   */
+  template<typename T>
+  static constexpr bool has_different_endianess() {
+    return (sizeof(T) > 1) && BinaryTools::using_little_endian();
+  }
+
+
+  /**
+   * @brief      Number of raster rows that are read or written at once
+   *
+   * @details    Only full width rows are contiguous in file, so patches are
+   *             processed one row at a time.
+   */
+  template<typename T>
+  std::size_t get_rows_per_buffer(std::size_t row_length) const {
+    if (row_length != width) {
+      return 1;
+    }
+    return std::max(std::size_t(1),
+        raster_buffer_size_in_bytes / (3 * sizeof(T) * row_length));
+  }
+
+
+  /**
+   * @brief      Reads rows of samples from the current position of the file
+   *             directly into the channels
+   *
+   * @return     The number of bytes read from file
+   */
+  template<typename T>
+  std::size_t read_rgb_rows(T* r_ptr, T* g_ptr, T* b_ptr,
+      std::size_t row_length, std::size_t number_of_rows) {
+    const auto rows_per_buffer = get_rows_per_buffer<T>(row_length);
+    const auto file_stride =
+        std::streamoff(3 * sizeof(T) * (width - row_length));
+    std::vector<T> interleaved(3 * row_length * rows_per_buffer);
+    std::size_t number_of_bytes_read = 0;
+
+    for (decltype(number_of_rows) row = 0; row < number_of_rows;
+         row += rows_per_buffer) {
+      const auto rows = std::min(rows_per_buffer, number_of_rows - row);
+      const auto number_of_samples = row_length * rows;
+      file.read(reinterpret_cast<char*>(interleaved.data()),
+          3 * number_of_samples * sizeof(T));
+      const auto count = static_cast<std::size_t>(file.gcount());
+      number_of_bytes_read += count;
+      if (count != 3 * number_of_samples * sizeof(T)) {
+        std::fill(interleaved.begin() + count / sizeof(T), interleaved.end(),
+            T{0});
+      }
+      if (file_stride != 0) {
+        file.seekg(file_stride, std::ios::cur);
+      }
+      RasterTools::deinterleave_three_channels<T, has_different_endianess<T>()>(
+          interleaved.data(), r_ptr, g_ptr, b_ptr, number_of_samples);
+      r_ptr += number_of_samples;
+      g_ptr += number_of_samples;
+      b_ptr += number_of_samples;
+    }
+    return number_of_bytes_read;
+  }
+
+
+  /**
+   * @brief      Writes rows of samples from the channels at the current
+   *             position of the file
+   */
+  template<typename T>
+  void write_rgb_rows(const T* r_ptr, const T* g_ptr, const T* b_ptr,
+      std::size_t row_length, std::size_t number_of_rows) {
+    const auto rows_per_buffer = get_rows_per_buffer<T>(row_length);
+    const auto file_stride =
+        std::streamoff(3 * sizeof(T) * (width - row_length));
+    std::vector<T> interleaved(3 * row_length * rows_per_buffer);
+
+    for (decltype(number_of_rows) row = 0; row < number_of_rows;
+         row += rows_per_buffer) {
+      const auto rows = std::min(rows_per_buffer, number_of_rows - row);
+      const auto number_of_samples = row_length * rows;
+      RasterTools::interleave_three_channels<T, has_different_endianess<T>()>(
+          r_ptr, g_ptr, b_ptr, interleaved.data(), number_of_samples);
+      file.write(reinterpret_cast<const char*>(interleaved.data()),
+          3 * number_of_samples * sizeof(T));
+      if (file_stride != 0) {
+        file.seekp(file_stride, std::ios::cur);
+      }
+      r_ptr += number_of_samples;
+      g_ptr += number_of_samples;
+      b_ptr += number_of_samples;
+    }
+  }
+
  public:
   PPMBinaryFile(const std::string& file_name)
       : PixelMapFileBinary(file_name, PixelMapType::P6){};
@@ -122,29 +223,6 @@ class PPMBinaryFile : public PixelMapFileBinary {
     }
     if (file.is_open()) {
       if (image.get_type() == ImageType::RGB) {
-        std::vector<std::tuple<T, T, T>> rgb_vector(
-            image.get_number_of_pixels_per_channel());
-        const T* r_ptr = image[0].data();
-        const T* g_ptr = image[1].data();
-        const T* b_ptr = image[2].data();
-        for (auto& pixel : rgb_vector) {
-          std::get<2>(pixel) = *r_ptr;
-          std::get<1>(pixel) = *g_ptr;
-          std::get<0>(pixel) = *b_ptr;
-          r_ptr++;
-          g_ptr++;
-          b_ptr++;
-        }
-
-        if constexpr (sizeof(T) == 2 && BinaryTools::using_little_endian()) {
-          for (auto& pixel : rgb_vector) {
-            pixel = std::apply(
-                [](auto... x) {
-                  return std::make_tuple((x << 8) | (x >> 8)...);
-                },
-                pixel);
-          }
-        }
         // std::cout << file.tellg() << std::endl;
         auto raster_begin = get_raster_begin();
         if (raster_begin < 0) {
@@ -152,12 +230,9 @@ class PPMBinaryFile : public PixelMapFileBinary {
         } else {
           file.seekp(get_raster_begin(), std::ios::beg);
         }
-        // std::cout << rgb_vector.size() << std::endl;
-        file.write(reinterpret_cast<char*>(rgb_vector.data()),
-            rgb_vector.capacity() * sizeof(std::tuple<T, T, T>));
-        // std::cout << file.tellg() << std::endl;
+        write_rgb_rows(image[0].data(), image[1].data(), image[2].data(),
+            image.get_width(), image.get_height());
         file.flush();
-        // std::cout << file.tellg() << std::endl;
       } else {
         // std::cout << "Image is not RGB..." << std::endl;
         auto rgb_image =
@@ -191,47 +266,14 @@ class PPMBinaryFile : public PixelMapFileBinary {
       if (patch_image.get_type() == ImageType::RGB) {
         auto patch_width = patch_image.get_width();
         auto patch_height = patch_image.get_height();
-        std::vector<std::tuple<T, T, T>> rgb_vector(patch_width);
         std::streamoff vertical_offset(
-            std::get<0>(origin) * width * sizeof(std::tuple<T, T, T>));
+            std::get<0>(origin) * width * 3 * sizeof(T));
         std::streamoff offset_in_image(
-            vertical_offset +
-            std::get<1>(origin) * sizeof(std::tuple<T, T, T>));
-
+            vertical_offset + std::get<1>(origin) * 3 * sizeof(T));
         file.seekp(raster_begin + offset_in_image);
 
-        const T* r_ptr = patch_image[0].data();
-        const T* g_ptr = patch_image[1].data();
-        const T* b_ptr = patch_image[2].data();
-
-        auto number_of_bytes_to_write =
-            rgb_vector.capacity() * sizeof(std::tuple<T, T, T>);
-        auto file_stride = std::streamoff(
-            sizeof(std::tuple<T, T, T>) * width - number_of_bytes_to_write);
-
-
-        for (decltype(patch_height) i = 0; i < patch_height; ++i) {
-          for (auto& pixel : rgb_vector) {
-            std::get<2>(pixel) = *r_ptr;
-            std::get<1>(pixel) = *g_ptr;
-            std::get<0>(pixel) = *b_ptr;
-            r_ptr++;
-            g_ptr++;
-            b_ptr++;
-          }
-          if constexpr (sizeof(T) == 2 && BinaryTools::using_little_endian()) {
-            for (auto& pixel : rgb_vector) {
-              pixel = std::apply(
-                  [](auto... x) {
-                    return std::make_tuple((x << 8) | (x >> 8)...);
-                  },
-                  pixel);
-            }
-          }
-          file.write(reinterpret_cast<char*>(rgb_vector.data()),
-              number_of_bytes_to_write);
-          file.seekp(file_stride, std::ios::cur);
-        }
+        write_rgb_rows(patch_image[0].data(), patch_image[1].data(),
+            patch_image[2].data(), patch_width, patch_height);
 
 
         file.flush();
@@ -0,0 +1,160 @@
+/* The copyright in this software is being made available under the BSD
+ * License, included below. This software may be subject to other third party
+ * and contributor rights, including patent rights, and no such rights are
+ * granted under this license.
+ *
+ * Copyright (c) 2010-2019, ITU/ISO/IEC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *  * Neither the name of the ITU/ISO/IEC nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** \file     RasterTools.h
+ *  \brief    Sample kernels used by the raster file readers and writers.
+ *  \details  Byte swapping and (de)interleaving of raster samples. The loops
+ *            are kept simple and branch free (and are defined in this header
+ *            so that they can be inlined), so that the compiler is able to
+ *            vectorize them.
+ *  \date     2026-10-19
+ */
+
+#ifndef JPLM_LIB_UTILS_IMAGE_RASTERTOOLS_H__
+#define JPLM_LIB_UTILS_IMAGE_RASTERTOOLS_H__
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace RasterTools {
+
+/**
+ * @brief      Reverses the byte order of an integer sample
+ *
+ * @param[in]  value  The value
+ *
+ * @tparam     T      Integer type of 1, 2 or 4 bytes
+ *
+ * @return     The value with reversed byte order
+ */
+template<typename T>
+constexpr T byte_swap(const T value) noexcept {
+  static_assert(std::is_integral_v<T>, "Only integer samples are supported");
+  using UnsignedT = std::make_unsigned_t<T>;
+  const auto in = static_cast<UnsignedT>(value);
+  if constexpr (sizeof(T) == 1) {
+    return value;
+  } else if constexpr (sizeof(T) == 2) {
+    return static_cast<T>(static_cast<UnsignedT>((in >> 8) | (in << 8)));
+  } else {
+    static_assert(sizeof(T) == 4, "Only 8, 16 and 32 bit samples");
+    return static_cast<T>(((in >> 24) & 0x000000FF) |
+                          ((in >> 8) & 0x0000FF00) |
+                          ((in << 8) & 0x00FF0000) | ((in << 24) & 0xFF000000));
+  }
+}
+
+
+/**
+ * @brief      Reverses the byte order of each sample in place
+ */
+template<typename T>
+void swap_endianess(T* samples, const std::size_t number_of_samples) {
+  if constexpr (sizeof(T) > 1) {
+    for (auto i = decltype(number_of_samples){0}; i < number_of_samples; ++i) {
+      samples[i] = byte_swap(samples[i]);
+    }
+  }
+}
+
+
+/**
+ * @brief      Copies the samples from source to destination reversing their
+ *             byte order
+ */
+template<typename T>
+void copy_swapping_endianess(const T* __restrict source,
+    T* __restrict destination, const std::size_t number_of_samples) {
+  for (auto i = decltype(number_of_samples){0}; i < number_of_samples; ++i) {
+    destination[i] = byte_swap(source[i]);
+  }
+}
+
+
+/**
+ * @brief      Splits interleaved samples (abcabc...) into three planes
+ *
+ * @param[in]  interleaved        The interleaved samples
+ * @param      first              The first plane (a)
+ * @param      second             The second plane (b)
+ * @param      third              The third plane (c)
+ * @param[in]  number_of_samples  The number of samples per plane
+ *
+ * @tparam     T                  Sample type
+ * @tparam     swap_bytes         Whether to swap the byte order of the samples
+ */
+template<typename T, bool swap_bytes>
+void deinterleave_three_channels(const T* __restrict interleaved,
+    T* __restrict first, T* __restrict second, T* __restrict third,
+    const std::size_t number_of_samples) {
+  for (auto i = decltype(number_of_samples){0}; i < number_of_samples; ++i) {
+    if constexpr (swap_bytes) {
+      first[i] = byte_swap(interleaved[3 * i]);
+      second[i] = byte_swap(interleaved[3 * i + 1]);
+      third[i] = byte_swap(interleaved[3 * i + 2]);
+    } else {
+      first[i] = interleaved[3 * i];
+      second[i] = interleaved[3 * i + 1];
+      third[i] = interleaved[3 * i + 2];
+    }
+  }
+}
+
+
+/**
+ * @brief      Merges three planes into interleaved samples (abcabc...)
+ *
+ * @tparam     T           Sample type
+ * @tparam     swap_bytes  Whether to reverse the byte order of each sample
+ */
+template<typename T, bool swap_bytes>
+void interleave_three_channels(const T* __restrict first,
+    const T* __restrict second, const T* __restrict third,
+    T* __restrict interleaved, const std::size_t number_of_samples) {
+  for (auto i = decltype(number_of_samples){0}; i < number_of_samples; ++i) {
+    if constexpr (swap_bytes) {
+      interleaved[3 * i] = byte_swap(first[i]);
+      interleaved[3 * i + 1] = byte_swap(second[i]);
+      interleaved[3 * i + 2] = byte_swap(third[i]);
+    } else {
+      interleaved[3 * i] = first[i];
+      interleaved[3 * i + 1] = second[i];
+      interleaved[3 * i + 2] = third[i];
+    }
+  }
+}
+
+}  // namespace RasterTools
+
+#endif /* end of include guard: JPLM_LIB_UTILS_IMAGE_RASTERTOOLS_H__ */
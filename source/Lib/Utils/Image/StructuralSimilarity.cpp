@@ -0,0 +1,251 @@
+/* The copyright in this software is being made available under the BSD
+ * License, included below. This software may be subject to other third party
+ * and contributor rights, including patent rights, and no such rights are
+ * granted under this license.
+ *
+ * Copyright (c) 2010-2019, ITU/ISO/IEC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *  * Neither the name of the ITU/ISO/IEC nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** \file     StructuralSimilarity.cpp
+ *  \brief    Structural similarity (SSIM) and multi-scale SSIM (MS-SSIM)
+ *  \details
+ *  \date     2026-10-19
+ */
+
+#include "Lib/Utils/Image/StructuralSimilarity.h"
+#include <algorithm>
+#include <cmath>
+#include "Lib/Utils/Image/ImageExceptions.h"
+
+
+namespace StructuralSimilarity {
+
+namespace {
+
+std::array<double, window_size> get_window() {
+  std::array<double, window_size> window;
+  const auto center = static_cast<double>(window_size / 2);
+  auto sum = 0.0;
+  for (std::size_t k = 0; k < window_size; ++k) {
+    const auto distance = static_cast<double>(k) - center;
+    window[k] = std::exp(-(distance * distance) /
+                         (2.0 * window_standard_deviation *
+                             window_standard_deviation));
+    sum += window[k];
+  }
+  for (auto& weight : window) {
+    weight /= sum;
+  }
+  return window;
+}
+
+
+/**
+ * \brief      Local (windowed) means of x, y, x^2, y^2 and xy
+ */
+struct Moments {
+  std::vector<double> x;
+  std::vector<double> y;
+  std::vector<double> xx;
+  std::vector<double> yy;
+  std::vector<double> xy;
+
+  explicit Moments(std::size_t size)
+      : x(size, 0.0), y(size, 0.0), xx(size, 0.0), yy(size, 0.0),
+        xy(size, 0.0) {
+  }
+};
+
+}  // namespace
+
+
+Components get_components(
+    const Plane& original, const Plane& encoded, double max_value) {
+  if ((original.width != encoded.width) ||
+      (original.height != encoded.height)) {
+    throw MetricsExceptions::DifferentSizeImagesException();
+  }
+  if ((original.width < window_size) || (original.height < window_size)) {
+    throw MetricsExceptions::ImageTooSmallForMetricException();
+  }
+
+  static const auto window = get_window();
+  const auto width = original.width;
+  const auto height = original.height;
+  const auto output_width = width - window_size + 1;
+  const auto output_height = height - window_size + 1;
+  const auto c1 = (k1 * max_value) * (k1 * max_value);
+  const auto c2 = (k2 * max_value) * (k2 * max_value);
+
+  //the rows filtered by the horizontal pass are kept in a circular buffer
+  //with the window_size rows used by the vertical pass, which stays in cache
+  auto horizontal = Moments(window_size * output_width);
+  auto local = Moments(output_width);
+  auto similarity_row = std::vector<double>(output_width);
+  auto contrast_structure_row = std::vector<double>(output_width);
+  auto similarity_sum = 0.0;
+  auto contrast_structure_sum = 0.0;
+
+  for (std::size_t row = 0; row < height; ++row) {
+    //horizontal pass, only at the columns where the window fits
+    const auto* x = original.samples.data() + row * width;
+    const auto* y = encoded.samples.data() + row * width;
+    const auto slot = (row % window_size) * output_width;
+    auto* mean_x = horizontal.x.data() + slot;
+    auto* mean_y = horizontal.y.data() + slot;
+    auto* mean_xx = horizontal.xx.data() + slot;
+    auto* mean_yy = horizontal.yy.data() + slot;
+    auto* mean_xy = horizontal.xy.data() + slot;
+    for (std::size_t column = 0; column < output_width; ++column) {
+      double sum_x = 0.0, sum_y = 0.0, sum_xx = 0.0, sum_yy = 0.0;
+      double sum_xy = 0.0;
+      for (std::size_t k = 0; k < window_size; ++k) {
+        const auto x_value = x[column + k];
+        const auto y_value = y[column + k];
+        sum_x += window[k] * x_value;
+        sum_y += window[k] * y_value;
+        sum_xx += window[k] * x_value * x_value;
+        sum_yy += window[k] * y_value * y_value;
+        sum_xy += window[k] * x_value * y_value;
+      }
+      mean_x[column] = sum_x;
+      mean_y[column] = sum_y;
+      mean_xx[column] = sum_xx;
+      mean_yy[column] = sum_yy;
+      mean_xy[column] = sum_xy;
+    }
+
+    if (row + 1 < window_size) {
+      continue;
+    }
+
+    //vertical pass of the output row that ends at this row, followed by its
+    //SSIM map. The loops run along the row and the map is stored before
+    //being summed, so that none of them has a floating-point reduction and
+    //all of them can be vectorized
+    const auto first_row = row + 1 - window_size;
+    std::fill(local.x.begin(), local.x.end(), 0.0);
+    std::fill(local.y.begin(), local.y.end(), 0.0);
+    std::fill(local.xx.begin(), local.xx.end(), 0.0);
+    std::fill(local.yy.begin(), local.yy.end(), 0.0);
+    std::fill(local.xy.begin(), local.xy.end(), 0.0);
+    for (std::size_t k = 0; k < window_size; ++k) {
+      const auto weight = window[k];
+      const auto offset = ((first_row + k) % window_size) * output_width;
+      for (std::size_t column = 0; column < output_width; ++column) {
+        local.x[column] += weight * horizontal.x[offset + column];
+        local.y[column] += weight * horizontal.y[offset + column];
+        local.xx[column] += weight * horizontal.xx[offset + column];
+        local.yy[column] += weight * horizontal.yy[offset + column];
+        local.xy[column] += weight * horizontal.xy[offset + column];
+      }
+    }
+
+    for (std::size_t column = 0; column < output_width; ++column) {
+      const auto local_mean_x = local.x[column];
+      const auto local_mean_y = local.y[column];
+      const auto variance_x = local.xx[column] - local_mean_x * local_mean_x;
+      const auto variance_y = local.yy[column] - local_mean_y * local_mean_y;
+      const auto covariance = local.xy[column] - local_mean_x * local_mean_y;
+      const auto contrast_structure =
+          (2.0 * covariance + c2) / (variance_x + variance_y + c2);
+      const auto luminance =
+          (2.0 * local_mean_x * local_mean_y + c1) /
+          (local_mean_x * local_mean_x + local_mean_y * local_mean_y + c1);
+      similarity_row[column] = luminance * contrast_structure;
+      contrast_structure_row[column] = contrast_structure;
+    }
+
+    for (std::size_t column = 0; column < output_width; ++column) {
+      similarity_sum += similarity_row[column];
+      contrast_structure_sum += contrast_structure_row[column];
+    }
+  }
+
+  const auto number_of_positions =
+      static_cast<double>(output_width * output_height);
+  Components components;
+  components.similarity = similarity_sum / number_of_positions;
+  components.contrast_structure = contrast_structure_sum / number_of_positions;
+  return components;
+}
+
+
+double get_structural_similarity(
+    const Plane& original, const Plane& encoded, double max_value) {
+  return get_components(original, encoded, max_value).similarity;
+}
+
+
+double get_multiscale_structural_similarity(
+    const Plane& original, const Plane& encoded, double max_value) {
+  const auto number_of_scales = multiscale_weights.size();
+  const auto minimum_size = std::min(original.width, original.height);
+  if ((minimum_size >> (number_of_scales - 1)) < window_size) {
+    throw MetricsExceptions::ImageTooSmallForMetricException();
+  }
+
+  auto multiscale_similarity = 1.0;
+  auto original_scale = Plane();
+  auto encoded_scale = Plane();
+  for (std::size_t scale = 0; scale < number_of_scales; ++scale) {
+    if (scale > 0) {
+      original_scale = downsample((scale == 1) ? original : original_scale);
+      encoded_scale = downsample((scale == 1) ? encoded : encoded_scale);
+    }
+    const auto components = get_components((scale == 0) ? original
+                                                         : original_scale,
+        (scale == 0) ? encoded : encoded_scale, max_value);
+    const auto term = (scale + 1 == number_of_scales)
+                          ? components.similarity
+                          : components.contrast_structure;
+    multiscale_similarity *=
+        std::pow(std::max(term, 0.0), multiscale_weights[scale]);
+  }
+  return multiscale_similarity;
+}
+
+
+Plane downsample(const Plane& plane) {
+  Plane downsampled;
+  downsampled.width = plane.width / 2;
+  downsampled.height = plane.height / 2;
+  downsampled.samples.resize(downsampled.width * downsampled.height);
+  for (std::size_t row = 0; row < downsampled.height; ++row) {
+    const auto* top = plane.samples.data() + 2 * row * plane.width;
+    const auto* bottom = top + plane.width;
+    auto* output = downsampled.samples.data() + row * downsampled.width;
+    for (std::size_t column = 0; column < downsampled.width; ++column) {
+      output[column] = 0.25 * (top[2 * column] + top[2 * column + 1] +
+                                  bottom[2 * column] + bottom[2 * column + 1]);
+    }
+  }
+  return downsampled;
+}
+
+}  // namespace StructuralSimilarity
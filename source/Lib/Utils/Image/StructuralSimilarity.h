@@ -0,0 +1,121 @@
+/* The copyright in this software is being made available under the BSD
+ * License, included below. This software may be subject to other third party
+ * and contributor rights, including patent rights, and no such rights are
+ * granted under this license.
+ *
+ * Copyright (c) 2010-2019, ITU/ISO/IEC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *  * Neither the name of the ITU/ISO/IEC nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** \file     StructuralSimilarity.h
+ *  \brief    Structural similarity (SSIM) and multi-scale SSIM (MS-SSIM)
+ *  \details  The local statistics are computed with the 11x11 Gaussian
+ *            window (standard deviation of 1.5) of Wang et al., applied as
+ *            two separable 1D passes whose inner loops run along the rows,
+ *            so they are vectorized by the compiler. Only the positions
+ *            where the window fits entirely in the image are used.
+ *  \date     2026-10-19
+ */
+
+#ifndef JPLM_LIB_UTILS_IMAGE_STRUCTURALSIMILARITY_H__
+#define JPLM_LIB_UTILS_IMAGE_STRUCTURALSIMILARITY_H__
+
+#include <array>
+#include <cstddef>
+#include <vector>
+
+namespace StructuralSimilarity {
+
+constexpr std::size_t window_size = 11;
+constexpr double window_standard_deviation = 1.5;
+constexpr double k1 = 0.01;
+constexpr double k2 = 0.03;
+constexpr std::array<double, 5> multiscale_weights = {
+    0.0448, 0.2856, 0.3001, 0.2363, 0.1333};
+
+
+/**
+ * \brief      Mean values of the SSIM map and of its contrast-structure term
+ */
+struct Components {
+  double similarity = 0.0;
+  double contrast_structure = 0.0;
+};
+
+
+/**
+ * \brief      Plane of samples (in raster order) used in the computations
+ */
+struct Plane {
+  std::vector<double> samples;
+  std::size_t width = 0;
+  std::size_t height = 0;
+};
+
+
+/**
+ * \brief      Gets the mean SSIM and the mean contrast-structure term between
+ *             two planes of the same size
+ *
+ * \param[in]  original   The original plane
+ * \param[in]  encoded    The encoded plane
+ * \param[in]  max_value  The maximum sample value (\f$2^{bpp}-1\f$)
+ *
+ * \return     The components.
+ */
+Components get_components(
+    const Plane& original, const Plane& encoded, double max_value);
+
+
+/**
+ * \brief      Gets the SSIM between two planes of the same size
+ */
+double get_structural_similarity(
+    const Plane& original, const Plane& encoded, double max_value);
+
+
+/**
+ * \brief      Gets the MS-SSIM between two planes of the same size
+ *
+ * \details    Five scales are used, each one obtained by averaging 2x2
+ *             samples of the previous one. The contrast-structure terms of
+ *             the first four scales and the SSIM of the last one are combined
+ *             with the weights of Wang et al.; negative terms are clipped to
+ *             zero.
+ */
+double get_multiscale_structural_similarity(
+    const Plane& original, const Plane& encoded, double max_value);
+
+
+/**
+ * \brief      Halves the size of a plane, averaging each 2x2 group of samples
+ */
+Plane downsample(const Plane& plane);
+
+}  // namespace StructuralSimilarity
+
+#endif /* end of include guard: JPLM_LIB_UTILS_IMAGE_STRUCTURALSIMILARITY_H__ */
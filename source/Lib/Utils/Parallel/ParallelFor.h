@@ -0,0 +1,147 @@
+/* The copyright in this software is being made available under the BSD
+ * License, included below. This software may be subject to other third party
+ * and contributor rights, including patent rights, and no such rights are
+ * granted under this license.
+ *
+ * Copyright (c) 2010-2019, ITU/ISO/IEC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *  * Neither the name of the ITU/ISO/IEC nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** \file     ParallelFor.h
+ *  \brief    Bounded parallel loop
+ *  \details  Runs the iterations of a loop on a bounded number of threads.
+ *            Iterations are handed out dynamically (one at a time) from a
+ *            shared counter, so that workers with cheap iterations take more
+ *            of them.
+ *  \date     2026-10-19
+ */
+
+#ifndef JPLM_LIB_UTILS_PARALLEL_PARALLELFOR_H__
+#define JPLM_LIB_UTILS_PARALLEL_PARALLELFOR_H__
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+namespace Parallel {
+
+/**
+ * @brief      Gets the number of threads to be used
+ *
+ * @param[in]  requested_number_of_threads  The requested number of threads.
+ *             Zero means one thread per hardware thread.
+ *
+ * @return     The number of threads (at least one).
+ */
+std::size_t get_number_of_threads(std::size_t requested_number_of_threads);
+
+
+/**
+ * @brief      Calls function(i) for every i in [begin, end) using at most
+ *             number_of_threads threads (including the calling one)
+ *
+ * @details    With a single thread (or a single iteration) the loop runs on
+ *             the calling thread, in order. The first exception thrown by an
+ *             iteration stops the distribution of new iterations and is
+ *             rethrown in the calling thread after all workers finish. If a
+ *             thread cannot be started, the loop runs on the threads that
+ *             were.
+ *
+ * @param[in]  begin              The first index
+ * @param[in]  end                One past the last index
+ * @param[in]  number_of_threads  The maximum number of threads (0 for
+ *                                hardware concurrency)
+ * @param      function           The loop body
+ */
+template<typename Function>
+void parallel_for(std::size_t begin, std::size_t end,
+    std::size_t number_of_threads, Function&& function) {
+  if (end <= begin) {
+    return;
+  }
+  const auto number_of_iterations = end - begin;
+  const auto number_of_workers = std::min(
+      get_number_of_threads(number_of_threads), number_of_iterations);
+
+  if (number_of_workers == 1) {
+    for (auto i = begin; i < end; ++i) {
+      function(i);
+    }
+    return;
+  }
+
+  std::atomic<std::size_t> next_index(begin);
+  std::atomic<bool> failed(false);
+  std::exception_ptr first_exception = nullptr;
+  std::mutex exception_mutex;
+
+  auto worker = [&]() {
+    while (!failed.load(std::memory_order_relaxed)) {
+      const auto i = next_index.fetch_add(1, std::memory_order_relaxed);
+      if (i >= end) {
+        return;
+      }
+      try {
+        function(i);
+      } catch (...) {
+        std::lock_guard<std::mutex> lock(exception_mutex);
+        if (!first_exception) {
+          first_exception = std::current_exception();
+        }
+        failed = true;
+      }
+    }
+  };
+
+  std::vector<std::thread> threads;
+  threads.reserve(number_of_workers - 1);
+  for (auto i = decltype(number_of_workers){1}; i < number_of_workers; ++i) {
+    try {
+      threads.emplace_back(worker);
+    } catch (const std::system_error&) {
+      //the iterations are shared by the threads already started
+      break;
+    }
+  }
+  worker();
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  if (first_exception) {
+    std::rethrow_exception(first_exception);
+  }
+}
+
+}  // namespace Parallel
+
+#endif /* end of include guard: JPLM_LIB_UTILS_PARALLEL_PARALLELFOR_H__ */
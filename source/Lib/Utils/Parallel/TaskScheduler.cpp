@@ -0,0 +1,193 @@
+/* The copyright in this software is being made available under the BSD
+ * License, included below. This software may be subject to other third party
+ * and contributor rights, including patent rights, and no such rights are
+ * granted under this license.
+ *
+ * Copyright (c) 2010-2019, ITU/ISO/IEC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *  * Neither the name of the ITU/ISO/IEC nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** \file     TaskScheduler.cpp
+ *  \brief    Work-stealing scheduler of fork-join tasks
+ *  \details
+ *  \date     2026-10-19
+ */
+
+#include "Lib/Utils/Parallel/TaskScheduler.h"
+#include <system_error>
+#include <utility>
+#include "Lib/Utils/Parallel/ParallelFor.h"
+
+
+namespace {
+
+struct WorkerIdentity {
+  const Parallel::TaskScheduler* scheduler = nullptr;
+  std::size_t index = 0;
+};
+
+
+thread_local auto worker_identity = WorkerIdentity();
+
+}  // namespace
+
+
+Parallel::TaskScheduler::TaskScheduler(std::size_t number_of_threads) {
+  const auto number_of_workers =
+      Parallel::get_number_of_threads(number_of_threads) - 1;
+  for (auto i = std::size_t(0); i <= number_of_workers; ++i) {
+    queues.push_back(std::make_unique<TaskQueue>());
+  }
+  workers.reserve(number_of_workers);
+  for (auto i = std::size_t(0); i < number_of_workers; ++i) {
+    try {
+      workers.emplace_back([this, i]() { work(i); });
+    } catch (const std::system_error&) {
+      //the queues of the workers that were not started remain empty
+      break;
+    }
+  }
+}
+
+
+Parallel::TaskScheduler::~TaskScheduler() {
+  {
+    std::lock_guard<std::mutex> lock(sleep_mutex);
+    is_stopping = true;
+  }
+  sleep_condition.notify_all();
+  for (auto& worker : workers) {
+    worker.join();
+  }
+}
+
+
+std::size_t Parallel::TaskScheduler::get_queue_index_of_this_thread() const {
+  if (worker_identity.scheduler == this) {
+    return worker_identity.index;
+  }
+  return queues.size() - 1;
+}
+
+
+void Parallel::TaskScheduler::push(Task task) {
+  auto& queue = *queues[get_queue_index_of_this_thread()];
+  //counted before being queued, so that the counter never wraps around
+  ++number_of_queued_tasks;
+  {
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    queue.tasks.push_back(std::move(task));
+  }
+  notify();
+}
+
+
+bool Parallel::TaskScheduler::try_pop(Task& task) {
+  const auto own_index = get_queue_index_of_this_thread();
+  {
+    auto& queue = *queues[own_index];
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    if (!queue.tasks.empty()) {
+      task = std::move(queue.tasks.back());
+      queue.tasks.pop_back();
+      --number_of_queued_tasks;
+      return true;
+    }
+  }
+  //steals, starting from the next queue so that the victims are spread
+  for (auto i = std::size_t(1); i < queues.size(); ++i) {
+    auto& queue = *queues[(own_index + i) % queues.size()];
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    if (!queue.tasks.empty()) {
+      task = std::move(queue.tasks.front());
+      queue.tasks.pop_front();
+      --number_of_queued_tasks;
+      return true;
+    }
+  }
+  return false;
+}
+
+
+void Parallel::TaskScheduler::wait_for_task_or(
+    const std::function<bool()>& is_done) {
+  std::unique_lock<std::mutex> lock(sleep_mutex);
+  sleep_condition.wait(lock, [this, &is_done]() {
+    return is_stopping || (number_of_queued_tasks > 0) || is_done();
+  });
+}
+
+
+void Parallel::TaskScheduler::notify() {
+  //taking the lock avoids waking up before a waiting thread is blocked,
+  //after it has checked the condition
+  {
+    std::lock_guard<std::mutex> lock(sleep_mutex);
+  }
+  sleep_condition.notify_all();
+}
+
+
+void Parallel::TaskScheduler::work(std::size_t index) {
+  worker_identity = {this, index};
+  auto task = Task();
+  while (true) {
+    if (try_pop(task)) {
+      task();
+      task = nullptr;
+      continue;
+    }
+    std::unique_lock<std::mutex> lock(sleep_mutex);
+    sleep_condition.wait(lock,
+        [this]() { return is_stopping || (number_of_queued_tasks > 0); });
+    if (is_stopping && (number_of_queued_tasks == 0)) {
+      return;
+    }
+  }
+}
+
+
+void Parallel::TaskGroup::wait_without_rethrowing() {
+  auto task = TaskScheduler::Task();
+  while (number_of_pending_tasks > 0) {
+    if (scheduler.try_pop(task)) {
+      task();
+      task = nullptr;
+      continue;
+    }
+    scheduler.wait_for_task_or(
+        [this]() { return number_of_pending_tasks == 0; });
+  }
+}
+
+
+void Parallel::TaskGroup::wait() {
+  wait_without_rethrowing();
+  if (first_exception) {
+    std::rethrow_exception(std::exchange(first_exception, nullptr));
+  }
+}
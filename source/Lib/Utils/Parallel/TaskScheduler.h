@@ -0,0 +1,196 @@
+/* The copyright in this software is being made available under the BSD
+ * License, included below. This software may be subject to other third party
+ * and contributor rights, including patent rights, and no such rights are
+ * granted under this license.
+ *
+ * Copyright (c) 2010-2019, ITU/ISO/IEC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *  * Neither the name of the ITU/ISO/IEC nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** \file     TaskScheduler.h
+ *  \brief    Work-stealing scheduler of fork-join tasks
+ *  \details  Runs tasks (possibly creating other tasks) on a fixed set of
+ *            threads. Each worker has its own deque: the tasks it creates
+ *            are pushed to and popped from its back (the most recent first,
+ *            which keeps a recursive search depth first), while idle
+ *            workers steal from the front of the deques of the others (the
+ *            oldest tasks, which are usually the largest ones). A thread
+ *            waiting for a TaskGroup runs pending tasks meanwhile, so that
+ *            nested groups do not deadlock.
+ *  \date     2026-10-19
+ */
+
+#ifndef JPLM_LIB_UTILS_PARALLEL_TASKSCHEDULER_H__
+#define JPLM_LIB_UTILS_PARALLEL_TASKSCHEDULER_H__
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Parallel {
+
+class TaskScheduler {
+ public:
+  using Task = std::function<void()>;
+
+ private:
+  struct TaskQueue {
+    std::mutex mutex;
+    std::deque<Task> tasks;
+  };
+
+  //one queue per worker, and the last one for the tasks created by the
+  //threads that are not workers of this scheduler
+  std::vector<std::unique_ptr<TaskQueue>> queues;
+  std::vector<std::thread> workers;
+  std::atomic<std::size_t> number_of_queued_tasks = {0};
+  std::mutex sleep_mutex;
+  std::condition_variable sleep_condition;
+  bool is_stopping = false;  //!< Guarded by sleep_mutex
+
+  std::size_t get_queue_index_of_this_thread() const;
+  void work(std::size_t index);
+
+ public:
+  /**
+   * @brief      Constructs a new instance
+   *
+   * @param[in]  number_of_threads  The number of threads running tasks,
+   *             including the ones waiting for a TaskGroup (0 for one per
+   *             hardware thread). Thus, number_of_threads - 1 workers are
+   *             created (fewer if the system cannot start them).
+   */
+  explicit TaskScheduler(std::size_t number_of_threads);
+
+
+  TaskScheduler(const TaskScheduler&) = delete;
+  TaskScheduler& operator=(const TaskScheduler&) = delete;
+
+
+  ~TaskScheduler();
+
+
+  std::size_t get_number_of_threads() const noexcept {
+    return workers.size() + 1;
+  }
+
+
+  /**
+   * @brief      Queues a task, in the queue of the calling thread
+   */
+  void push(Task task);
+
+
+  /**
+   * @brief      Takes a task: the newest of the queue of the calling thread
+   *             or, if it is empty, the oldest of another queue
+   *
+   * @return     Whether a task was taken
+   */
+  bool try_pop(Task& task);
+
+
+  /**
+   * @brief      Blocks the calling thread until a task is queued or
+   *             is_done() returns true
+   */
+  void wait_for_task_or(const std::function<bool()>& is_done);
+
+
+  /**
+   * @brief      Wakes the threads blocked in wait_for_task_or
+   */
+  void notify();
+};
+
+
+/**
+ * @brief      Set of tasks of a TaskScheduler that are waited for together
+ *
+ * @details    The first exception thrown by a task is rethrown by wait().
+ */
+class TaskGroup {
+ private:
+  TaskScheduler& scheduler;
+  std::atomic<std::size_t> number_of_pending_tasks = {0};
+  std::mutex exception_mutex;
+  std::exception_ptr first_exception = nullptr;
+
+  void wait_without_rethrowing();
+
+ public:
+  explicit TaskGroup(TaskScheduler& scheduler) : scheduler(scheduler) {
+  }
+
+
+  TaskGroup(const TaskGroup&) = delete;
+  TaskGroup& operator=(const TaskGroup&) = delete;
+
+
+  ~TaskGroup() {
+    wait_without_rethrowing();
+  }
+
+
+  template<typename Function>
+  void run(Function&& function) {
+    ++number_of_pending_tasks;
+    scheduler.push([this, &scheduler = scheduler,
+                       function = std::forward<Function>(function)]() {
+      try {
+        function();
+      } catch (...) {
+        std::lock_guard<std::mutex> lock(exception_mutex);
+        if (!first_exception) {
+          first_exception = std::current_exception();
+        }
+      }
+      //this group may be destroyed as soon as its last task is done
+      if (--number_of_pending_tasks == 0) {
+        scheduler.notify();
+      }
+    });
+  }
+
+
+  /**
+   * @brief      Runs queued tasks (of any group) until all the tasks of this
+   *             group finish
+   */
+  void wait();
+};
+
+}  // namespace Parallel
+
+#endif /* end of include guard: JPLM_LIB_UTILS_PARALLEL_TASKSCHEDULER_H__ */
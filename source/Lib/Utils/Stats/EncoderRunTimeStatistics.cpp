@@ -67,4 +67,12 @@ void EncoderRunTimeStatistics::show_statistics() {
 
   std::cout << "MD5: " << HO_Hashlibpp::MD5(ref_to_stream) << std::endl;
   std::cout << "SHA1: " << HO_Hashlibpp::SHA1(ref_to_stream) << std::endl;
-}
\ No newline at end of file
+}
+
+
+nlohmann::json EncoderRunTimeStatistics::get_statistics_as_json() {
+  auto json = RunTimeStatistics::get_statistics_as_json();
+  json["bytes_written"] = static_cast<std::size_t>(
+      final_of_stream_position - initial_of_stream_position);
+  return json;
+}
@@ -62,6 +62,8 @@ class EncoderRunTimeStatistics : public RunTimeStatistics {
   virtual void mark_end() override;
 
   virtual void show_statistics() override;
+
+  virtual nlohmann::json get_statistics_as_json() override;
 };
 
 #endif  // JPLM_LIB_UTILS_ENCODER_RUN_TIME_STATISTICS_H
\ No newline at end of file
@@ -0,0 +1,187 @@
+/* The copyright in this software is being made available under the BSD
+ * License, included below. This software may be subject to other third party
+ * and contributor rights, including patent rights, and no such rights are
+ * granted under this license.
+ *
+ * Copyright (c) 2010-2019, ITU/ISO/IEC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *  * Neither the name of the ITU/ISO/IEC nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/** \file     MemoryAccounting.cpp
+ *  \brief    Counters of the memory held by the main codec buffers
+ *  \details  
+ *  \date     2026-10-19
+ */
+
+#include "Lib/Utils/Stats/MemoryAccounting.h"
+#include <array>
+#include <atomic>
+#include <iomanip>
+#include <sstream>
+#include "CppConsoleTable/CppConsoleTable.hpp"
+
+
+namespace {
+
+struct Counter {
+  std::atomic<std::size_t> current = {0};
+  std::atomic<std::size_t> peak = {0};
+
+
+  void add(std::size_t bytes) {
+    const auto value = current.fetch_add(bytes) + bytes;
+    auto previous_peak = peak.load();
+    while (value > previous_peak &&
+           !peak.compare_exchange_weak(previous_peak, value)) {
+    }
+  }
+
+
+  void remove(std::size_t bytes) {
+    current.fetch_sub(bytes);
+  }
+
+
+  void reset_peak() {
+    peak.store(current.load());
+  }
+};
+
+
+//trivially destructible, thus usable by objects destroyed at exit
+std::array<Counter, MemoryAccounting::number_of_categories> counters;
+Counter total;
+std::atomic<std::size_t> budget = {0};
+
+
+Counter& get_counter(MemoryAccounting::Category category) {
+  return counters[static_cast<std::size_t>(category)];
+}
+
+
+std::string format_mebibytes(std::size_t bytes) {
+  auto stream = std::ostringstream();
+  stream << std::fixed << std::setprecision(3)
+         << static_cast<double>(bytes) / (1024.0 * 1024.0);
+  return stream.str();
+}
+
+}  // namespace
+
+
+const std::string& MemoryAccounting::get_category_name(Category category) {
+  static const std::array<std::string, number_of_categories> names = {
+      "images", "blocks_4d", "codestream", "parsed_boxes"};
+  return names.at(static_cast<std::size_t>(category));
+}
+
+
+void MemoryAccounting::add(Category category, std::size_t bytes) {
+  if (bytes == 0) {
+    return;
+  }
+  get_counter(category).add(bytes);
+  total.add(bytes);
+}
+
+
+void MemoryAccounting::remove(Category category, std::size_t bytes) {
+  if (bytes == 0) {
+    return;
+  }
+  get_counter(category).remove(bytes);
+  total.remove(bytes);
+}
+
+
+std::size_t MemoryAccounting::get_current_bytes(Category category) {
+  return get_counter(category).current.load();
+}
+
+
+std::size_t MemoryAccounting::get_peak_bytes(Category category) {
+  return get_counter(category).peak.load();
+}
+
+
+std::size_t MemoryAccounting::get_current_total_bytes() {
+  return total.current.load();
+}
+
+
+std::size_t MemoryAccounting::get_peak_total_bytes() {
+  return total.peak.load();
+}
+
+
+void MemoryAccounting::reset_peaks() {
+  for (auto& counter : counters) {
+    counter.reset_peak();
+  }
+  total.reset_peak();
+}
+
+
+void MemoryAccounting::set_budget(std::size_t bytes) {
+  budget.store(bytes);
+}
+
+
+std::size_t MemoryAccounting::get_budget() {
+  return budget.load();
+}
+
+
+bool MemoryAccounting::has_budget() {
+  return get_budget() != 0;
+}
+
+
+bool MemoryAccounting::is_over_budget() {
+  const auto budget_in_bytes = get_budget();
+  return budget_in_bytes != 0 && get_current_total_bytes() > budget_in_bytes;
+}
+
+
+void MemoryAccounting::show_table(std::ostream& stream) {
+  samilton::ConsoleTable table(1, 1, samilton::Alignment::centre);
+  auto line = 0;
+  table[line][0] = "Buffer";
+  table[line][1] = "Current (MiB)";
+  table[line][2] = "Peak (MiB)";
+  for (auto i = std::size_t{0}; i < number_of_categories; ++i) {
+    const auto category = static_cast<Category>(i);
+    ++line;
+    table[line][0](samilton::Alignment::right) = get_category_name(category);
+    table[line][1] = format_mebibytes(get_current_bytes(category));
+    table[line][2] = format_mebibytes(get_peak_bytes(category));
+  }
+  ++line;
+  table[line][0](samilton::Alignment::right) = "total";
+  table[line][1] = format_mebibytes(get_current_total_bytes());
+  table[line][2] = format_mebibytes(get_peak_total_bytes());
+  stream << table;
+}
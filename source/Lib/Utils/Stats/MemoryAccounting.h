@@ -0,0 +1,198 @@
+/* The copyright in this software is being made available under the BSD
+ * License, included below. This software may be subject to other third party
+ * and contributor rights, including patent rights, and no such rights are
+ * granted under this license.
+ *
+ * Copyright (c) 2010-2019, ITU/ISO/IEC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *  * Neither the name of the ITU/ISO/IEC nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/** \file     MemoryAccounting.h
+ *  \brief    Counters of the memory held by the main codec buffers
+ *  \details  Image channels (the views held by the ViewIOPolicy), 4D blocks
+ *            (Block4D and the Transformed4DBlock buffers), the in-memory
+ *            codestream and the contents of parsed boxes report their
+ *            allocations here. For each category, the current and the peak
+ *            number of bytes are kept in atomic counters, thus the
+ *            accounting may be done from any thread.
+ *
+ *            An optional global budget may be set. It is not enforced by the
+ *            allocations themselves; instead, the policies that are able to
+ *            release memory (e.g., the view IO policies) check
+ *            is_over_budget() and adapt.
+ *  \date     2026-10-19
+ */
+
+#ifndef JPLM_LIB_UTILS_STATS_MEMORYACCOUNTING_H__
+#define JPLM_LIB_UTILS_STATS_MEMORYACCOUNTING_H__
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <utility>
+
+
+namespace MemoryAccounting {
+
+enum class Category : std::size_t {
+  images = 0,
+  blocks_4d,
+  codestream,
+  parsed_boxes,
+  number_of_categories
+};
+
+
+constexpr auto number_of_categories =
+    static_cast<std::size_t>(Category::number_of_categories);
+
+
+const std::string& get_category_name(Category category);
+
+
+void add(Category category, std::size_t bytes);
+
+
+void remove(Category category, std::size_t bytes);
+
+
+std::size_t get_current_bytes(Category category);
+
+
+std::size_t get_peak_bytes(Category category);
+
+
+std::size_t get_current_total_bytes();
+
+
+std::size_t get_peak_total_bytes();
+
+
+/**
+ * @brief      Makes the peaks equal to the current values
+ */
+void reset_peaks();
+
+
+/**
+ * @brief      Sets the global memory budget
+ *
+ * @param[in]  bytes  The budget in bytes (0 disables it)
+ */
+void set_budget(std::size_t bytes);
+
+
+std::size_t get_budget();
+
+
+bool has_budget();
+
+
+/**
+ * @brief      Checks whether the tracked memory exceeds the budget
+ *
+ * @return     False when no budget is set.
+ */
+bool is_over_budget();
+
+
+void show_table(std::ostream& stream);
+
+
+/**
+ * @brief      Accounts a number of bytes for as long as it lives
+ *
+ * @details    Copies account the same number of bytes again, while moves
+ *             transfer the accounted bytes (the moved from object accounts
+ *             nothing).
+ */
+class TrackedBytes {
+ private:
+  Category category;
+  std::size_t bytes;
+
+ public:
+  explicit TrackedBytes(Category category, std::size_t bytes = 0)
+      : category(category), bytes(bytes) {
+    add(category, bytes);
+  }
+
+
+  TrackedBytes(const TrackedBytes& other)
+      : TrackedBytes(other.category, other.bytes) {
+  }
+
+
+  TrackedBytes(TrackedBytes&& other) noexcept
+      : category(other.category), bytes(std::exchange(other.bytes, 0)) {
+  }
+
+
+  TrackedBytes& operator=(const TrackedBytes& other) {
+    if (this != &other) {
+      remove(category, bytes);
+      category = other.category;
+      bytes = other.bytes;
+      add(category, bytes);
+    }
+    return *this;
+  }
+
+
+  TrackedBytes& operator=(TrackedBytes&& other) noexcept {
+    if (this != &other) {
+      remove(category, bytes);
+      category = other.category;
+      bytes = std::exchange(other.bytes, 0);
+    }
+    return *this;
+  }
+
+
+  ~TrackedBytes() {
+    remove(category, bytes);
+  }
+
+
+  void set(std::size_t new_bytes) {
+    if (new_bytes > bytes) {
+      add(category, new_bytes - bytes);
+    } else if (new_bytes < bytes) {
+      remove(category, bytes - new_bytes);
+    }
+    bytes = new_bytes;
+  }
+
+
+  std::size_t get() const noexcept {
+    return bytes;
+  }
+};
+
+}  // namespace MemoryAccounting
+
+#endif /* end of include guard: JPLM_LIB_UTILS_STATS_MEMORYACCOUNTING_H__ */
@@ -39,6 +39,32 @@
  */
 
 #include "RunTimeStatistics.h"
+#include <fstream>
+#include <iomanip>
+#include "Lib/Utils/Stats/MemoryAccounting.h"
+#include "Lib/Utils/Stats/StageInstrumentation.h"
+
+namespace {
+
+nlohmann::json get_memory_statistics_as_json() {
+  auto categories = nlohmann::json::object();
+  for (auto i = std::size_t{0}; i < MemoryAccounting::number_of_categories;
+       ++i) {
+    const auto category = static_cast<MemoryAccounting::Category>(i);
+    categories[MemoryAccounting::get_category_name(category)] = {
+        {"current_bytes", MemoryAccounting::get_current_bytes(category)},
+        {"peak_bytes", MemoryAccounting::get_peak_bytes(category)}};
+  }
+  auto json = nlohmann::json::object();
+  json["categories"] = categories;
+  json["current_bytes"] = MemoryAccounting::get_current_total_bytes();
+  json["peak_bytes"] = MemoryAccounting::get_peak_total_bytes();
+  json["budget_bytes"] = MemoryAccounting::get_budget();
+  return json;
+}
+
+}  // namespace
+
 
 void RunTimeStatistics::mark_end() {
   if (!finished_counting) {
@@ -64,4 +90,52 @@ void RunTimeStatistics::show_statistics() {
             << "Max memory usage: " << usage.ru_maxrss << " kbytes."
             << std::endl;
 #endif
-}
\ No newline at end of file
+
+  if (StageInstrumentation::has_any_record()) {
+    std::cout << "Per stage statistics (inclusive times):\n";
+    StageInstrumentation::show_table(std::cout);
+    std::cout << std::endl;
+  }
+
+  if (MemoryAccounting::get_peak_total_bytes() > 0) {
+    std::cout << "Tracked memory:\n";
+    MemoryAccounting::show_table(std::cout);
+    if (MemoryAccounting::has_budget()) {
+      std::cout << "Memory budget: " << MemoryAccounting::get_budget()
+                << " bytes\n";
+    }
+    std::cout << std::endl;
+  }
+}
+
+
+nlohmann::json RunTimeStatistics::get_statistics_as_json() {
+  mark_end();
+  auto json = nlohmann::json::object();
+  json["wall_time_ms"] =
+      std::chrono::duration<double, std::milli>(end - start).count();
+#ifdef __unix__
+  struct rusage usage;
+  if (getrusage(RUSAGE_SELF, &usage) == 0) {
+    json["user_time_ms"] = usage.ru_utime.tv_sec * 1000.0 +
+                           usage.ru_utime.tv_usec / 1000.0;
+    json["max_memory_usage_kbytes"] = usage.ru_maxrss;
+  }
+#endif
+  if (StageInstrumentation::has_any_record()) {
+    json.update(StageInstrumentation::to_json());
+  }
+  json["memory"] = get_memory_statistics_as_json();
+  return json;
+}
+
+
+void RunTimeStatistics::write_statistics(const std::filesystem::path& path) {
+  auto file = std::ofstream(path);
+  if (!file.is_open()) {
+    std::cerr << "Error opening runtime statistics file " << path
+              << std::endl;
+    return;
+  }
+  file << std::setw(2) << get_statistics_as_json() << std::endl;
+}
@@ -44,6 +44,7 @@
 #include <chrono>
 #include <filesystem>
 #include <iostream>
+#include "nlohmann/json.hpp"
 #ifdef __unix__
 #include <sys/resource.h>
 #endif
@@ -64,6 +65,15 @@ class RunTimeStatistics {
   virtual void mark_end();
 
   virtual void show_statistics();
+
+  /**
+   * @brief      Gets the statistics, including the per stage counters of
+   *             StageInstrumentation (when enabled at build time) and the
+   *             current and peak values of MemoryAccounting
+   */
+  virtual nlohmann::json get_statistics_as_json();
+
+  void write_statistics(const std::filesystem::path& path);
 };
 
 
@@ -0,0 +1,248 @@
+/* The copyright in this software is being made available under the BSD
+ * License, included below. This software may be subject to other third party
+ * and contributor rights, including patent rights, and no such rights are
+ * granted under this license.
+ *
+ * Copyright (c) 2010-2019, ITU/ISO/IEC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *  * Neither the name of the ITU/ISO/IEC nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** \file     StageInstrumentation.cpp
+ *  \brief    Scoped timers and counters for the codec stages
+ *  \details  
+ *  \date     2026-10-19
+ */
+
+#include "Lib/Utils/Stats/StageInstrumentation.h"
+#include <algorithm>
+#include <deque>
+#include <iomanip>
+#include <mutex>
+#include <sstream>
+#include "CppConsoleTable/CppConsoleTable.hpp"
+
+
+namespace {
+
+struct ThreadRecord {
+  StageInstrumentation::ThreadCounters counters = {};
+  bool in_use = false;
+};
+
+
+class Registry {
+ private:
+  std::mutex mutex;
+  //deque, so that references to records remain valid when adding new ones
+  std::deque<ThreadRecord> records;
+
+ public:
+  ThreadRecord& acquire() {
+    std::lock_guard<std::mutex> lock(mutex);
+    for (auto& record : records) {
+      if (!record.in_use) {
+        record.in_use = true;
+        return record;
+      }
+    }
+    auto& record = records.emplace_back();
+    record.in_use = true;
+    return record;
+  }
+
+
+  void release(ThreadRecord& record) {
+    std::lock_guard<std::mutex> lock(mutex);
+    record.in_use = false;
+  }
+
+
+  std::vector<StageInstrumentation::ThreadCounters> get_counters() {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto counters = std::vector<StageInstrumentation::ThreadCounters>();
+    counters.reserve(records.size());
+    for (const auto& record : records) {
+      counters.push_back(record.counters);
+    }
+    return counters;
+  }
+
+
+  void reset() {
+    std::lock_guard<std::mutex> lock(mutex);
+    for (auto& record : records) {
+      record.counters = {};
+    }
+  }
+};
+
+
+Registry& get_registry() {
+  //never destroyed, as thread_local holders may release their records after
+  //the destruction of static objects
+  static auto* registry = new Registry();
+  return *registry;
+}
+
+
+class ThreadRecordHolder {
+ public:
+  ThreadRecord& record;
+
+  ThreadRecordHolder() : record(get_registry().acquire()) {
+  }
+
+  ~ThreadRecordHolder() {
+    get_registry().release(record);
+  }
+};
+
+
+double to_milliseconds(uint64_t nanoseconds) {
+  return static_cast<double>(nanoseconds) / 1.0e6;
+}
+
+
+std::string format_milliseconds(uint64_t nanoseconds) {
+  auto stream = std::ostringstream();
+  stream << std::fixed << std::setprecision(3)
+         << to_milliseconds(nanoseconds);
+  return stream.str();
+}
+
+
+nlohmann::json counters_to_json(
+    const StageInstrumentation::ThreadCounters& counters) {
+  auto json = nlohmann::json::object();
+  for (auto i = std::size_t{0}; i < StageInstrumentation::number_of_stages;
+       ++i) {
+    const auto& stage_counters = counters[i];
+    if (stage_counters.calls == 0 && stage_counters.items == 0) {
+      continue;
+    }
+    json[StageInstrumentation::get_stage_name(
+        static_cast<StageInstrumentation::Stage>(i))] = {
+        {"time_ms", to_milliseconds(stage_counters.nanoseconds)},
+        {"calls", stage_counters.calls}, {"items", stage_counters.items}};
+  }
+  return json;
+}
+
+}  // namespace
+
+
+const std::string& StageInstrumentation::get_stage_name(Stage stage) {
+  static const std::array<std::string, number_of_stages> names = {
+      "view_loading", "block_gather", "forward_dct", "inverse_dct",
+      "partition_search", "optimum_bit_plane_search", "hexadecatree_rd",
+      "abac_encode", "abac_decode", "block_scatter", "output"};
+  return names.at(static_cast<std::size_t>(stage));
+}
+
+
+StageInstrumentation::ThreadCounters&
+StageInstrumentation::get_thread_counters() {
+  thread_local auto holder = ThreadRecordHolder();
+  return holder.record.counters;
+}
+
+
+std::vector<StageInstrumentation::ThreadCounters>
+StageInstrumentation::get_per_thread_counters() {
+  return get_registry().get_counters();
+}
+
+
+StageInstrumentation::ThreadCounters
+StageInstrumentation::get_total_counters() {
+  auto total = ThreadCounters();
+  for (const auto& thread_counters : get_per_thread_counters()) {
+    for (auto i = std::size_t{0}; i < number_of_stages; ++i) {
+      total[i] += thread_counters[i];
+    }
+  }
+  return total;
+}
+
+
+bool StageInstrumentation::has_any_record() {
+  const auto total = get_total_counters();
+  return std::any_of(total.begin(), total.end(), [](const auto& counters) {
+    return counters.calls != 0 || counters.items != 0;
+  });
+}
+
+
+void StageInstrumentation::reset() {
+  get_registry().reset();
+}
+
+
+nlohmann::json StageInstrumentation::to_json() {
+  auto threads = nlohmann::json::array();
+  for (const auto& thread_counters : get_per_thread_counters()) {
+    threads.push_back(counters_to_json(thread_counters));
+  }
+  return {{"stages", counters_to_json(get_total_counters())},
+      {"threads", threads}};
+}
+
+
+void StageInstrumentation::show_table(std::ostream& stream) {
+  const auto per_thread_counters = get_per_thread_counters();
+  const auto total = get_total_counters();
+
+  samilton::ConsoleTable table(1, 1, samilton::Alignment::centre);
+  auto line = 0;
+  auto column = 0;
+  table[line][column++] = "Stage";
+  table[line][column++] = "Calls";
+  table[line][column++] = "Items";
+  table[line][column++] = "Time (ms)";
+  for (auto thread = std::size_t{0}; thread < per_thread_counters.size();
+       ++thread) {
+    table[line][column++] = "Thread " + std::to_string(thread) + " (ms)";
+  }
+
+  for (auto i = std::size_t{0}; i < number_of_stages; ++i) {
+    if (total[i].calls == 0 && total[i].items == 0) {
+      continue;
+    }
+    ++line;
+    column = 0;
+    table[line][column++](samilton::Alignment::right) =
+        get_stage_name(static_cast<Stage>(i));
+    table[line][column++] = total[i].calls;
+    table[line][column++] = total[i].items;
+    table[line][column++] = format_milliseconds(total[i].nanoseconds);
+    for (const auto& thread_counters : per_thread_counters) {
+      table[line][column++] =
+          format_milliseconds(thread_counters[i].nanoseconds);
+    }
+  }
+  stream << table;
+}
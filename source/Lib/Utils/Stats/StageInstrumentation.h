@@ -0,0 +1,191 @@
+/* The copyright in this software is being made available under the BSD
+ * License, included below. This software may be subject to other third party
+ * and contributor rights, including patent rights, and no such rights are
+ * granted under this license.
+ *
+ * Copyright (c) 2010-2019, ITU/ISO/IEC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *  * Neither the name of the ITU/ISO/IEC nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** \file     StageInstrumentation.h
+ *  \brief    Scoped timers and counters for the codec stages
+ *  \details  Each thread accumulates the time, number of calls and number of
+ *            processed items of every stage in its own record, so that the
+ *            hot paths never take a lock. Records are kept in a registry and
+ *            reused by later threads, thus there is at most one record per
+ *            concurrently running thread. Nested stages report inclusive
+ *            times (e.g., view loading triggered by a block gather is also
+ *            accounted as block gather time).
+ *
+ *            The JPLM_STAGE_TIMER and JPLM_STAGE_ITEMS macros compile to
+ *            nothing unless JPLM_INSTRUMENTATION is defined (cmake option
+ *            -DJPLM_INSTRUMENTATION=ON).
+ *  \date     2026-10-19
+ */
+
+#ifndef JPLM_LIB_UTILS_STATS_STAGEINSTRUMENTATION_H__
+#define JPLM_LIB_UTILS_STATS_STAGEINSTRUMENTATION_H__
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "nlohmann/json.hpp"
+
+
+namespace StageInstrumentation {
+
+enum class Stage : std::size_t {
+  view_loading = 0,
+  block_gather,
+  forward_dct,
+  inverse_dct,
+  partition_search,
+  optimum_bit_plane_search,
+  hexadecatree_rd,
+  abac_encode,
+  abac_decode,
+  block_scatter,
+  output,
+  number_of_stages
+};
+
+
+constexpr auto number_of_stages =
+    static_cast<std::size_t>(Stage::number_of_stages);
+
+
+const std::string& get_stage_name(Stage stage);
+
+
+struct StageCounters {
+  uint64_t nanoseconds = 0;
+  uint64_t calls = 0;
+  uint64_t items = 0;
+
+  StageCounters& operator+=(const StageCounters& other) {
+    nanoseconds += other.nanoseconds;
+    calls += other.calls;
+    items += other.items;
+    return *this;
+  }
+};
+
+
+using ThreadCounters = std::array<StageCounters, number_of_stages>;
+
+
+/**
+ * @brief      Gets the record of the calling thread (registering it at the
+ *             first call)
+ */
+ThreadCounters& get_thread_counters();
+
+
+inline void add_time(Stage stage, uint64_t nanoseconds) {
+  auto& counters = get_thread_counters()[static_cast<std::size_t>(stage)];
+  counters.nanoseconds += nanoseconds;
+  ++counters.calls;
+}
+
+
+inline void add_items(Stage stage, uint64_t items) {
+  get_thread_counters()[static_cast<std::size_t>(stage)].items += items;
+}
+
+
+/**
+ * @brief      Copies the records of all threads that have used the
+ *             instrumentation, in registration order
+ *
+ * @details    Must not be called while other threads are being instrumented.
+ */
+std::vector<ThreadCounters> get_per_thread_counters();
+
+
+ThreadCounters get_total_counters();
+
+
+bool has_any_record();
+
+
+/**
+ * @brief      Zeroes all records (threads stay registered)
+ */
+void reset();
+
+
+nlohmann::json to_json();
+
+
+void show_table(std::ostream& stream);
+
+
+class ScopedStageTimer {
+ private:
+  const Stage stage;
+  const std::chrono::time_point<std::chrono::steady_clock> start;
+
+ public:
+  explicit ScopedStageTimer(Stage stage)
+      : stage(stage), start(std::chrono::steady_clock::now()) {
+  }
+
+  ScopedStageTimer(const ScopedStageTimer&) = delete;
+  ScopedStageTimer& operator=(const ScopedStageTimer&) = delete;
+
+  ~ScopedStageTimer() {
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+    add_time(stage,
+        static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed)
+                .count()));
+  }
+};
+
+}  // namespace StageInstrumentation
+
+
+#define JPLM_STAGE_CONCAT_IMPL(a, b) a##b
+#define JPLM_STAGE_CONCAT(a, b) JPLM_STAGE_CONCAT_IMPL(a, b)
+
+#ifdef JPLM_INSTRUMENTATION
+#define JPLM_STAGE_TIMER(stage)                                         \
+  const StageInstrumentation::ScopedStageTimer JPLM_STAGE_CONCAT(       \
+      jplm_stage_timer_, __LINE__)(StageInstrumentation::Stage::stage)
+#define JPLM_STAGE_ITEMS(stage, items) \
+  StageInstrumentation::add_items(     \
+      StageInstrumentation::Stage::stage, static_cast<uint64_t>(items))
+#else
+#define JPLM_STAGE_TIMER(stage) static_cast<void>(0)
+#define JPLM_STAGE_ITEMS(stage, items) static_cast<void>(0)
+#endif
+
+
+#endif /* end of include guard: JPLM_LIB_UTILS_STATS_STAGEINSTRUMENTATION_H__ */
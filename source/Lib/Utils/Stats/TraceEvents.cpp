@@ -0,0 +1,144 @@
+/* The copyright in this software is being made available under the BSD
+ * License, included below. This software may be subject to other third party
+ * and contributor rights, including patent rights, and no such rights are
+ * granted under this license.
+ *
+ * Copyright (c) 2010-2019, ITU/ISO/IEC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *  * Neither the name of the ITU/ISO/IEC nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** \file     TraceEvents.cpp
+ *  \brief    Timeline of begin/end events in the Chrome trace-event format
+ *  \details  
+ *  \date     2026-10-19
+ */
+
+#include "Lib/Utils/Stats/TraceEvents.h"
+#include <fstream>
+#include <iostream>
+#include <mutex>
+#include <vector>
+
+
+std::atomic<bool> TraceEvents::internal::enabled(false);
+
+
+namespace {
+
+struct Event {
+  std::string name;
+  std::string category;
+  double timestamp_us;
+  double duration_us;
+  std::size_t thread_index;
+  nlohmann::json arguments;
+};
+
+
+std::mutex events_mutex;
+std::vector<Event> events;
+std::chrono::steady_clock::time_point origin;
+std::atomic<std::size_t> number_of_thread_indices(0);
+
+
+double get_microseconds(std::chrono::steady_clock::duration duration) {
+  return std::chrono::duration<double, std::micro>(duration).count();
+}
+
+}  // namespace
+
+
+void TraceEvents::start() {
+  std::lock_guard<std::mutex> lock(events_mutex);
+  events.clear();
+  origin = std::chrono::steady_clock::now();
+  internal::enabled = true;
+}
+
+
+void TraceEvents::stop() {
+  internal::enabled = false;
+}
+
+
+std::size_t TraceEvents::get_thread_index() {
+  thread_local const auto index = number_of_thread_indices++;
+  return index;
+}
+
+
+void TraceEvents::add_complete_event(const std::string& name,
+    const std::string& category, std::chrono::steady_clock::time_point begin,
+    std::chrono::steady_clock::time_point end, nlohmann::json&& arguments) {
+  const auto thread_index = get_thread_index();
+  std::lock_guard<std::mutex> lock(events_mutex);
+  events.push_back({name, category, get_microseconds(begin - origin),
+      get_microseconds(end - begin), thread_index, std::move(arguments)});
+}
+
+
+std::size_t TraceEvents::get_number_of_events() {
+  std::lock_guard<std::mutex> lock(events_mutex);
+  return events.size();
+}
+
+
+nlohmann::json TraceEvents::to_json() {
+  std::lock_guard<std::mutex> lock(events_mutex);
+  auto trace_events = nlohmann::json::array();
+  auto named_threads = std::vector<bool>();
+  for (const auto& event : events) {
+    if (event.thread_index >= named_threads.size()) {
+      named_threads.resize(event.thread_index + 1, false);
+    }
+    if (!named_threads[event.thread_index]) {
+      named_threads[event.thread_index] = true;
+      trace_events.push_back({{"name", "thread_name"}, {"ph", "M"},
+          {"pid", 0}, {"tid", event.thread_index},
+          {"args",
+              {{"name", "thread " + std::to_string(event.thread_index)}}}});
+    }
+    auto json_event = nlohmann::json({{"name", event.name},
+        {"cat", event.category}, {"ph", "X"}, {"ts", event.timestamp_us},
+        {"dur", event.duration_us}, {"pid", 0}, {"tid", event.thread_index}});
+    if (!event.arguments.is_null()) {
+      json_event["args"] = event.arguments;
+    }
+    trace_events.push_back(std::move(json_event));
+  }
+  return {{"traceEvents", trace_events}, {"displayTimeUnit", "ms"}};
+}
+
+
+void TraceEvents::write(const std::filesystem::path& path) {
+  auto file = std::ofstream(path);
+  if (!file.is_open()) {
+    std::cerr << "Error opening trace file " << path << std::endl;
+    return;
+  }
+  file << to_json() << std::endl;
+}
@@ -0,0 +1,157 @@
+/* The copyright in this software is being made available under the BSD
+ * License, included below. This software may be subject to other third party
+ * and contributor rights, including patent rights, and no such rights are
+ * granted under this license.
+ *
+ * Copyright (c) 2010-2019, ITU/ISO/IEC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *  * Neither the name of the ITU/ISO/IEC nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** \file     TraceEvents.h
+ *  \brief    Timeline of begin/end events in the Chrome trace-event format
+ *  \details  Events are only recorded after TraceEvents::start is called
+ *            (e.g., by --trace-file), so that the cost of a disabled event is
+ *            a single atomic load. The written file can be opened in
+ *            chrome://tracing or in Perfetto (https://ui.perfetto.dev).
+ *  \date     2026-10-19
+ */
+
+#ifndef JPLM_LIB_UTILS_STATS_TRACEEVENTS_H__
+#define JPLM_LIB_UTILS_STATS_TRACEEVENTS_H__
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <filesystem>
+#include <string>
+#include "nlohmann/json.hpp"
+
+
+namespace TraceEvents {
+
+namespace internal {
+extern std::atomic<bool> enabled;
+}
+
+
+inline bool is_enabled() {
+  return internal::enabled.load(std::memory_order_relaxed);
+}
+
+
+/**
+ * @brief      Discards previous events and starts recording. Event times are
+ *             relative to this call.
+ */
+void start();
+
+
+void stop();
+
+
+/**
+ * @brief      Gets a small identifier of the calling thread (assigned in the
+ *             order in which threads record their first event)
+ */
+std::size_t get_thread_index();
+
+
+/**
+ * @brief      Records a complete event (i.e., with begin time and duration)
+ *
+ * @param[in]  begin  The begin time
+ * @param[in]  end    The end time
+ */
+void add_complete_event(const std::string& name, const std::string& category,
+    std::chrono::steady_clock::time_point begin,
+    std::chrono::steady_clock::time_point end, nlohmann::json&& arguments);
+
+
+std::size_t get_number_of_events();
+
+
+/**
+ * @brief      Gets the events as a trace-event JSON object (with thread name
+ *             metadata events)
+ */
+nlohmann::json to_json();
+
+
+void write(const std::filesystem::path& path);
+
+
+/**
+ * @brief      Records an event spanning the lifetime of the object, if
+ *             tracing is enabled and the given condition holds
+ */
+class ScopedEvent {
+ private:
+  const char* const name;
+  const char* const category;
+  const bool recording;
+  std::chrono::steady_clock::time_point begin;
+  nlohmann::json arguments;
+
+ public:
+  ScopedEvent(const char* name, const char* category, bool condition = true)
+      : name(name), category(category), recording(condition && is_enabled()) {
+    if (recording) {
+      begin = std::chrono::steady_clock::now();
+    }
+  }
+
+  ScopedEvent(const ScopedEvent&) = delete;
+  ScopedEvent& operator=(const ScopedEvent&) = delete;
+
+  ~ScopedEvent() {
+    if (recording) {
+      add_complete_event(name, category, begin,
+          std::chrono::steady_clock::now(), std::move(arguments));
+    }
+  }
+
+
+  bool is_recording() const noexcept {
+    return recording;
+  }
+
+
+  /**
+   * @brief      Adds an argument shown with the event (ignored when not
+   *             recording)
+   */
+  template<typename T>
+  void add_argument(const char* key, const T& value) {
+    if (recording) {
+      arguments[key] = value;
+    }
+  }
+};
+
+}  // namespace TraceEvents
+
+#endif /* end of include guard: JPLM_LIB_UTILS_STATS_TRACEEVENTS_H__ */
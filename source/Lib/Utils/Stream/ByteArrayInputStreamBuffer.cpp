@@ -0,0 +1,76 @@
+/* The copyright in this software is being made available under the BSD
+ * License, included below. This software may be subject to other third party
+ * and contributor rights, including patent rights, and no such rights are
+ * granted under this license.
+ *
+ * Copyright (c) 2010-2019, ITU/ISO/IEC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *  * Neither the name of the ITU/ISO/IEC nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** \file     ByteArrayInputStreamBuffer.cpp
+ *  \brief    Read-only stream buffer over a caller-provided byte array
+ *  \details  
+ *  \date     2026-10-19
+ */
+
+#include "Lib/Utils/Stream/ByteArrayInputStreamBuffer.h"
+
+
+ByteArrayInputStreamBuffer::ByteArrayInputStreamBuffer(
+    const std::byte* data, std::size_t size) {
+  //the get area is never written, the const_cast is required by the interface
+  auto begin = const_cast<char*>(reinterpret_cast<const char*>(data));
+  this->setg(begin, begin, begin + size);
+}
+
+
+ByteArrayInputStreamBuffer::pos_type ByteArrayInputStreamBuffer::seekoff(
+    off_type offset, std::ios_base::seekdir direction,
+    std::ios_base::openmode which) {
+  if (!(which & std::ios_base::in)) {
+    return pos_type(off_type(-1));
+  }
+  auto base = off_type(0);
+  if (direction == std::ios_base::cur) {
+    base = this->gptr() - this->eback();
+  } else if (direction == std::ios_base::end) {
+    base = this->egptr() - this->eback();
+  }
+  return seekpos(pos_type(base + offset), which);
+}
+
+
+ByteArrayInputStreamBuffer::pos_type ByteArrayInputStreamBuffer::seekpos(
+    pos_type position, std::ios_base::openmode which) {
+  const auto offset = off_type(position);
+  if (!(which & std::ios_base::in) || (offset < 0) ||
+      (offset > this->egptr() - this->eback())) {
+    return pos_type(off_type(-1));
+  }
+  this->setg(this->eback(), this->eback() + offset, this->egptr());
+  return position;
+}
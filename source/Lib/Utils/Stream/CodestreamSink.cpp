@@ -0,0 +1,114 @@
+/* The copyright in this software is being made available under the BSD
+ * License, included below. This software may be subject to other third party
+ * and contributor rights, including patent rights, and no such rights are
+ * granted under this license.
+ *
+ * Copyright (c) 2010-2019, ITU/ISO/IEC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *  * Neither the name of the ITU/ISO/IEC nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** \file     CodestreamSink.cpp
+ *  \brief    Destinations for serialized codestreams
+ *  \details  
+ *  \date     2026-10-19
+ */
+
+#include "Lib/Utils/Stream/CodestreamSink.h"
+#include <algorithm>
+
+
+ByteVectorCodestreamSink::ByteVectorCodestreamSink(
+    std::vector<std::byte>& bytes)
+    : bytes(bytes) {
+}
+
+
+void ByteVectorCodestreamSink::write(const std::byte* data, std::size_t size) {
+  bytes.insert(bytes.end(), data, data + size);
+}
+
+
+void ByteVectorCodestreamSink::reserve(std::size_t size) {
+  bytes.reserve(bytes.size() + size);
+}
+
+
+CodestreamSinkStreamBuffer::CodestreamSinkStreamBuffer(CodestreamSink& sink)
+    : sink(sink), buffer(buffer_size) {
+  this->setp(buffer.data(), buffer.data() + buffer.size());
+}
+
+
+CodestreamSinkStreamBuffer::~CodestreamSinkStreamBuffer() {
+  flush_buffer();
+}
+
+
+void CodestreamSinkStreamBuffer::flush_buffer() {
+  const auto n = static_cast<std::size_t>(this->pptr() - this->pbase());
+  if (n > 0) {
+    sink.write(reinterpret_cast<const std::byte*>(this->pbase()), n);
+    this->setp(buffer.data(), buffer.data() + buffer.size());
+  }
+}
+
+
+CodestreamSinkStreamBuffer::int_type CodestreamSinkStreamBuffer::overflow(
+    int_type value) {
+  flush_buffer();
+  if (!traits_type::eq_int_type(value, traits_type::eof())) {
+    *(this->pptr()) = traits_type::to_char_type(value);
+    this->pbump(1);
+  }
+  return traits_type::not_eof(value);
+}
+
+
+std::streamsize CodestreamSinkStreamBuffer::xsputn(
+    const char* data, std::streamsize n) {
+  const auto available = this->epptr() - this->pptr();
+  if (n <= available) {
+    std::copy(data, data + n, this->pptr());
+    this->pbump(static_cast<int>(n));
+    return n;
+  }
+  flush_buffer();
+  if (static_cast<std::size_t>(n) >= buffer_size) {
+    sink.write(reinterpret_cast<const std::byte*>(data),
+        static_cast<std::size_t>(n));
+    return n;
+  }
+  std::copy(data, data + n, this->pptr());
+  this->pbump(static_cast<int>(n));
+  return n;
+}
+
+
+int CodestreamSinkStreamBuffer::sync() {
+  flush_buffer();
+  return 0;
+}
@@ -0,0 +1,126 @@
+/* The copyright in this software is being made available under the BSD
+ * License, included below. This software may be subject to other third party
+ * and contributor rights, including patent rights, and no such rights are
+ * granted under this license.
+ *
+ * Copyright (c) 2010-2019, ITU/ISO/IEC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *  * Neither the name of the ITU/ISO/IEC nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** \file     CodestreamSink.h
+ *  \brief    Destinations for serialized codestreams
+ *  \details  A CodestreamSink receives the bytes of a codestream as they are
+ *            serialized. CodestreamSinkStreamBuffer adapts a sink to the
+ *            std::ostream based serialization of boxes (operator<<), so that
+ *            a JPLFile can be written to memory, a socket, etc.
+ *  \date     2026-10-19
+ */
+
+#ifndef JPLM_LIB_UTILS_STREAM_CODESTREAMSINK_H__
+#define JPLM_LIB_UTILS_STREAM_CODESTREAMSINK_H__
+
+#include <cstddef>
+#include <streambuf>
+#include <vector>
+
+
+class CodestreamSink {
+ public:
+  /**
+   * \brief      Receives the next bytes of the codestream.
+   *
+   * \param[in]  data  Pointer to the bytes
+   * \param[in]  size  The number of bytes
+   */
+  virtual void write(const std::byte* data, std::size_t size) = 0;
+
+
+  /**
+   * \brief      Hint on the total number of bytes that will be written.
+   */
+  virtual void reserve([[maybe_unused]] std::size_t size) {
+  }
+
+
+  virtual ~CodestreamSink() = default;
+};
+
+
+/**
+ * \brief      Appends the codestream to a caller-owned byte vector.
+ */
+class ByteVectorCodestreamSink : public CodestreamSink {
+ protected:
+  std::vector<std::byte>& bytes;
+
+ public:
+  ByteVectorCodestreamSink(std::vector<std::byte>& bytes);
+
+
+  virtual void write(const std::byte* data, std::size_t size) override;
+
+
+  virtual void reserve(std::size_t size) override;
+
+
+  virtual ~ByteVectorCodestreamSink() = default;
+};
+
+
+/**
+ * \brief      Output stream buffer forwarding everything to a CodestreamSink.
+ *
+ * \details    Small writes (e.g., the LBox and TBox of each box) are
+ * accumulated in an internal buffer; the sink receives the bytes in chunks
+ * of at most buffer_size bytes, except for large writes, which are forwarded
+ * directly. Remaining bytes are flushed on sync() and on destruction.
+ */
+class CodestreamSinkStreamBuffer : public std::streambuf {
+ protected:
+  static constexpr std::size_t buffer_size = 64 * 1024;
+  CodestreamSink& sink;
+  std::vector<char> buffer;
+
+  void flush_buffer();
+
+
+  virtual int_type overflow(int_type value) override;
+
+
+  virtual std::streamsize xsputn(const char* data, std::streamsize n) override;
+
+
+  virtual int sync() override;
+
+ public:
+  CodestreamSinkStreamBuffer(CodestreamSink& sink);
+
+
+  virtual ~CodestreamSinkStreamBuffer();
+};
+
+#endif /* end of include guard: JPLM_LIB_UTILS_STREAM_CODESTREAMSINK_H__ */
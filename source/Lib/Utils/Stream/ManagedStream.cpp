@@ -42,11 +42,25 @@
 #include "ManagedStream.h"
 
 
+/**
+ * \brief      Checks if the stream can be used
+ *
+ * \details    File streams must be open; other streams (e.g., over a byte
+ * array in memory) must not be in a failed state.
+ */
+static bool is_open(const std::istream& stream) {
+  if (auto file_stream = dynamic_cast<const std::ifstream*>(&stream)) {
+    return file_stream->is_open();
+  }
+  return !stream.fail();
+}
+
+
 ManagedStream::ManagedStream(
-    std::ifstream& ref_to_stream, uint64_t initial_pos, uint64_t final_pos)
+    std::istream& ref_to_stream, uint64_t initial_pos, uint64_t final_pos)
     : ref_to_stream(ref_to_stream), initial_pos(initial_pos),
       final_pos(final_pos) {
-  if (!ref_to_stream.is_open()) {
+  if (!is_open(ref_to_stream)) {
     throw ManagedStreamExceptions::ClosedStreamException();
   }
   if (initial_pos >= final_pos) {
@@ -70,7 +84,7 @@ ManagedStream::ManagedStream(
 }
 
 
-ManagedStream::ManagedStream(std::ifstream& ref_to_stream, uint64_t max_offset)
+ManagedStream::ManagedStream(std::istream& ref_to_stream, uint64_t max_offset)
     : ManagedStream(ref_to_stream, ref_to_stream.tellg(),
           static_cast<uint64_t>(ref_to_stream.tellg()) + max_offset) {
 }
@@ -52,15 +52,15 @@
 
 class ManagedStream {
  protected:
-  std::ifstream&
+  std::istream&
       ref_to_stream;  //it may be a good idea to change for a weak ptr
   const std::size_t initial_pos;
   const std::size_t final_pos;
 
  public:
   ManagedStream(
-      std::ifstream& ref_to_stream, uint64_t initial_pos, uint64_t final_pos);
-  ManagedStream(std::ifstream& ref_to_stream, uint64_t max_offset);
+      std::istream& ref_to_stream, uint64_t initial_pos, uint64_t final_pos);
+  ManagedStream(std::istream& ref_to_stream, uint64_t max_offset);
 
   ManagedStream get_sub_managed_stream(
       uint64_t initial_pos, uint64_t final_pos);
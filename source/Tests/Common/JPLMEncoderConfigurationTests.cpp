@@ -41,6 +41,8 @@
 
 #include <exception>
 #include <filesystem>
+#include <fstream>
+#include "Lib/Common/CommonExceptions.h"
 #include "Lib/Common/JPLMEncoderConfiguration.h"
 #include "Lib/Common/JPLMEncoderConfigurationLightField4DTransformMode.h"
 #include "gtest/gtest.h"
@@ -225,6 +227,188 @@ TEST(JPLMEncoderConfigurationLightField4DTransformModeTest, LambdaFromCLI) {
 }
 
 
+TEST(JPLMEncoderConfigurationLightField4DTransformModeTest, LambdasFromCLI) {
+  const char* argv[] = {"", "-i", "../resources/small_greek/", "-o",
+      "../resources/out_small_greek/", "-l", "12", "--lambdas",
+      "100, 1000,1e4"};
+  int argc = 9;
+  JPLMEncoderConfigurationLightField4DTransformMode config(
+      argc, const_cast<char**>(argv));
+  EXPECT_TRUE(config.has_multiple_lambdas());
+  EXPECT_EQ(std::vector<double>({100, 1000, 10000}), config.get_lambdas());
+}
+
+
+TEST(JPLMEncoderConfigurationLightField4DTransformModeTest,
+    LambdasDefaultToTheLambda) {
+  const char* argv[] = {"", "-i", "../resources/small_greek/", "-o",
+      "../resources/out_small_greek/", "-l", "12"};
+  int argc = 7;
+  JPLMEncoderConfigurationLightField4DTransformMode config(
+      argc, const_cast<char**>(argv));
+  EXPECT_FALSE(config.has_multiple_lambdas());
+  EXPECT_EQ(std::vector<double>({12}), config.get_lambdas());
+}
+
+
+TEST(JPLMEncoderConfigurationLightField4DTransformModeTest,
+    InvalidLambdasThrow) {
+  EXPECT_THROW(get_lambdas_from_list("100,a"),
+      JPLMConfigurationExceptions::InvalidLambdasException);
+  EXPECT_THROW(get_lambdas_from_list("100,0"),
+      JPLMConfigurationExceptions::InvalidLambdasException);
+  EXPECT_THROW(get_lambdas_from_list("100,-1"),
+      JPLMConfigurationExceptions::InvalidLambdasException);
+}
+
+
+TEST(JPLMEncoderConfigurationLightField4DTransformModeTest,
+    FilenameForLambda) {
+  using Configuration = JPLMEncoderConfigurationLightField4DTransformMode;
+  EXPECT_EQ("/tmp/out_lambda_100.jpl",
+      Configuration::get_filename_for_lambda("/tmp/out.jpl", 100));
+  EXPECT_EQ("out_lambda_0.5.jpl",
+      Configuration::get_filename_for_lambda("out.jpl", 0.5));
+  EXPECT_EQ("out_lambda_10000",
+      Configuration::get_filename_for_lambda("out", 10000));
+}
+
+
+TEST(JPLMEncoderConfigurationLightField4DTransformModeTest, TargetBppFromCLI) {
+  const char* argv[] = {"", "-i", "../resources/small_greek/", "-o",
+      "../resources/out_small_greek/", "--target-bpp", "0.25", "-rrow",
+      "true"};
+  int argc = 9;
+  JPLMEncoderConfigurationLightField4DTransformMode config(
+      argc, const_cast<char**>(argv));
+  EXPECT_TRUE(config.has_target_bpp());
+  EXPECT_DOUBLE_EQ(0.25, config.get_target_bpp());
+  EXPECT_TRUE(config.refines_lambda_per_row());
+}
+
+
+TEST(JPLMEncoderConfigurationLightField4DTransformModeTest,
+    PartitionSearchThreadsFromCLI) {
+  const char* argv[] = {"", "-i", "../resources/small_greek/", "-o",
+      "../resources/out_small_greek/", "--partition-search-threads", "4",
+      "-ppdepth", "2"};
+  int argc = 9;
+  JPLMEncoderConfigurationLightField4DTransformMode config(
+      argc, const_cast<char**>(argv));
+  EXPECT_EQ(4, config.get_partition_search_threads());
+  EXPECT_EQ(2, config.get_parallel_partition_depth());
+}
+
+
+TEST(JPLMEncoderConfigurationLightField4DTransformModeTest,
+    SerialPartitionSearchByDefault) {
+  const char* argv[] = {"", "-i", "../resources/small_greek/", "-o",
+      "../resources/out_small_greek/"};
+  int argc = 5;
+  JPLMEncoderConfigurationLightField4DTransformMode config(
+      argc, const_cast<char**>(argv));
+  EXPECT_EQ(1, config.get_partition_search_threads());
+  EXPECT_EQ(3, config.get_parallel_partition_depth());
+  EXPECT_EQ(TransformPrecision::double_precision,
+      config.get_partition_search_precision());
+  EXPECT_FALSE(config.has_time_budget());
+  EXPECT_FALSE(config.writes_checkpoints());
+  EXPECT_FALSE(config.resumes());
+}
+
+
+TEST(JPLMEncoderConfigurationLightField4DTransformModeTest,
+    SinglePrecisionPartitionSearchFromCLI) {
+  const char* argv[] = {"", "-i", "../resources/small_greek/", "-o",
+      "../resources/out_small_greek/", "-spsearch", "true"};
+  int argc = 7;
+  JPLMEncoderConfigurationLightField4DTransformMode config(
+      argc, const_cast<char**>(argv));
+  EXPECT_EQ(TransformPrecision::single_precision,
+      config.get_partition_search_precision());
+}
+
+
+TEST(JPLMEncoderConfigurationLightField4DTransformModeTest,
+    TimeBudgetFromCLI) {
+  const char* argv[] = {"", "-i", "../resources/small_greek/", "-o",
+      "../resources/out_small_greek/", "--time-budget", "90.5"};
+  int argc = 7;
+  JPLMEncoderConfigurationLightField4DTransformMode config(
+      argc, const_cast<char**>(argv));
+  EXPECT_TRUE(config.has_time_budget());
+  EXPECT_DOUBLE_EQ(90.5, config.get_time_budget());
+}
+
+
+TEST(JPLMEncoderConfigurationLightField4DTransformModeTest,
+    CheckpointOptionsFromCLI) {
+  const char* argv[] = {"", "-i", "../resources/small_greek/", "-o",
+      "../resources/out_small_greek.jpl", "--checkpoint-interval", "50",
+      "--resume", "true"};
+  int argc = 9;
+  JPLMEncoderConfigurationLightField4DTransformMode config(
+      argc, const_cast<char**>(argv));
+  EXPECT_TRUE(config.writes_checkpoints());
+  EXPECT_EQ(50, config.get_checkpoint_interval());
+  EXPECT_TRUE(config.resumes());
+  EXPECT_EQ("../resources/out_small_greek.jpl.checkpoint",
+      config.get_checkpoint_filename());
+}
+
+
+TEST(JPLMEncoderConfigurationLightField4DTransformModeTest,
+    MemoryBudgetFromJSON) {
+  const auto conf = std::filesystem::temp_directory_path() /
+                    "jplm_memory_budget_configuration.json";
+  std::ofstream(conf) << R"({"memory-budget": 512})";
+  const auto conf_string = conf.string();
+  const char* argv[] = {"", "-i", "../resources/small_greek/", "-o",
+      "../resources/out_small_greek/", "-c", conf_string.c_str()};
+  int argc = 7;
+  JPLMEncoderConfigurationLightField4DTransformMode config(
+      argc, const_cast<char**>(argv));
+  std::filesystem::remove(conf);
+  EXPECT_EQ(std::size_t{512} * 1024 * 1024, config.get_memory_budget());
+}
+
+
+TEST(JPLMEncoderConfigurationLightField4DTransformModeTest,
+    CheckpointsWithLambdaRefinementThrow) {
+  const char* argv[] = {"", "-i", "../resources/small_greek/", "-o",
+      "../resources/out_small_greek/", "--target-bpp", "0.25",
+      "--refine-lambda-per-row", "true", "--checkpoint-interval", "50"};
+  int argc = 11;
+  EXPECT_THROW(JPLMEncoderConfigurationLightField4DTransformMode(
+                   argc, const_cast<char**>(argv)),
+      JPLMConfigurationExceptions::InconsistentOptionsException);
+}
+
+
+TEST(JPLMEncoderConfigurationLightField4DTransformModeTest,
+    NoTargetBppByDefault) {
+  const char* argv[] = {"", "-i", "../resources/small_greek/", "-o",
+      "../resources/out_small_greek/"};
+  int argc = 5;
+  JPLMEncoderConfigurationLightField4DTransformMode config(
+      argc, const_cast<char**>(argv));
+  EXPECT_FALSE(config.has_target_bpp());
+  EXPECT_FALSE(config.refines_lambda_per_row());
+}
+
+
+TEST(JPLMEncoderConfigurationLightField4DTransformModeTest,
+    TargetBppWithLambdasThrows) {
+  const char* argv[] = {"", "-i", "../resources/small_greek/", "-o",
+      "../resources/out_small_greek/", "--target-bpp", "0.25", "--lambdas",
+      "100,1000"};
+  int argc = 9;
+  EXPECT_THROW(JPLMEncoderConfigurationLightField4DTransformMode(
+                   argc, const_cast<char**>(argv)),
+      JPLMConfigurationExceptions::InconsistentOptionsException);
+}
+
+
 TEST(JPLMEncoderConfigurationLightField4DTransformModeTest,
     BorderPolicyPadding) {
   const char* argv[] = {"", "-i", "../resources/small_greek/", "-o",
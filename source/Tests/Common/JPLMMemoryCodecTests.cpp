@@ -0,0 +1,629 @@
+/* The copyright in this software is being made available under the BSD
+ * License, included below. This software may be subject to other third party
+ * and contributor rights, including patent rights, and no such rights are
+ * granted under this license.
+ *
+ * Copyright (c) 2010-2019, ITU/ISO/IEC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *  * Neither the name of the ITU/ISO/IEC nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** \file     JPLMMemoryCodecTests.cpp
+ *  \brief    Test of the in-memory encoding and decoding of light fields.
+ *  \details  
+ *  \date     2026-10-19
+ */
+
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include "Lib/Common/JPLMMemoryCodec.h"
+#include "Lib/Part1/Common/UncompressedThumbnail.h"
+#include "Lib/Part1/Decoder/JPLFileFromStream.h"
+#include "Lib/Part1/Decoder/JPLThumbnailReader.h"
+#include "Lib/Part2/Common/PlanarLightfieldFile.h"
+#include "Lib/Part2/Decoder/TransformMode/JPLM4DTransformModeLightFieldDecoder.h"
+#include "Lib/Part2/Encoder/TransformMode/JPLM4DTransformModeLightFieldEncoder.h"
+#include "Lib/Utils/Image/UndefinedImage.h"
+#include "Lib/Utils/Stats/MemoryAccounting.h"
+#include "gtest/gtest.h"
+
+
+struct JPLMMemoryCodecTest : public testing::Test {
+ protected:
+  const std::filesystem::path directory;
+  const LightfieldDimension<std::size_t> dimension;
+  const std::size_t number_of_channels = 3;
+  const std::size_t bits_per_sample = 10;
+  std::vector<uint16_t> samples;
+
+ public:
+  JPLMMemoryCodecTest()
+      : directory(std::filesystem::temp_directory_path() /
+                  "jplm_memory_codec_tests"),
+        dimension(3, 2, 20, 24) {
+    std::filesystem::create_directories(directory);
+    samples.resize(dimension.get_number_of_views_per_lightfield() *
+                   number_of_channels *
+                   dimension.get_number_of_pixels_per_view());
+    //smooth content with some parallax between views
+    auto sample = samples.begin();
+    for (auto t = 0; t < 3; ++t) {
+      for (auto s = 0; s < 2; ++s) {
+        for (auto c = 0; c < 3; ++c) {
+          for (auto v = 0; v < 20; ++v) {
+            for (auto u = 0; u < 24; ++u) {
+              *sample++ = static_cast<uint16_t>(
+                  512 + 200 * std::sin(0.3 * (u + s) + 0.2 * c) +
+                  150 * std::cos(0.25 * (v + t)));
+            }
+          }
+        }
+      }
+    }
+  }
+
+
+  ~JPLMMemoryCodecTest() {
+    std::filesystem::remove_all(directory);
+  }
+
+
+  std::shared_ptr<JPLMEncoderConfigurationLightField4DTransformMode>
+  get_encoder_configuration(const std::string& input = "",
+      const std::vector<std::string>& extra_arguments = {}) const {
+    auto arguments = std::vector<std::string>({"", "--part", "2", "--type",
+        "0", "--enum-cs", "YCbCr_2", "-t", "3", "-s", "2", "-v", "20", "-u",
+        "24", "-nc", "3", "--lambda", "100",
+        "--transform_size_maximum_inter_view_vertical", "3",
+        "--transform_size_maximum_inter_view_horizontal", "2",
+        "--transform_size_maximum_intra_view_vertical", "16",
+        "--transform_size_maximum_intra_view_horizontal", "16",
+        "--transform_size_minimum_inter_view_vertical", "1",
+        "--transform_size_minimum_inter_view_horizontal", "1",
+        "--transform_size_minimum_intra_view_vertical", "4",
+        "--transform_size_minimum_intra_view_horizontal", "4"});
+    if (!input.empty()) {
+      arguments.push_back("--input");
+      arguments.push_back(input);
+    }
+    arguments.insert(
+        arguments.end(), extra_arguments.begin(), extra_arguments.end());
+    auto argv = std::vector<char*>();
+    for (auto& argument : arguments) {
+      argv.push_back(const_cast<char*>(argument.c_str()));
+    }
+    return std::make_shared<JPLMEncoderConfigurationLightField4DTransformMode>(
+        static_cast<int>(argv.size()), argv.data());
+  }
+
+
+  static std::shared_ptr<JPLMDecoderConfiguration> get_decoder_configuration(
+      std::vector<std::string> arguments = {}) {
+    arguments.insert(arguments.begin(), "");
+    auto argv = std::vector<char*>();
+    for (auto& argument : arguments) {
+      argv.push_back(const_cast<char*>(argument.c_str()));
+    }
+    return std::make_shared<JPLMDecoderConfiguration>(
+        static_cast<int>(argv.size()), argv.data());
+  }
+
+
+  std::shared_ptr<LightfieldMemoryIO<uint16_t>> get_input() const {
+    return LightfieldMemoryIO<uint16_t>::from_planar_buffer(
+        samples.data(), dimension, number_of_channels, bits_per_sample);
+  }
+
+
+  std::string write_planar_file(const std::string& name) const {
+    auto filename = (directory / name).string();
+    auto planar_file = PlanarLightfieldFile(
+        filename, dimension, number_of_channels, bits_per_sample);
+    auto input = get_input();
+    for (auto t = std::size_t(0); t < dimension.get_t(); ++t) {
+      for (auto s = std::size_t(0); s < dimension.get_s(); ++s) {
+        auto image = UndefinedImage<uint16_t>(dimension.get_u(),
+            dimension.get_v(), bits_per_sample, number_of_channels);
+        input->read_view({t, s}, image);
+        planar_file.write_view(t, s, image);
+      }
+    }
+    return filename;
+  }
+};
+
+
+TEST_F(JPLMMemoryCodecTest, MemoryEncodingIsEqualToFileEncoding) {
+  auto filename = write_planar_file("input.plf");
+  auto encoder = JPLM4DTransformModeLightFieldEncoder<uint16_t>(
+      get_encoder_configuration(filename));
+  encoder.run();
+  auto stream = std::ostringstream();
+  stream << encoder.get_ref_to_jpl_file();
+  const auto file_codestream = stream.str();
+
+  const auto bytes = JPLMMemoryCodec::encode_light_field(
+      get_encoder_configuration(), get_input());
+
+  ASSERT_EQ(bytes.size(), file_codestream.size());
+  EXPECT_TRUE(std::equal(bytes.begin(), bytes.end(), file_codestream.begin(),
+      [](auto byte, auto character) {
+        return byte == static_cast<std::byte>(character);
+      }));
+}
+
+
+TEST_F(JPLMMemoryCodecTest, EachLambdaIsEqualToItsSingleLambdaEncoding) {
+  const auto lambdas = std::vector<std::string>({"10", "100", "1000"});
+  const auto files = JPLMMemoryCodec::encode_light_field_for_each_lambda(
+      get_encoder_configuration("", {"--lambdas", "10,100,1000"}),
+      get_input());
+  ASSERT_EQ(files.size(), lambdas.size());
+  for (auto i = std::size_t(0); i < lambdas.size(); ++i) {
+    const auto bytes = JPLMMemoryCodec::encode_light_field(
+        get_encoder_configuration("", {"--lambdas", lambdas[i]}),
+        get_input());
+    EXPECT_EQ(files[i], bytes) << "lambda " << lambdas[i];
+  }
+  EXPECT_EQ(files[1], JPLMMemoryCodec::encode_light_field(
+                          get_encoder_configuration(), get_input()));
+  EXPECT_GT(files[0].size(), files[2].size());
+}
+
+
+TEST_F(JPLMMemoryCodecTest, ParallelPartitionSearchIsEqualToSerialSearch) {
+  const auto serial = JPLMMemoryCodec::encode_light_field(
+      get_encoder_configuration(), get_input());
+  const auto parallel = JPLMMemoryCodec::encode_light_field(
+      get_encoder_configuration(
+          "", {"--partition-search-threads", "4", "-ppdepth", "8"}),
+      get_input());
+  EXPECT_EQ(serial, parallel);
+}
+
+
+TEST_F(JPLMMemoryCodecTest, SinglePrecisionPartitionSearchIsDecodable) {
+  const auto reference = JPLMMemoryCodec::encode_light_field(
+      get_encoder_configuration(), get_input());
+  const auto bytes = JPLMMemoryCodec::encode_light_field(
+      get_encoder_configuration("", {"-spsearch", "true"}), get_input());
+  EXPECT_NEAR(static_cast<double>(bytes.size()),
+      static_cast<double>(reference.size()), 0.01 * reference.size());
+
+  const auto decoded = JPLMMemoryCodec::decode_light_field(
+      bytes.data(), bytes.size(), get_decoder_configuration());
+  EXPECT_EQ(decoded.dimension, dimension);
+  EXPECT_EQ(decoded.samples.size(),
+      dimension.get_number_of_pixels_per_lightfield() * number_of_channels);
+}
+
+
+TEST_F(JPLMMemoryCodecTest, ExhaustedTimeBudgetIsDecodable) {
+  //after the first block, the budget only allows the whole block transforms
+  const auto bytes = JPLMMemoryCodec::encode_light_field(
+      get_encoder_configuration("", {"--time-budget", "1e-9"}), get_input());
+
+  const auto decoded = JPLMMemoryCodec::decode_light_field(
+      bytes.data(), bytes.size(), get_decoder_configuration());
+  EXPECT_EQ(decoded.dimension, dimension);
+  EXPECT_EQ(decoded.samples.size(),
+      dimension.get_number_of_pixels_per_lightfield() * number_of_channels);
+}
+
+
+TEST_F(JPLMMemoryCodecTest, LargeTimeBudgetIsEqualToNoBudget) {
+  const auto reference = JPLMMemoryCodec::encode_light_field(
+      get_encoder_configuration(), get_input());
+  const auto bytes = JPLMMemoryCodec::encode_light_field(
+      get_encoder_configuration("", {"--time-budget", "1e6"}), get_input());
+  EXPECT_EQ(bytes, reference);
+}
+
+
+TEST_F(JPLMMemoryCodecTest, ResumedEncodingIsEqualToTheUninterruptedOne) {
+  const auto reference = JPLMMemoryCodec::encode_light_field(
+      get_encoder_configuration(), get_input());
+
+  //the last of the 12 blocks (4 per channel) checkpointed is the 10th
+  const auto output = (directory / "resumed.jpl").string();
+  JPLMMemoryCodec::encode_light_field(
+      get_encoder_configuration(
+          "", {"--output", output, "--checkpoint-interval", "5"}),
+      get_input());
+  const auto checkpoint = EncodingCheckpoint::read(output + ".checkpoint");
+  ASSERT_TRUE(checkpoint);
+  EXPECT_EQ(10, checkpoint->number_of_encoded_blocks);
+
+  const auto bytes = JPLMMemoryCodec::encode_light_field(
+      get_encoder_configuration("", {"--output", output, "--resume", "true"}),
+      get_input());
+  EXPECT_EQ(bytes, reference);
+}
+
+
+TEST_F(JPLMMemoryCodecTest, ResumeWithOtherLambdaThrows) {
+  const auto output = (directory / "other_lambda.jpl").string();
+  JPLMMemoryCodec::encode_light_field(
+      get_encoder_configuration(
+          "", {"--output", output, "--checkpoint-interval", "5"}),
+      get_input());
+  EXPECT_THROW(
+      JPLMMemoryCodec::encode_light_field(
+          get_encoder_configuration("",
+              {"--output", output, "--resume", "true", "--lambda", "1000"}),
+          get_input()),
+      JPLM4DTransformModeLightFieldEncoderExceptions::
+          InvalidCheckpointException);
+}
+
+
+TEST_F(JPLMMemoryCodecTest, MemoryDecodingIsEqualToFileDecoding) {
+  const auto bytes = JPLMMemoryCodec::encode_light_field(
+      get_encoder_configuration(), get_input());
+  auto jpl_filename = (directory / "lightfield.jpl").string();
+  {
+    std::ofstream file(jpl_filename, std::ios::binary);
+    file.write(reinterpret_cast<const char*>(bytes.data()), bytes.size());
+  }
+
+  auto output_filename = (directory / "output.plf").string();
+  {
+    auto jpl_file = std::make_shared<JPLFileFromStream>(jpl_filename);
+    const auto& light_field_box = static_cast<const JpegPlenoLightFieldBox&>(
+        *(jpl_file->get_reference_to_codestreams().at(0)));
+    auto decoder = JPLM4DTransformModeLightFieldDecoder<uint16_t>(jpl_file,
+        light_field_box, output_filename, get_decoder_configuration());
+    decoder.run();
+  }
+
+  const auto decoded = JPLMMemoryCodec::decode_light_field(
+      bytes.data(), bytes.size(), get_decoder_configuration());
+  EXPECT_EQ(decoded.dimension, dimension);
+  EXPECT_EQ(decoded.number_of_channels, number_of_channels);
+  EXPECT_EQ(decoded.bits_per_sample, bits_per_sample);
+
+  auto planar_file = PlanarLightfieldFile(output_filename);
+  auto sample = decoded.samples.begin();
+  for (auto t = std::size_t(0); t < dimension.get_t(); ++t) {
+    for (auto s = std::size_t(0); s < dimension.get_s(); ++s) {
+      auto image = UndefinedImage<uint16_t>(dimension.get_u(),
+          dimension.get_v(), bits_per_sample, number_of_channels);
+      planar_file.read_view(t, s, image);
+      for (auto c = std::size_t(0); c < number_of_channels; ++c) {
+        const auto* channel = image.get_channel(c).data();
+        EXPECT_TRUE(std::equal(channel,
+            channel + dimension.get_number_of_pixels_per_view(), sample));
+        sample += dimension.get_number_of_pixels_per_view();
+      }
+    }
+  }
+}
+
+
+TEST_F(JPLMMemoryCodecTest, MemoryBudgetReleasesViewsWithoutChangingResults) {
+  const auto bytes = JPLMMemoryCodec::encode_light_field(
+      get_encoder_configuration(), get_input());
+  const auto decoded = JPLMMemoryCodec::decode_light_field(
+      bytes.data(), bytes.size(), get_decoder_configuration());
+  auto jpl_filename = (directory / "lightfield.jpl").string();
+  {
+    std::ofstream file(jpl_filename, std::ios::binary);
+    file.write(reinterpret_cast<const char*>(bytes.data()), bytes.size());
+  }
+
+  //always exceeded: only the view being accessed is kept in memory
+  MemoryAccounting::set_budget(1);
+  MemoryAccounting::reset_peaks();
+  const auto initial_images =
+      MemoryAccounting::get_current_bytes(MemoryAccounting::Category::images);
+  const auto budgeted_bytes = JPLMMemoryCodec::encode_light_field(
+      get_encoder_configuration(), get_input());
+  const auto peak_images =
+      MemoryAccounting::get_peak_bytes(MemoryAccounting::Category::images);
+  //decoded views are released to (and loaded again from) the planar file
+  auto output_filename = (directory / "output.plf").string();
+  {
+    auto jpl_file = std::make_shared<JPLFileFromStream>(jpl_filename);
+    const auto& light_field_box = static_cast<const JpegPlenoLightFieldBox&>(
+        *(jpl_file->get_reference_to_codestreams().at(0)));
+    auto decoder = JPLM4DTransformModeLightFieldDecoder<uint16_t>(jpl_file,
+        light_field_box, output_filename, get_decoder_configuration());
+    decoder.run();
+  }
+  MemoryAccounting::set_budget(0);
+
+  EXPECT_EQ(budgeted_bytes, bytes);
+  const auto bytes_per_view = dimension.get_number_of_pixels_per_view() *
+                              number_of_channels * sizeof(uint16_t);
+  //a few views at most (e.g., the accessed one and colour converted copies)
+  EXPECT_LE(peak_images, initial_images + 3 * bytes_per_view);
+
+  auto planar_file = PlanarLightfieldFile(output_filename);
+  auto sample = decoded.samples.begin();
+  for (auto t = std::size_t(0); t < dimension.get_t(); ++t) {
+    for (auto s = std::size_t(0); s < dimension.get_s(); ++s) {
+      auto image = UndefinedImage<uint16_t>(dimension.get_u(),
+          dimension.get_v(), bits_per_sample, number_of_channels);
+      planar_file.read_view(t, s, image);
+      for (auto c = std::size_t(0); c < number_of_channels; ++c) {
+        const auto* channel = image.get_channel(c).data();
+        EXPECT_TRUE(std::equal(channel,
+            channel + dimension.get_number_of_pixels_per_view(), sample));
+        sample += dimension.get_number_of_pixels_per_view();
+      }
+    }
+  }
+}
+
+
+TEST_F(JPLMMemoryCodecTest, RoundTripIsCloseToTheInput) {
+  const auto bytes = JPLMMemoryCodec::encode_light_field(
+      get_encoder_configuration(), get_input());
+  const auto decoded = JPLMMemoryCodec::decode_light_field(
+      bytes.data(), bytes.size(), get_decoder_configuration());
+  ASSERT_EQ(decoded.samples.size(), samples.size());
+  auto squared_error = 0.0;
+  for (auto i = std::size_t(0); i < samples.size(); ++i) {
+    const auto error = static_cast<double>(decoded.samples[i]) - samples[i];
+    squared_error += error * error;
+  }
+  //the encoder estimates a MSE of about 8.5 for this lambda
+  EXPECT_LT(squared_error / samples.size(), 16.0);
+}
+
+
+TEST_F(JPLMMemoryCodecTest, DownscaledDecodingIsCloseToTheAveragedInput) {
+  const auto bytes = JPLMMemoryCodec::encode_light_field(
+      get_encoder_configuration(), get_input());
+  const auto decoded = JPLMMemoryCodec::decode_light_field(bytes.data(),
+      bytes.size(), get_decoder_configuration({"--downscale", "2"}));
+  ASSERT_EQ(decoded.dimension, LightfieldDimension<std::size_t>(3, 2, 10, 12));
+  ASSERT_EQ(decoded.samples.size(), samples.size() / 4);
+
+  auto squared_error = 0.0;
+  auto sample = decoded.samples.begin();
+  for (auto plane = std::size_t(0); plane < 3 * 2 * 3; ++plane) {
+    const auto* input_plane = samples.data() + plane * 20 * 24;
+    for (auto v = 0; v < 10; ++v) {
+      for (auto u = 0; u < 12; ++u) {
+        const auto* input = input_plane + 2 * v * 24 + 2 * u;
+        const auto average =
+            (input[0] + input[1] + input[24] + input[25]) / 4.0;
+        const auto error = *sample++ - average;
+        squared_error += error * error;
+      }
+    }
+  }
+  EXPECT_LT(squared_error / decoded.samples.size(), 32.0);
+}
+
+
+TEST_F(JPLMMemoryCodecTest, ViewsMayAlsoBeDownscaled) {
+  const auto bytes = JPLMMemoryCodec::encode_light_field(
+      get_encoder_configuration(), get_input());
+  const auto decoded = JPLMMemoryCodec::decode_light_field(bytes.data(),
+      bytes.size(),
+      get_decoder_configuration(
+          {"--downscale", "4", "--downscale-views", "2"}));
+  EXPECT_EQ(decoded.dimension, LightfieldDimension<std::size_t>(2, 1, 5, 6));
+}
+
+
+TEST_F(JPLMMemoryCodecTest, ThrowsIfTheDownscaleFactorIsInvalid) {
+  EXPECT_THROW(get_decoder_configuration({"--downscale", "3"}),
+      JPLMConfigurationExceptions::InvalidDownscaleFactorException);
+}
+
+
+TEST_F(JPLMMemoryCodecTest, TruncatedBitPlaneDecodingIsCoarser) {
+  const auto bytes = JPLMMemoryCodec::encode_light_field(
+      get_encoder_configuration(), get_input());
+  auto get_mse = [this, &bytes](const std::string& bit_plane) {
+    const auto decoded = JPLMMemoryCodec::decode_light_field(bytes.data(),
+        bytes.size(),
+        get_decoder_configuration({"--truncate-bit-plane", bit_plane}));
+    auto squared_error = 0.0;
+    for (auto i = std::size_t(0); i < samples.size(); ++i) {
+      const auto error = static_cast<double>(decoded.samples[i]) - samples[i];
+      squared_error += error * error;
+    }
+    return squared_error / samples.size();
+  };
+  const auto full_mse = get_mse("0");
+  const auto truncated_mse = get_mse("12");
+  EXPECT_LT(full_mse, 16.0);
+  EXPECT_GT(truncated_mse, full_mse);
+  //the coarser reconstruction must still be a preview of the input
+  EXPECT_LT(truncated_mse, 400.0);
+}
+
+
+TEST_F(JPLMMemoryCodecTest, NoThumbnailIsInsertedByDefault) {
+  const auto bytes = JPLMMemoryCodec::encode_light_field(
+      get_encoder_configuration(), get_input());
+  auto reader = JPLThumbnailReader(bytes.data(), bytes.size());
+  EXPECT_EQ(reader.read_thumbnail_box(), nullptr);
+}
+
+
+TEST_F(JPLMMemoryCodecTest, ThumbnailIsTheDownscaledCentralView) {
+  const auto bytes = JPLMMemoryCodec::encode_light_field(
+      get_encoder_configuration("", {"--thumbnail-size", "12"}), get_input());
+  auto reader = JPLThumbnailReader(bytes.data(), bytes.size());
+  auto thumbnail_box = reader.read_thumbnail_box();
+  ASSERT_NE(thumbnail_box, nullptr);
+  auto thumbnail = UncompressedThumbnail::get_image(*thumbnail_box);
+  ASSERT_EQ(thumbnail->get_number_of_channels(), number_of_channels);
+  ASSERT_EQ(thumbnail->get_height(), 10);
+  ASSERT_EQ(thumbnail->get_width(), 12);
+  EXPECT_EQ(thumbnail->get_bpp(), bits_per_sample);
+
+  //the central view of the 3x2 views is the view (1, 1)
+  const auto* central_view = samples.data() + 3 * number_of_channels * 20 * 24;
+  for (auto c = std::size_t(0); c < number_of_channels; ++c) {
+    const auto* input_plane = central_view + c * 20 * 24;
+    for (auto v = std::size_t(0); v < 10; ++v) {
+      for (auto u = std::size_t(0); u < 12; ++u) {
+        const auto* input = input_plane + 2 * v * 24 + 2 * u;
+        const auto sum = input[0] + input[1] + input[24] + input[25];
+        EXPECT_EQ(thumbnail->get_value_at(c, v, u), (sum + 2) / 4);
+      }
+    }
+  }
+
+  //the thumbnail does not change the decoding of the light field
+  const auto jpl_file = JPLFileFromStream(bytes.data(), bytes.size());
+  EXPECT_TRUE(jpl_file.has_thumbnail());
+  const auto decoded = JPLMMemoryCodec::decode_light_field(
+      bytes.data(), bytes.size(), get_decoder_configuration());
+  EXPECT_EQ(decoded.dimension, dimension);
+}
+
+
+TEST_F(JPLMMemoryCodecTest, ThumbnailMayBeAMosaicOfAllViews) {
+  const auto bytes = JPLMMemoryCodec::encode_light_field(
+      get_encoder_configuration(
+          "", {"--thumbnail-size", "16", "--thumbnail-mosaic", "true"}),
+      get_input());
+  auto reader = JPLThumbnailReader(bytes.data(), bytes.size());
+  auto thumbnail_box = reader.read_thumbnail_box();
+  ASSERT_NE(thumbnail_box, nullptr);
+  auto thumbnail = UncompressedThumbnail::get_image(*thumbnail_box);
+  //the 60x48 mosaic is downscaled by 4
+  EXPECT_EQ(thumbnail->get_height(), 15);
+  EXPECT_EQ(thumbnail->get_width(), 12);
+  //the first sample averages the top-left 4x4 samples of the view (0, 0)
+  auto sum = 0;
+  for (auto v = 0; v < 4; ++v) {
+    for (auto u = 0; u < 4; ++u) {
+      sum += samples[v * 24 + u];
+    }
+  }
+  EXPECT_EQ(thumbnail->get_value_at(0, 0, 0), (sum + 8) / 16);
+}
+
+
+TEST_F(JPLMMemoryCodecTest, BlockReportHasOneRecordPerBlockAndChannel) {
+  const auto report_path = directory / "blocks.json";
+  const auto bytes = JPLMMemoryCodec::encode_light_field(
+      get_encoder_configuration("", {"--block-report", report_path.string()}),
+      get_input());
+  auto file = std::ifstream(report_path);
+  const auto report = nlohmann::json::parse(file);
+  const auto& blocks = report["blocks"];
+  //2x2 blocks of 16x16 samples (3x2 views) in each of the 3 channels
+  ASSERT_EQ(blocks.size(), 12);
+  auto total_bytes = std::size_t(0);
+  for (const auto& block : blocks) {
+    const auto partition_code = block["partition_code"].get<std::string>();
+    EXPECT_EQ(block["number_of_transform_leaves"].get<std::size_t>(),
+        std::count(partition_code.begin(), partition_code.end(), 'T'));
+    EXPECT_GE(block["number_of_transform_leaves"].get<std::size_t>(), 1);
+    EXPECT_GE(block["estimated_sse"].get<double>(), 0.0);
+    EXPECT_GE(block["encoding_time_ms"].get<double>(), 0.0);
+    total_bytes += block["bytes"].get<std::size_t>();
+  }
+  EXPECT_EQ(blocks[0]["channel"], 0);
+  EXPECT_EQ(blocks[0]["size"], nlohmann::json({3, 2, 16, 16}));
+  EXPECT_LT(total_bytes, bytes.size());
+}
+
+
+TEST_F(JPLMMemoryCodecTest, BlockReportMayBeWrittenAsCSV) {
+  const auto report_path = directory / "blocks.csv";
+  JPLMMemoryCodec::encode_light_field(
+      get_encoder_configuration("", {"--block-report", report_path.string()}),
+      get_input());
+  auto file = std::ifstream(report_path);
+  auto line = std::string();
+  std::getline(file, line);
+  EXPECT_EQ(line.substr(0, 10), "channel,t,");
+  auto number_of_records = 0;
+  while (std::getline(file, line)) {
+    ++number_of_records;
+  }
+  EXPECT_EQ(number_of_records, 12);
+}
+
+
+TEST_F(JPLMMemoryCodecTest, ViewsMayBeProvidedByACallback) {
+  auto number_of_requested_views = std::size_t(0);
+  auto input = std::make_shared<LightfieldMemoryIO<uint16_t>>(dimension,
+      number_of_channels, bits_per_sample,
+      [this, &number_of_requested_views](
+          const auto& position, Image<uint16_t>& image) {
+        ++number_of_requested_views;
+        get_input()->read_view(position, image);
+      });
+  const auto bytes =
+      JPLMMemoryCodec::encode_light_field(get_encoder_configuration(), input);
+  EXPECT_EQ(number_of_requested_views,
+      dimension.get_number_of_views_per_lightfield());
+  EXPECT_EQ(bytes, JPLMMemoryCodec::encode_light_field(
+                       get_encoder_configuration(), get_input()));
+}
+
+
+TEST_F(JPLMMemoryCodecTest, ThrowsIfTheNumberOfChannelsIsInconsistent) {
+  auto input = LightfieldMemoryIO<uint16_t>::from_planar_buffer(
+      samples.data(), dimension, 1, bits_per_sample);
+  EXPECT_THROW(
+      JPLMMemoryCodec::encode_light_field(get_encoder_configuration(), input),
+      JPLMMemoryCodecExceptions::InconsistentNumberOfChannelsException);
+}
+
+
+TEST(CodestreamSinkStreamBuffer, ForwardsAllBytesToTheSink) {
+  auto bytes = std::vector<std::byte>();
+  auto sink = ByteVectorCodestreamSink(bytes);
+  auto expected = std::string();
+  {
+    auto stream_buffer = CodestreamSinkStreamBuffer(sink);
+    auto stream = std::ostream(&stream_buffer);
+    for (auto i = 0; i < 20000; ++i) {
+      auto text = std::to_string(i);
+      stream << text;
+      expected += text;
+    }
+    auto large = std::string(100000, 'x');
+    stream << large;
+    expected += large;
+  }
+  ASSERT_EQ(bytes.size(), expected.size());
+  EXPECT_TRUE(std::equal(bytes.begin(), bytes.end(), expected.begin(),
+      [](auto byte, auto character) {
+        return byte == static_cast<std::byte>(character);
+      }));
+}
+
+
+int main(int argc, char* argv[]) {
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
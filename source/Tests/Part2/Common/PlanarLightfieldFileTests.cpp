@@ -0,0 +1,211 @@
+/* The copyright in this software is being made available under the BSD
+ * License, included below. This software may be subject to other third party
+ * and contributor rights, including patent rights, and no such rights are
+ * granted under this license.
+ *
+ * Copyright (c) 2010-2019, ITU/ISO/IEC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *  * Neither the name of the ITU/ISO/IEC nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** \file     PlanarLightfieldFileTests.cpp
+ *  \brief    Test of the planar light-field container file.
+ *  \details  
+ *  \date     2026-10-19
+ */
+
+#include <filesystem>
+#include <iostream>
+#include "Lib/Part2/Common/LightfieldFromFile.h"
+#include "Lib/Part2/Common/PlanarLightfieldFile.h"
+#include "Lib/Utils/Image/UndefinedImage.h"
+#include "gtest/gtest.h"
+
+
+struct PlanarLightfieldFileTest : public testing::Test {
+ protected:
+  const std::filesystem::path directory;
+  const std::string filename;
+  const LightfieldDimension<std::size_t> dimension;
+
+ public:
+  PlanarLightfieldFileTest()
+      : directory(std::filesystem::temp_directory_path() /
+                  "jplm_planar_lightfield_file_tests"),
+        filename((directory / "lightfield.plf").string()),
+        dimension(2, 3, 5, 7) {
+    std::filesystem::create_directories(directory);
+  }
+
+
+  ~PlanarLightfieldFileTest() {
+    std::filesystem::remove_all(directory);
+  }
+
+
+  static std::unique_ptr<UndefinedImage<uint16_t>> get_view_image(
+      std::size_t t, std::size_t s) {
+    auto image = std::make_unique<UndefinedImage<uint16_t>>(7, 5, 10, 3);
+    for (auto c = 0; c < 3; ++c) {
+      auto* samples = image->get_channel(c).data();
+      for (auto i = 0; i < 35; ++i) {
+        samples[i] = static_cast<uint16_t>((t * 3 + s) * 100 + c * 35 + i);
+      }
+    }
+    return image;
+  }
+};
+
+
+TEST_F(PlanarLightfieldFileTest, CreatedFileHasAlignedPlanes) {
+  auto planar_file = PlanarLightfieldFile(filename, dimension, 3, 10, 64);
+  EXPECT_EQ(planar_file.get_data_offset(), 64);
+  EXPECT_EQ(planar_file.get_plane_stride(), 128);
+  EXPECT_EQ(planar_file.get_plane_offset(1, 2, 1), 64 + (5 * 3 + 1) * 128);
+  EXPECT_EQ(std::filesystem::file_size(filename), 64 + 6 * 3 * 128);
+}
+
+
+TEST_F(PlanarLightfieldFileTest, OpenedFileHasTheCreatedHeader) {
+  PlanarLightfieldFile(filename, dimension, 3, 10, 64);
+  auto planar_file = PlanarLightfieldFile(filename);
+  EXPECT_EQ(planar_file.get_dimension(), dimension);
+  EXPECT_EQ(planar_file.get_number_of_channels(), 3);
+  EXPECT_EQ(planar_file.get_bits_per_sample(), 10);
+  EXPECT_EQ(planar_file.get_plane_alignment(), 64);
+}
+
+
+TEST_F(PlanarLightfieldFileTest, ReadViewGivesTheWrittenView) {
+  auto planar_file = PlanarLightfieldFile(filename, dimension, 3, 10);
+  for (auto t = 0; t < 2; ++t) {
+    for (auto s = 0; s < 3; ++s) {
+      planar_file.write_view(t, s, *get_view_image(t, s));
+    }
+  }
+  auto read_image = UndefinedImage<uint16_t>(7, 5, 10, 3);
+  PlanarLightfieldFile(filename).read_view(1, 2, read_image);
+  EXPECT_EQ(read_image, *get_view_image(1, 2));
+}
+
+
+TEST_F(PlanarLightfieldFileTest, OpenFileWithoutSignatureThrows) {
+  std::ofstream(filename) << "this is not a planar light field file.....";
+  EXPECT_THROW(PlanarLightfieldFile{filename},
+      PlanarLightfieldFileExceptions::InvalidSignatureException);
+}
+
+
+TEST_F(PlanarLightfieldFileTest, InvalidHeaderFieldsThrow) {
+  //the bits per sample and the endianess are the bytes 26 and 27
+  for (const auto& [position, value] :
+      {std::make_pair(26, 0), std::make_pair(26, 17),
+          std::make_pair(27, 2)}) {
+    PlanarLightfieldFile(filename, dimension, 3, 10);
+    {
+      std::fstream file(
+          filename, std::ios::in | std::ios::out | std::ios::binary);
+      file.seekp(position);
+      file.put(static_cast<char>(value));
+    }
+    EXPECT_THROW(PlanarLightfieldFile{filename},
+        PlanarLightfieldFileExceptions::InvalidHeaderException);
+  }
+}
+
+
+TEST_F(PlanarLightfieldFileTest, CreateWithInvalidHeaderFieldsThrows) {
+  EXPECT_THROW(PlanarLightfieldFile(filename, dimension, 3, 0),
+      PlanarLightfieldFileExceptions::InvalidBitsPerSampleException);
+  EXPECT_THROW(PlanarLightfieldFile(filename, dimension, 3, 17),
+      PlanarLightfieldFileExceptions::InvalidBitsPerSampleException);
+  EXPECT_THROW(PlanarLightfieldFile(filename, dimension, 0, 10),
+      PlanarLightfieldFileExceptions::InvalidNumberOfChannelsException);
+  EXPECT_THROW(PlanarLightfieldFile(filename, dimension, 65536, 10),
+      PlanarLightfieldFileExceptions::InvalidNumberOfChannelsException);
+  EXPECT_FALSE(std::filesystem::exists(filename));
+}
+
+
+TEST_F(PlanarLightfieldFileTest, ViewOfAnotherSizeThrows) {
+  auto planar_file = PlanarLightfieldFile(filename, dimension, 3, 10);
+  auto smaller_image = UndefinedImage<uint16_t>(7, 4, 10, 3);
+  EXPECT_THROW(planar_file.read_view(0, 0, smaller_image),
+      PlanarLightfieldFileExceptions::WrongViewSizeException);
+  EXPECT_THROW(planar_file.write_view(0, 0, smaller_image),
+      PlanarLightfieldFileExceptions::WrongViewSizeException);
+  auto narrower_image = UndefinedImage<uint16_t>(6, 5, 10, 3);
+  EXPECT_THROW(planar_file.write_view(0, 0, narrower_image),
+      PlanarLightfieldFileExceptions::WrongViewSizeException);
+}
+
+
+TEST_F(PlanarLightfieldFileTest, WriteViewToMissingFileThrows) {
+  auto planar_file = PlanarLightfieldFile(filename, dimension, 3, 10);
+  std::filesystem::remove(filename);
+  EXPECT_THROW(planar_file.write_view(0, 0, *get_view_image(0, 0)),
+      PlanarLightfieldFileExceptions::UnableToOpenFileException);
+}
+
+
+TEST_F(PlanarLightfieldFileTest, InvalidViewPositionThrows) {
+  auto planar_file = PlanarLightfieldFile(filename, dimension, 3, 10);
+  EXPECT_THROW(planar_file.get_plane_offset(2, 0, 0),
+      PlanarLightfieldFileExceptions::ViewOutOfBoundsException);
+}
+
+
+TEST_F(PlanarLightfieldFileTest, LightfieldFromFileReadsViewsFromPlanarFile) {
+  auto planar_file = PlanarLightfieldFile(filename, dimension, 3, 10);
+  for (auto t = 0; t < 2; ++t) {
+    for (auto s = 0; s < 3; ++s) {
+      planar_file.write_view(t, s, *get_view_image(t, s));
+    }
+  }
+  auto lightfield =
+      LightfieldFromFile<uint16_t>(LightfieldIOConfiguration(filename, dimension));
+  EXPECT_EQ(lightfield.get_views_width_u(), 7);
+  EXPECT_EQ(lightfield.get_views_height_v(), 5);
+  auto image = lightfield.get_image_at<UndefinedImage>({1, 1});
+  EXPECT_EQ(image, *get_view_image(1, 1));
+}
+
+
+TEST_F(PlanarLightfieldFileTest, PreloadViewsLoadsViewsConcurrently) {
+  auto planar_file = PlanarLightfieldFile(filename, dimension, 3, 10);
+  for (auto t = 0; t < 2; ++t) {
+    for (auto s = 0; s < 3; ++s) {
+      planar_file.write_view(t, s, *get_view_image(t, s));
+    }
+  }
+  auto lightfield =
+      LightfieldFromFile<uint16_t>(LightfieldIOConfiguration(filename, dimension));
+  lightfield.preload_views({{0, 0}, {0, 1}, {0, 2}, {1, 0}, {1, 1}}, 3);
+  EXPECT_TRUE(lightfield.get_view_at({1, 1}).has_image());
+  EXPECT_FALSE(lightfield.get_view_at({1, 2}).has_image());
+  auto image = lightfield.get_image_at<UndefinedImage>({0, 2});
+  EXPECT_EQ(image, *get_view_image(0, 2));
+}
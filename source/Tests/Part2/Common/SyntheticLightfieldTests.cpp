@@ -0,0 +1,201 @@
+/* The copyright in this software is being made available under the BSD
+ * License, included below. This software may be subject to other third party
+ * and contributor rights, including patent rights, and no such rights are
+ * granted under this license.
+ *
+ * Copyright (c) 2010-2019, ITU/ISO/IEC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *  * Neither the name of the ITU/ISO/IEC nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** \file     SyntheticLightfieldTests.cpp
+ *  \brief    Test of the synthetic light-field generator.
+ *  \details  
+ *  \date     2026-10-19
+ */
+
+#include <iostream>
+#include "Lib/Part2/Common/LightfieldFromFile.h"
+#include "Lib/Part2/Common/SyntheticLightfield.h"
+#include "Lib/Utils/Image/UndefinedImage.h"
+#include "gtest/gtest.h"
+
+
+namespace {
+
+SyntheticLightfieldParameters get_parameters(
+    SyntheticLightfieldContent content) {
+  auto parameters = SyntheticLightfieldParameters{{3, 4, 24, 32}};
+  parameters.content = content;
+  return parameters;
+}
+
+}  // namespace
+
+
+TEST(SyntheticLightfieldTest, SameParametersGiveTheSameLightField) {
+  const auto parameters = get_parameters(SyntheticLightfieldContent::planes);
+  EXPECT_EQ(SyntheticLightfield(parameters).get_planar_samples(),
+      SyntheticLightfield(parameters).get_planar_samples());
+}
+
+
+TEST(SyntheticLightfieldTest, SeedChangesTheLightField) {
+  auto parameters = get_parameters(SyntheticLightfieldContent::planes);
+  const auto samples = SyntheticLightfield(parameters).get_planar_samples();
+  parameters.seed = 1;
+  EXPECT_NE(samples, SyntheticLightfield(parameters).get_planar_samples());
+}
+
+
+TEST(SyntheticLightfieldTest, SamplesAreWithinTheBitDepth) {
+  for (auto content :
+      {SyntheticLightfieldContent::flat, SyntheticLightfieldContent::gradient,
+          SyntheticLightfieldContent::noise,
+          SyntheticLightfieldContent::texture,
+          SyntheticLightfieldContent::planes}) {
+    auto parameters = get_parameters(content);
+    parameters.bits_per_sample = 6;
+    parameters.noise_amplitude = 0.5;
+    for (auto sample : SyntheticLightfield(parameters).get_planar_samples()) {
+      EXPECT_LT(sample, 64);
+    }
+  }
+}
+
+
+TEST(SyntheticLightfieldTest, PlanarSamplesHaveTheLightFieldSize) {
+  auto parameters = get_parameters(SyntheticLightfieldContent::gradient);
+  parameters.number_of_channels = 2;
+  EXPECT_EQ(SyntheticLightfield(parameters).get_planar_samples().size(),
+      3 * 4 * 2 * 24 * 32);
+}
+
+
+TEST(SyntheticLightfieldTest, FlatContentIsConstantWithoutNoise) {
+  auto parameters = get_parameters(SyntheticLightfieldContent::flat);
+  parameters.noise_amplitude = 0.0;
+  const auto generator = SyntheticLightfield(parameters);
+  const auto value = generator.get_sample(0, 0, 1, 0, 0);
+  EXPECT_EQ(generator.get_sample(2, 3, 1, 23, 31), value);
+  EXPECT_EQ(generator.get_sample(1, 2, 1, 10, 5), value);
+}
+
+
+TEST(SyntheticLightfieldTest, TextureIsDisplacedByTheDisparity) {
+  auto parameters = get_parameters(SyntheticLightfieldContent::texture);
+  parameters.disparities = {2.0};
+  parameters.noise_amplitude = 0.0;
+  const auto generator = SyntheticLightfield(parameters);
+  for (auto v = std::size_t(0); v < 20; ++v) {
+    for (auto u = std::size_t(2); u < 32; ++u) {
+      EXPECT_EQ(generator.get_sample(1, 1, 0, v, u),
+          generator.get_sample(1, 2, 0, v, u - 2));
+      EXPECT_EQ(generator.get_sample(0, 1, 2, v + 2, u),
+          generator.get_sample(1, 1, 2, v, u));
+    }
+  }
+}
+
+
+TEST(SyntheticLightfieldTest, NoiseChangesBetweenViews) {
+  const auto generator =
+      SyntheticLightfield(get_parameters(SyntheticLightfieldContent::noise));
+  auto number_of_equal_samples = 0;
+  for (auto u = std::size_t(0); u < 32; ++u) {
+    number_of_equal_samples += generator.get_sample(0, 0, 0, 0, u) ==
+                               generator.get_sample(0, 1, 0, 0, u);
+  }
+  EXPECT_LT(number_of_equal_samples, 4);
+}
+
+
+TEST(SyntheticLightfieldTest, ViewsAreEqualToTheSamples) {
+  const auto generator =
+      SyntheticLightfield(get_parameters(SyntheticLightfieldContent::planes));
+  auto image = UndefinedImage<uint16_t>(32, 24, 10, 3);
+  generator.fill_view({2, 1}, image);
+  for (auto c = 0; c < 3; ++c) {
+    const auto* samples = image.get_channel(c).data();
+    for (auto v = std::size_t(0); v < 24; ++v) {
+      for (auto u = std::size_t(0); u < 32; ++u) {
+        EXPECT_EQ(samples[v * 32 + u], generator.get_sample(2, 1, c, v, u));
+      }
+    }
+  }
+}
+
+
+TEST(SyntheticLightfieldTest, MemoryIOGivesTheGeneratedViews) {
+  const auto generator =
+      SyntheticLightfield(get_parameters(SyntheticLightfieldContent::planes));
+  auto expected = UndefinedImage<uint16_t>(32, 24, 10, 3);
+  generator.fill_view({1, 3}, expected);
+
+  auto lightfield = LightfieldFromFile<uint16_t>(generator.get_memory_io());
+  auto image = lightfield.get_image_at<UndefinedImage>({1, 3});
+  EXPECT_EQ(image, expected);
+}
+
+
+TEST(SyntheticLightfieldTest, InvalidBitsPerSampleThrows) {
+  auto parameters = get_parameters(SyntheticLightfieldContent::flat);
+  parameters.bits_per_sample = 17;
+  EXPECT_THROW(SyntheticLightfield{parameters},
+      SyntheticLightfieldExceptions::InvalidBitsPerSampleException);
+  parameters.bits_per_sample = 0;
+  EXPECT_THROW(SyntheticLightfield{parameters},
+      SyntheticLightfieldExceptions::InvalidBitsPerSampleException);
+}
+
+
+TEST(SyntheticLightfieldTest, PlanesWithoutDisparitiesThrows) {
+  auto parameters = get_parameters(SyntheticLightfieldContent::planes);
+  parameters.disparities.clear();
+  EXPECT_THROW(SyntheticLightfield{parameters},
+      SyntheticLightfieldExceptions::MissingDisparitiesException);
+}
+
+
+TEST(SyntheticLightfieldTest, ContentIsObtainedFromItsName) {
+  EXPECT_EQ(get_synthetic_lightfield_content("noise"),
+      SyntheticLightfieldContent::noise);
+  EXPECT_EQ(get_synthetic_lightfield_content("planes"),
+      SyntheticLightfieldContent::planes);
+  EXPECT_THROW(get_synthetic_lightfield_content("stripes"),
+      SyntheticLightfieldExceptions::UnknownContentException);
+}
+
+
+TEST(SyntheticLightfieldTest, DisparitiesAreObtainedFromAList) {
+  EXPECT_EQ(get_synthetic_lightfield_disparities("-1,0.5, 2"),
+      std::vector<double>({-1.0, 0.5, 2.0}));
+  EXPECT_TRUE(get_synthetic_lightfield_disparities("").empty());
+  EXPECT_THROW(get_synthetic_lightfield_disparities("1,a"),
+      SyntheticLightfieldExceptions::InvalidDisparitiesException);
+  EXPECT_THROW(get_synthetic_lightfield_disparities("1,2x"),
+      SyntheticLightfieldExceptions::InvalidDisparitiesException);
+}
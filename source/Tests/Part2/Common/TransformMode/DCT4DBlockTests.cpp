@@ -0,0 +1,261 @@
+/* The copyright in this software is being made available under the BSD
+ * License, included below. This software may be subject to other third party
+ * and contributor rights, including patent rights, and no such rights are
+ * granted under this license.
+ *
+ * Copyright (c) 2010-2019, ITU/ISO/IEC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *  * Neither the name of the ITU/ISO/IEC nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** \file     DCT4DBlockTests.cpp
+ *  \brief    Tests of the inverse 4D DCT restricted to significant regions.
+ *  \details
+ *  \date     2026-10-19
+ */
+
+#include <iostream>
+#include <random>
+#include "Lib/Part2/Common/TransformMode/DCT4DBlock.h"
+#include "Lib/Part2/Common/TransformMode/SignificanceBoundingBox.h"
+#include "gtest/gtest.h"
+
+
+struct SparseInverseDCT4DTests : testing::Test {
+ protected:
+  static constexpr uint32_t length_t = 5;
+  static constexpr uint32_t length_s = 4;
+  static constexpr uint32_t length_v = 9;
+  static constexpr uint32_t length_u = 13;
+  const DCT4DCoefficientsRegistry registry = DCT4DCoefficientsRegistry(
+      {length_t, length_s, length_v, length_u}, {1.0, 1.0, 1.0, 1.0});
+  Block4D coefficients;
+  SignificanceBoundingBox significant_region;
+  std::mt19937 generator{42};
+
+  SparseInverseDCT4DTests() {
+    coefficients.set_dimension(length_t, length_s, length_v, length_u);
+    coefficients.fill_with_zeros();
+  }
+
+
+  void set_coefficient(uint32_t t, uint32_t s, uint32_t v, uint32_t u) {
+    auto distribution = std::uniform_int_distribution<int>(-2048, 2048);
+    auto value = distribution(generator);
+    if (value == 0) {
+      value = 1;
+    }
+    coefficients.mPixel[t][s][v][u] = value;
+    significant_region.add(t, s, v, u);
+  }
+
+
+  Block4D get_copy_of_coefficients() const {
+    Block4D copy;
+    copy = coefficients;
+    return copy;
+  }
+
+
+  void expect_same_as_the_dense_inverse() {
+    auto dense = DCT4DBlock(get_copy_of_coefficients()).inverse(registry);
+    auto sparse =
+        DCT4DBlock(get_copy_of_coefficients())
+            .inverse(registry, significant_region);
+    ASSERT_EQ(sparse.get_number_of_elements(), dense.get_number_of_elements());
+    for (auto i = std::size_t{0}; i < dense.get_number_of_elements(); ++i) {
+      ASSERT_EQ(sparse.mPixelData[i], dense.mPixelData[i]) << "at " << i;
+    }
+  }
+};
+
+
+TEST(SignificanceBoundingBoxTests, StartsEmpty) {
+  auto box = SignificanceBoundingBox();
+  EXPECT_TRUE(box.is_empty());
+  EXPECT_FALSE(box.has_only_dc());
+}
+
+
+TEST(SignificanceBoundingBoxTests, GrowsToContainTheAddedPositions) {
+  auto box = SignificanceBoundingBox();
+  box.add(1, 2, 3, 4);
+  box.add(3, 0, 5, 4);
+  EXPECT_FALSE(box.is_empty());
+  EXPECT_EQ(box.get_begin(LightFieldDimension::T), 1);
+  EXPECT_EQ(box.get_end(LightFieldDimension::T), 4);
+  EXPECT_EQ(box.get_begin(LightFieldDimension::S), 0);
+  EXPECT_EQ(box.get_end(LightFieldDimension::S), 3);
+  EXPECT_EQ(box.get_begin(LightFieldDimension::V), 3);
+  EXPECT_EQ(box.get_end(LightFieldDimension::V), 6);
+  EXPECT_EQ(box.get_begin(LightFieldDimension::U), 4);
+  EXPECT_EQ(box.get_end(LightFieldDimension::U), 5);
+}
+
+
+TEST(SignificanceBoundingBoxTests, OnlyDCIsDetected) {
+  auto box = SignificanceBoundingBox();
+  box.add(0, 0, 0, 0);
+  EXPECT_TRUE(box.has_only_dc());
+  box.add(0, 0, 0, 1);
+  EXPECT_FALSE(box.has_only_dc());
+}
+
+
+TEST_F(SparseInverseDCT4DTests, EmptyRegionGivesAZeroBlock) {
+  auto block =
+      DCT4DBlock(get_copy_of_coefficients())
+            .inverse(registry, significant_region);
+  for (auto i = std::size_t{0}; i < block.get_number_of_elements(); ++i) {
+    EXPECT_EQ(block.mPixelData[i], 0);
+  }
+}
+
+
+TEST_F(SparseInverseDCT4DTests, DCOnlyIsEqualToTheDenseInverse) {
+  set_coefficient(0, 0, 0, 0);
+  expect_same_as_the_dense_inverse();
+}
+
+
+TEST_F(SparseInverseDCT4DTests, LowFrequencyCornerIsEqualToTheDenseInverse) {
+  for (auto t = 0; t < 2; ++t) {
+    for (auto s = 0; s < 2; ++s) {
+      for (auto v = 0; v < 3; ++v) {
+        for (auto u = 0; u < 4; ++u) {
+          set_coefficient(t, s, v, u);
+        }
+      }
+    }
+  }
+  expect_same_as_the_dense_inverse();
+}
+
+
+TEST_F(SparseInverseDCT4DTests, ScatteredCoefficientsAreEqualToDenseInverse) {
+  set_coefficient(1, 3, 2, 7);
+  set_coefficient(4, 1, 8, 12);
+  set_coefficient(2, 2, 5, 3);
+  expect_same_as_the_dense_inverse();
+}
+
+
+int main(int argc, char *argv[]) {
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
+
+
+TEST(DCT4DCoefficientsRegistryTests, HasTheSizesOfThePartitions) {
+  //5 is the length of a block truncated at a border
+  const auto registry =
+      DCT4DCoefficientsRegistry({3, 2, 9, 13}, {1, 1, 1, 1}, {5});
+  EXPECT_EQ(registry.get_maximal_size(), 13);
+  for (const auto size : {1, 2, 3, 4, 5, 6, 7, 9, 13}) {
+    //the first row of the forward transform computes the DC
+    EXPECT_EQ(registry.get_forward_coefficients_for_size(size)[size - 1], 1.0);
+    EXPECT_DOUBLE_EQ(registry.get_inverse_coefficients_for_size(size)[0],
+        1.0 / static_cast<double>(size));
+  }
+  for (const auto size : {8, 10, 11, 12}) {
+    EXPECT_FALSE(registry.has_size(size));
+    EXPECT_THROW(registry.get_forward_coefficients_for_size(size),
+        DCT4DCoefficientsExceptions::SizeOutOfTheRegistryException);
+  }
+}
+
+
+TEST(DCT4DCoefficientsRegistryTests, GeneratedInverseEqualsTheRegistryOne) {
+  const auto registry = DCT4DCoefficientsRegistry({1, 1, 7, 7}, {1, 1, 1, 1});
+  const auto* expected = registry.get_inverse_coefficients_for_size(7);
+  auto coefficients = std::vector<double>(49);
+  DCT4DCoefficientsRegistry::generate_inverse_coefficients(
+      7, coefficients.data());
+  for (auto i = std::size_t{0}; i < coefficients.size(); ++i) {
+    EXPECT_EQ(coefficients[i], expected[i]);
+  }
+}
+
+
+TEST(DCT4DCoefficientsRegistryTests, TooLargeSizesThrow) {
+  EXPECT_THROW(DCT4DCoefficientsRegistry({1, 1, 8, UINT32_MAX}, {1, 1, 1, 1}),
+      DCT4DCoefficientsExceptions::UnsupportedTransformSizeException);
+}
+
+
+TEST(DCT4DCoefficientsRegistryTests, WeightsScaleWithTheMaximalSize) {
+  const auto registry =
+      DCT4DCoefficientsRegistry({4, 4, 16, 16}, {1.0, 2.0, 1.0, 1.0});
+  EXPECT_DOUBLE_EQ(
+      registry.get_weight_for_size_in_dimension(4, LightFieldDimensions::T),
+      1.0);
+  EXPECT_DOUBLE_EQ(
+      registry.get_weight_for_size_in_dimension(4, LightFieldDimensions::S),
+      2.0);
+  EXPECT_DOUBLE_EQ(
+      registry.get_weight_for_size_in_dimension(4, LightFieldDimensions::U),
+      2.0);
+}
+
+
+TEST(DCT4DCoefficientsRegistryTests, SizesOutOfTheRegistryThrow) {
+  const auto registry = DCT4DCoefficientsRegistry({1, 1, 8, 8}, {1, 1, 1, 1});
+  EXPECT_THROW(registry.get_forward_coefficients_for_size(9),
+      DCT4DCoefficientsExceptions::SizeOutOfTheRegistryException);
+  EXPECT_THROW(registry.get_inverse_coefficients_for_size(0),
+      DCT4DCoefficientsExceptions::SizeOutOfTheRegistryException);
+}
+
+
+TEST_F(SparseInverseDCT4DTests, ForwardThenInverseGivesBackTheBlock) {
+  auto distribution = std::uniform_int_distribution<int>(0, 1023);
+  auto block = get_copy_of_coefficients();
+  for (auto i = std::size_t{0}; i < block.get_number_of_elements(); ++i) {
+    block.mPixelData[i] = distribution(generator);
+  }
+  auto reconstructed = DCT4DBlock(block, registry).inverse(registry);
+  for (auto i = std::size_t{0}; i < block.get_number_of_elements(); ++i) {
+    EXPECT_NEAR(reconstructed.mPixelData[i], block.mPixelData[i], 1)
+        << "at " << i;
+  }
+}
+
+
+TEST_F(SparseInverseDCT4DTests, SinglePrecisionForwardIsCloseToTheDoubleOne) {
+  auto distribution = std::uniform_int_distribution<int>(0, 1023);
+  auto block = get_copy_of_coefficients();
+  for (auto i = std::size_t{0}; i < block.get_number_of_elements(); ++i) {
+    block.mPixelData[i] = distribution(generator);
+  }
+  const auto reference = DCT4DBlock(block, registry).generate_copy_in_block();
+  const auto approximation =
+      DCT4DBlock(block, registry, TransformPrecision::single_precision)
+          .generate_copy_in_block();
+  for (auto i = std::size_t{0}; i < block.get_number_of_elements(); ++i) {
+    EXPECT_NEAR(approximation.mPixelData[i], reference.mPixelData[i], 1)
+        << "at " << i;
+  }
+}
@@ -0,0 +1,148 @@
+/* The copyright in this software is being made available under the BSD
+ * License, included below. This software may be subject to other third party
+ * and contributor rights, including patent rights, and no such rights are
+ * granted under this license.
+ *
+ * Copyright (c) 2010-2019, ITU/ISO/IEC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *  * Neither the name of the ITU/ISO/IEC nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** \file     LightFieldTransformModeTests.cpp
+ *  \brief    Tests of the 4D block gather/scatter of LightFieldTransformMode.
+ *  \details
+ *  \date     2026-10-19
+ */
+
+#include <filesystem>
+#include <iostream>
+#include "Lib/Part2/Common/TransformMode/LightFieldTransformMode.h"
+#include "gtest/gtest.h"
+
+
+struct LightFieldTransformModeBlocksTests : testing::Test {
+ protected:
+  const std::string path =
+      (std::filesystem::temp_directory_path() / "jplm_lf_transform_mode_tests")
+          .string();
+  std::unique_ptr<LightFieldTransformMode<uint16_t>> lightfield;
+
+  LightFieldTransformModeBlocksTests() {
+    std::filesystem::create_directories(path);
+    lightfield = std::make_unique<LightFieldTransformMode<uint16_t>>(
+        LightfieldIOConfiguration(path, {2, 3, 5, 7}), 1, 10);
+    for (auto t = 0; t < 2; ++t) {
+      for (auto s = 0; s < 3; ++s) {
+        auto& channel = lightfield->get_image_at({t, s}).get_channel(0);
+        for (auto v = 0; v < 5; ++v) {
+          for (auto u = 0; u < 7; ++u) {
+            channel[v][u] = (t * 3 + s) * 35 + v * 7 + u;
+          }
+        }
+      }
+    }
+  }
+
+
+  ~LightFieldTransformModeBlocksTests() {
+    lightfield.reset();
+    std::filesystem::remove_all(path);
+  }
+};
+
+
+TEST_F(LightFieldTransformModeBlocksTests, GatherAppliesLevelShift) {
+  auto block =
+      lightfield->get_block_4D_from(0, {0, 1, 1, 2}, {2, 2, 3, 4}, -512);
+  for (auto t = 0; t < 2; ++t) {
+    for (auto s = 0; s < 2; ++s) {
+      for (auto v = 0; v < 3; ++v) {
+        for (auto u = 0; u < 4; ++u) {
+          EXPECT_EQ(block.get_pixel_at(t, s, v, u),
+              (t * 3 + s + 1) * 35 + (v + 1) * 7 + (u + 2) - 512);
+        }
+      }
+    }
+  }
+}
+
+
+TEST_F(LightFieldTransformModeBlocksTests, GatherFillsOutsideWithLevelShift) {
+  auto block =
+      lightfield->get_block_4D_from(0, {1, 2, 3, 5}, {2, 2, 4, 4}, -512);
+  for (auto t = 0; t < 2; ++t) {
+    for (auto s = 0; s < 2; ++s) {
+      for (auto v = 0; v < 4; ++v) {
+        for (auto u = 0; u < 4; ++u) {
+          auto expected = -512;
+          if (t == 0 && s == 0 && v < 2 && u < 2) {
+            expected += 5 * 35 + (v + 3) * 7 + (u + 5);
+          }
+          EXPECT_EQ(block.get_pixel_at(t, s, v, u), expected);
+        }
+      }
+    }
+  }
+}
+
+
+TEST_F(LightFieldTransformModeBlocksTests, ScatterAppliesLevelShiftAndClip) {
+  auto block = Block4D({2, 3, 5, 7});
+  for (auto i = decltype(block.get_number_of_elements()){0};
+       i < block.get_number_of_elements(); ++i) {
+    block.mPixelData[i] = static_cast<int>(i) * 8 - 600;
+  }
+  lightfield->set_block_4D_at(block, 0, {0, 0, 0, 0}, 512, 0, 1023);
+  auto i = 0;
+  for (auto t = 0; t < 2; ++t) {
+    for (auto s = 0; s < 3; ++s) {
+      const auto& channel = lightfield->get_image_at({t, s}).get_channel(0);
+      for (auto v = 0; v < 5; ++v) {
+        for (auto u = 0; u < 7; ++u) {
+          EXPECT_EQ(channel[v][u], std::clamp(i++ * 8 - 600 + 512, 0, 1023));
+        }
+      }
+    }
+  }
+}
+
+
+TEST_F(LightFieldTransformModeBlocksTests, ScatterDiscardsOutsideSamples) {
+  auto block = Block4D({2, 2, 4, 4});
+  block.fill_with_zeros();
+  lightfield->set_block_4D_at(block, 0, {1, 2, 3, 5}, 1, 0, 1023);
+  const auto& channel = lightfield->get_image_at({1, 2}).get_channel(0);
+  EXPECT_EQ(channel[3][5], 1);
+  EXPECT_EQ(channel[4][6], 1);
+  EXPECT_EQ(channel[2][5], 5 * 35 + 2 * 7 + 5);
+  EXPECT_EQ(channel[3][4], 5 * 35 + 3 * 7 + 4);
+}
+
+
+int main(int argc, char *argv[]) {
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
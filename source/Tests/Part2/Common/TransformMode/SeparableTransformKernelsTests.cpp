@@ -0,0 +1,133 @@
+/* The copyright in this software is being made available under the BSD
+ * License, included below. This software may be subject to other third party
+ * and contributor rights, including patent rights, and no such rights are
+ * granted under this license.
+ *
+ * Copyright (c) 2010-2019, ITU/ISO/IEC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *  * Neither the name of the ITU/ISO/IEC nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** \file     SeparableTransformKernelsTests.cpp
+ *  \brief    Test of the 1D transform kernels specialized by length.
+ *  \details  
+ *  \date     2026-10-19
+ */
+
+#include <numeric>
+#include <random>
+#include <vector>
+#include "Lib/Part2/Common/TransformMode/DCT4DCoefficientsRegistry.h"
+#include "Lib/Part2/Common/TransformMode/SeparableTransformKernels.h"
+#include "gtest/gtest.h"
+
+
+namespace {
+
+/**
+ * \brief Transforms the columns of a (length x number_of_columns) matrix as
+ *        the generic path does
+ */
+std::vector<double> transform_columns(const std::vector<double>& values,
+    const double* coefficients, double weight, std::size_t length,
+    std::size_t number_of_columns) {
+  auto transformed = std::vector<double>(values.size());
+  auto column = std::vector<double>(length);
+  for (auto c = std::size_t{0}; c < number_of_columns; ++c) {
+    for (auto k = std::size_t{0}; k < length; ++k) {
+      column[k] = values[k * number_of_columns + c];
+    }
+    for (auto d = std::size_t{0}; d < length; ++d) {
+      transformed[d * number_of_columns + c] =
+          weight * std::inner_product(column.begin(), column.end(),
+                       coefficients + d * length, 0.0);
+    }
+  }
+  return transformed;
+}
+
+}  // namespace
+
+
+TEST(SeparableTransformKernelsTests, ThereAreKernelsForTheCommonLengths) {
+  EXPECT_EQ(SeparableTransformKernels::get_kernel(0), nullptr);
+  for (auto length = std::size_t{1};
+       length <= SeparableTransformKernels::maximal_specialized_length;
+       ++length) {
+    EXPECT_NE(SeparableTransformKernels::get_kernel(length), nullptr);
+  }
+  EXPECT_EQ(SeparableTransformKernels::get_kernel(
+                SeparableTransformKernels::maximal_specialized_length + 1),
+      nullptr);
+}
+
+
+TEST(SeparableTransformKernelsTests, KernelsEqualTheGenericTransform) {
+  constexpr auto maximal_length =
+      SeparableTransformKernels::maximal_specialized_length;
+  auto generator = std::mt19937(42);
+  auto distribution = std::uniform_real_distribution<double>(-512.0, 512.0);
+  constexpr auto number_of_columns = std::size_t{3};
+  for (auto length = std::size_t{1}; length <= maximal_length; ++length) {
+    auto values = std::vector<double>(length * number_of_columns);
+    for (auto& value : values) {
+      value = distribution(generator);
+    }
+    const auto registry = DCT4DCoefficientsRegistry(
+        {1, 1, 1, static_cast<uint32_t>(length)}, {1.0, 1.0, 1.0, 1.0});
+    const auto* coefficients =
+        registry.get_forward_coefficients_for_size(length);
+    const auto expected =
+        transform_columns(values, coefficients, 0.5, length, number_of_columns);
+
+    //in place, as done by the 4D transform
+    SeparableTransformKernels::get_kernel(length)(values.data(), values.data(),
+        0.5, coefficients, {0, 1}, {0, 1}, {0, number_of_columns}, 0, 0, 1,
+        number_of_columns);
+    for (auto i = std::size_t{0}; i < values.size(); ++i) {
+      EXPECT_EQ(values[i], expected[i])
+          << "length " << length << " at " << i;
+    }
+  }
+}
+
+
+TEST(SeparableTransformKernelsTests, LinesOutOfTheRangesAreUntouched) {
+  constexpr auto length = std::size_t{4};
+  const auto registry =
+      DCT4DCoefficientsRegistry({1, 1, length, length}, {1.0, 1.0, 1.0, 1.0});
+  auto values = std::vector<double>(length * length, 1.0);
+  //transforms only the columns 1 and 2
+  SeparableTransformKernels::get_kernel(length)(values.data(), values.data(),
+      1.0, registry.get_forward_coefficients_for_size(length), {0, 1}, {0, 1},
+      {1, 3}, 0, 0, 1, length);
+  for (auto k = std::size_t{0}; k < length; ++k) {
+    EXPECT_EQ(values[k * length], 1.0);
+    EXPECT_EQ(values[k * length + 3], 1.0);
+  }
+  EXPECT_DOUBLE_EQ(values[1], static_cast<double>(length));
+  EXPECT_NEAR(values[length + 1], 0.0, 1e-12);
+}
@@ -0,0 +1,175 @@
+/* The copyright in this software is being made available under the BSD
+ * License, included below. This software may be subject to other third party
+ * and contributor rights, including patent rights, and no such rights are
+ * granted under this license.
+ *
+ * Copyright (c) 2010-2019, ITU/ISO/IEC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *  * Neither the name of the ITU/ISO/IEC nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** \file     EncodingCheckpointTests.cpp
+ *  \brief    Tests of the checkpoints of an encoding
+ *  \details
+ *  \date     2026-10-19
+ */
+
+#include <cstring>
+#include <filesystem>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include "Lib/Common/Boxes/Generic/ContiguousCodestreamCodeInMemory.h"
+#include "Lib/Part2/Encoder/TransformMode/CommonExceptions.h"
+#include "Lib/Part2/Encoder/TransformMode/EncodingCheckpoint.h"
+#include "gtest/gtest.h"
+
+
+std::string resources_path = "../resources";
+
+
+namespace {
+
+const auto codestream_bytes =
+    std::vector<std::byte>{std::byte{0xFF}, std::byte{0x10}, std::byte{0x00}};
+
+
+EncodingCheckpoint get_checkpoint() {
+  auto checkpoint = EncodingCheckpoint();
+  checkpoint.number_of_encoded_blocks = 2;
+  for (const auto lambda : {100.0, 1234.5}) {
+    auto state = EncodingCheckpoint::EncodingState();
+    state.lambda = lambda;
+    state.sse_per_channel = {1.5, 0.25 * lambda};
+    state.bytes_per_channel = {100, 5000000000};
+    state.byte_index_for_pnt = {0, 123};
+    checkpoint.encodings.push_back(state);
+  }
+  return checkpoint;
+}
+
+
+std::vector<const ContiguousCodestreamCode*> get_codestreams() {
+  static const auto codestream =
+      ContiguousCodestreamCodeInMemory(codestream_bytes);
+  return {&codestream, &codestream};
+}
+
+
+std::vector<std::byte> get_bytes(const EncodingCheckpoint& checkpoint) {
+  auto stream = std::ostringstream();
+  checkpoint.write_to(stream, get_codestreams());
+  const auto string = stream.str();
+  auto bytes = std::vector<std::byte>(string.size());
+  std::memcpy(bytes.data(), string.data(), string.size());
+  return bytes;
+}
+
+
+void expect_equal(
+    const EncodingCheckpoint& expected, const EncodingCheckpoint& actual) {
+  EXPECT_EQ(
+      expected.number_of_encoded_blocks, actual.number_of_encoded_blocks);
+  ASSERT_EQ(expected.encodings.size(), actual.encodings.size());
+  for (auto i = std::size_t(0); i < expected.encodings.size(); ++i) {
+    const auto& expected_state = expected.encodings[i];
+    const auto& actual_state = actual.encodings[i];
+    EXPECT_EQ(expected_state.lambda, actual_state.lambda);
+    EXPECT_EQ(expected_state.sse_per_channel, actual_state.sse_per_channel);
+    EXPECT_EQ(
+        expected_state.bytes_per_channel, actual_state.bytes_per_channel);
+    EXPECT_EQ(
+        expected_state.byte_index_for_pnt, actual_state.byte_index_for_pnt);
+    EXPECT_EQ(codestream_bytes, actual_state.codestream);
+  }
+}
+
+}  // namespace
+
+
+TEST(EncodingCheckpointTest, BytesRoundTrip) {
+  const auto checkpoint = get_checkpoint();
+  expect_equal(
+      checkpoint, EncodingCheckpoint::from_bytes(get_bytes(checkpoint)));
+}
+
+
+TEST(EncodingCheckpointTest, FileRoundTrip) {
+  const auto path =
+      std::filesystem::temp_directory_path() / "jplm_checkpoint_test";
+  const auto checkpoint = get_checkpoint();
+  checkpoint.write(path, get_codestreams());
+  const auto read_checkpoint = EncodingCheckpoint::read(path);
+  std::filesystem::remove(path);
+  ASSERT_TRUE(read_checkpoint);
+  expect_equal(checkpoint, *read_checkpoint);
+}
+
+
+TEST(EncodingCheckpointTest, FailedWriteThrowsAndKeepsNoTemporaryFile) {
+  const auto path = std::filesystem::temp_directory_path() /
+                    "jplm_no_directory" / "jplm_checkpoint_test";
+  EXPECT_THROW(get_checkpoint().write(path, get_codestreams()),
+      JPLM4DTransformModeLightFieldEncoderExceptions::
+          CheckpointWriteException);
+  EXPECT_FALSE(std::filesystem::exists(path.string() + ".tmp"));
+  EXPECT_FALSE(std::filesystem::exists(path));
+}
+
+
+TEST(EncodingCheckpointTest, MissingFileIsNoCheckpoint) {
+  EXPECT_FALSE(EncodingCheckpoint::read(
+      std::filesystem::temp_directory_path() / "jplm_no_checkpoint"));
+}
+
+
+TEST(EncodingCheckpointTest, TruncatedCheckpointThrows) {
+  auto bytes = get_bytes(get_checkpoint());
+  bytes.pop_back();
+  EXPECT_THROW(EncodingCheckpoint::from_bytes(bytes),
+      JPLM4DTransformModeLightFieldEncoderExceptions::
+          InvalidCheckpointException);
+}
+
+
+TEST(EncodingCheckpointTest, OtherFileThrows) {
+  auto bytes = get_bytes(get_checkpoint());
+  bytes[0] = std::byte{0};
+  EXPECT_THROW(EncodingCheckpoint::from_bytes(bytes),
+      JPLM4DTransformModeLightFieldEncoderExceptions::
+          InvalidCheckpointException);
+}
+
+
+int main(int argc, char* argv[]) {
+  testing::InitGoogleTest(&argc, argv);
+  //this is to enable ctest to run the test passing the path to the resources
+  if (argc > 1) {
+    resources_path = std::string(argv[1]);
+  }
+
+  return RUN_ALL_TESTS();
+}
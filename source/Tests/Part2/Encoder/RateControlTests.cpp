@@ -0,0 +1,192 @@
+/* The copyright in this software is being made available under the BSD
+ * License, included below. This software may be subject to other third party
+ * and contributor rights, including patent rights, and no such rights are
+ * granted under this license.
+ *
+ * Copyright (c) 2010-2019, ITU/ISO/IEC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *  * Neither the name of the ITU/ISO/IEC nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** \file     RateControlTests.cpp
+ *  \brief    Tests of the choice of lambda for a target bitrate
+ *  \details
+ *  \date     2026-10-19
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <iostream>
+#include <string>
+#include "Lib/Part2/Encoder/TransformMode/CommonExceptions.h"
+#include "Lib/Part2/Encoder/TransformMode/RateControl.h"
+#include "gtest/gtest.h"
+
+
+std::string resources_path = "../resources";
+
+
+namespace {
+
+/**
+ * \brief      Runs the calibration loop of the encoder, with the rate of the
+ * calibration blocks given by a model
+ */
+double calibrate(RateControl& rate_control,
+    const std::function<double(double)>& bytes_per_block_for_lambda) {
+  auto lambda = 1000.0;
+  for (auto i = std::size_t(0);
+       i < RateControl::maximum_calibration_iterations; ++i) {
+    rate_control.add_calibration_point(
+        lambda, bytes_per_block_for_lambda(lambda));
+    if (rate_control.is_calibrated(RateControl::calibration_tolerance)) {
+      break;
+    }
+    lambda = rate_control.get_lambda();
+  }
+  return rate_control.get_lambda();
+}
+
+
+double power_law(double lambda) {
+  return 1e5 * std::pow(lambda, -0.6);
+}
+
+
+//the rate saturates at the size of an empty block for large lambdas
+double saturating(double lambda) {
+  return std::max(4.0, power_law(lambda) - 50.0);
+}
+
+}  // namespace
+
+
+TEST(RateControlTest, CalibrationBlocksAreSpreadOverTheLightField) {
+  const auto indices = RateControl::get_calibration_block_indices(294);
+  EXPECT_EQ(294 / RateControl::calibration_subsampling, indices.size());
+  EXPECT_TRUE(std::is_sorted(indices.begin(), indices.end()));
+  EXPECT_LT(indices.front(), 294 / indices.size());
+  EXPECT_LT(indices.back(), 294);
+  EXPECT_GE(indices.back(), 294 - 294 / indices.size());
+}
+
+
+TEST(RateControlTest, CalibrationBlocksAreBoundedByTheNumberOfBlocks) {
+  EXPECT_EQ(RateControl::minimum_number_of_calibration_blocks,
+      RateControl::get_calibration_block_indices(20).size());
+  EXPECT_EQ(2, RateControl::get_calibration_block_indices(2).size());
+  EXPECT_EQ(RateControl::maximum_number_of_calibration_blocks,
+      RateControl::get_calibration_block_indices(100000).size());
+}
+
+
+TEST(RateControlTest, LambdaWithoutCalibrationThrows) {
+  auto rate_control = RateControl(100.0);
+  EXPECT_THROW(rate_control.get_lambda(),
+      JPLM4DTransformModeLightFieldEncoderExceptions::
+          UncalibratedRateControlException);
+}
+
+
+TEST(RateControlTest, CalibrationReachesTheTargetOfAPowerLaw) {
+  for (const auto target : {20.0, 500.0, 20000.0}) {
+    auto rate_control = RateControl(target);
+    const auto lambda = calibrate(rate_control, power_law);
+    EXPECT_NEAR(target, power_law(lambda),
+        RateControl::calibration_tolerance * target);
+  }
+}
+
+
+TEST(RateControlTest, CalibrationReachesTheTargetAcrossASaturation) {
+  for (const auto target : {20.0, 100.0, 1000.0}) {
+    auto rate_control = RateControl(target);
+    const auto lambda = calibrate(rate_control, saturating);
+    EXPECT_NEAR(target, saturating(lambda), 0.1 * target);
+  }
+}
+
+
+TEST(RateControlTest, SlopeIsFittedCloseToTheTarget) {
+  auto rate_control = RateControl(power_law(1000.0));
+  rate_control.add_calibration_point(500.0, power_law(500.0));
+  rate_control.add_calibration_point(2000.0, power_law(2000.0));
+  //too far from the target to be used in the fit
+  rate_control.add_calibration_point(1e-2, 1.0);
+  EXPECT_NEAR(-0.6, rate_control.get_slope(), 1e-9);
+}
+
+
+TEST(RateControlTest, RefinementKeepsTheLambdaWhenTheRateIsAsPredicted) {
+  const auto target = power_law(1000.0);
+  auto rate_control = RateControl(target);
+  rate_control.add_calibration_point(500.0, power_law(500.0));
+  rate_control.add_calibration_point(2000.0, power_law(2000.0));
+  const auto lambda = rate_control.get_lambda();
+  rate_control.add_encoded_blocks(
+      lambda, 10, static_cast<std::size_t>(std::round(10 * target)));
+  EXPECT_NEAR(lambda, rate_control.get_refined_lambda(100), 0.01 * lambda);
+}
+
+
+TEST(RateControlTest, RefinementRaisesTheLambdaWhenTheBlocksSpendMore) {
+  const auto target = power_law(1000.0);
+  auto rate_control = RateControl(target);
+  rate_control.add_calibration_point(500.0, power_law(500.0));
+  rate_control.add_calibration_point(2000.0, power_law(2000.0));
+  const auto lambda = rate_control.get_lambda();
+  rate_control.add_encoded_blocks(
+      lambda, 10, static_cast<std::size_t>(std::round(15 * target)));
+  const auto refined_lambda = rate_control.get_refined_lambda(100);
+  EXPECT_GT(refined_lambda, lambda);
+  EXPECT_LE(refined_lambda, RateControl::maximum_refinement_step * lambda);
+}
+
+
+TEST(RateControlTest, RefinementLowersTheLambdaWhenTheBlocksSpendLess) {
+  const auto target = power_law(1000.0);
+  auto rate_control = RateControl(target);
+  rate_control.add_calibration_point(500.0, power_law(500.0));
+  rate_control.add_calibration_point(2000.0, power_law(2000.0));
+  const auto lambda = rate_control.get_lambda();
+  rate_control.add_encoded_blocks(
+      lambda, 10, static_cast<std::size_t>(std::round(5 * target)));
+  const auto refined_lambda = rate_control.get_refined_lambda(100);
+  EXPECT_LT(refined_lambda, lambda);
+  EXPECT_GE(refined_lambda, lambda / RateControl::maximum_refinement_step);
+}
+
+
+int main(int argc, char* argv[]) {
+  testing::InitGoogleTest(&argc, argv);
+  //this is to enable ctest to run the test passing the path to the resources
+  if (argc > 1) {
+    resources_path = std::string(argv[1]);
+  }
+
+  return RUN_ALL_TESTS();
+}
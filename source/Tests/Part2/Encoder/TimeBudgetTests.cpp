@@ -0,0 +1,113 @@
+/* The copyright in this software is being made available under the BSD
+ * License, included below. This software may be subject to other third party
+ * and contributor rights, including patent rights, and no such rights are
+ * granted under this license.
+ *
+ * Copyright (c) 2010-2019, ITU/ISO/IEC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *  * Neither the name of the ITU/ISO/IEC nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** \file     TimeBudgetTests.cpp
+ *  \brief    Tests of the choice of the partition search depth for a
+ *            wall-clock budget
+ *  \details
+ *  \date     2026-10-19
+ */
+
+#include <iostream>
+#include <string>
+#include "Lib/Part2/Encoder/TransformMode/TimeBudget.h"
+#include "gtest/gtest.h"
+
+
+std::string resources_path = "../resources";
+
+
+TEST(TimeBudgetTest, MaximumPartitionDepthCountsSpatialAndViewSplits) {
+  EXPECT_EQ(2, TimeBudget::get_maximum_partition_depth(
+                   {1, 1, 16, 16}, {1, 1, 4, 4}));
+  //31 -> 16 -> 8 -> 4 and 5 -> 3 -> 2 -> 1
+  EXPECT_EQ(6, TimeBudget::get_maximum_partition_depth(
+                   {5, 5, 31, 31}, {1, 1, 4, 4}));
+  EXPECT_EQ(0, TimeBudget::get_maximum_partition_depth(
+                   {1, 1, 4, 4}, {1, 1, 4, 4}));
+}
+
+
+TEST(TimeBudgetTest, FirstBlockUsesTheMaximumDepth) {
+  const auto time_budget = TimeBudget(10.0, 10, 4);
+  EXPECT_EQ(4, time_budget.get_depth(0.0));
+}
+
+
+TEST(TimeBudgetTest, ExhaustedBudgetUsesDepthZero) {
+  auto time_budget = TimeBudget(10.0, 10, 4);
+  time_budget.add_encoded_block(4, 0.5);
+  EXPECT_EQ(0, time_budget.get_depth(12.0));
+}
+
+
+TEST(TimeBudgetTest, UnmeasuredDepthsAreExtrapolated) {
+  auto time_budget = TimeBudget(10.0, 10, 4);
+  EXPECT_DOUBLE_EQ(0.0, time_budget.get_estimated_seconds(2));
+  time_budget.add_encoded_block(2, 1.0);
+  time_budget.add_encoded_block(2, 3.0);
+  EXPECT_DOUBLE_EQ(2.0, time_budget.get_estimated_seconds(2));
+  EXPECT_DOUBLE_EQ(2.0 * TimeBudget::depth_time_ratio,
+      time_budget.get_estimated_seconds(3));
+  EXPECT_DOUBLE_EQ(2.0 / TimeBudget::depth_time_ratio,
+      time_budget.get_estimated_seconds(1));
+}
+
+
+TEST(TimeBudgetTest, ChoosesTheDeepestDepthThatFits) {
+  auto time_budget = TimeBudget(10.0, 10, 4);
+  time_budget.add_encoded_block(4, 2.0);
+  //0.89 s per block for the 9 remaining ones
+  EXPECT_EQ(3, time_budget.get_depth(2.0));
+  time_budget.add_encoded_block(3, 1.0);
+  //0.875 s per block for the 8 remaining ones, less than depth 3 took
+  EXPECT_EQ(2, time_budget.get_depth(3.0));
+}
+
+
+TEST(TimeBudgetTest, UsesTheMaximumDepthWhileItFits) {
+  auto time_budget = TimeBudget(100.0, 10, 4);
+  time_budget.add_encoded_block(4, 1.0);
+  EXPECT_EQ(4, time_budget.get_depth(1.0));
+}
+
+
+int main(int argc, char* argv[]) {
+  testing::InitGoogleTest(&argc, argv);
+  //this is to enable ctest to run the test passing the path to the resources
+  if (argc > 1) {
+    resources_path = std::string(argv[1]);
+  }
+
+  return RUN_ALL_TESTS();
+}
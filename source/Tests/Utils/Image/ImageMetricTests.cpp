@@ -761,6 +761,51 @@ TEST_F(SmallBT601Image,
 }
 
 
+TEST_F(SmallRGBImage, ErrorStatisticsThrowsExceptionForDifferentSizeImages) {
+  auto rgb_different_size = RGBImage<uint16_t>(3, 3, 10);
+  EXPECT_THROW(
+      ImageMetrics::get_error_statistics(rgb_image_a, rgb_different_size),
+      MetricsExceptions::DifferentSizeImagesException);
+}
+
+
+TEST_F(SmallRGBImage, ErrorStatisticsOfSameImageAreZero) {
+  for (const auto& statistics :
+      ImageMetrics::get_error_statistics(rgb_image_a, rgb_image_a)) {
+    EXPECT_DOUBLE_EQ(statistics.sum_of_squared_errors, 0.0);
+    EXPECT_DOUBLE_EQ(statistics.mean_squared_error, 0.0);
+    EXPECT_EQ(statistics.maximum_absolute_error, 0);
+  }
+}
+
+
+TEST(ErrorStatistics, MatchTheSeparatelyComputedMetrics) {
+  auto original = RGBImage<uint16_t>(37, 23, 10);
+  auto encoded = RGBImage<uint16_t>(37, 23, 10);
+  for (std::size_t i = 0; i < 23; ++i) {
+    for (std::size_t j = 0; j < 37; ++j) {
+      auto value = static_cast<uint16_t>((i * 31 + j * 17) % 1024);
+      auto other = static_cast<uint16_t>((i * 7 + j * 13 + 500) % 1024);
+      original.set_pixel_at({value, other, 0}, i, j);
+      //errors of both signs, up to the full range of the samples
+      encoded.set_pixel_at({other, value, 1023}, i, j);
+    }
+  }
+
+  auto statistics = ImageMetrics::get_error_statistics(original, encoded);
+  auto sses = ImageMetrics::get_sum_of_squared_errors(original, encoded);
+  auto mses = ImageMetrics::get_mse(original, encoded);
+  auto max_errors = ImageMetrics::get_maximum_absolute_error(original, encoded);
+  ASSERT_EQ(statistics.size(), 3);
+  for (std::size_t c = 0; c < 3; ++c) {
+    EXPECT_DOUBLE_EQ(statistics[c].sum_of_squared_errors, sses[c]);
+    EXPECT_DOUBLE_EQ(statistics[c].mean_squared_error, mses[c]);
+    EXPECT_EQ(statistics[c].maximum_absolute_error, max_errors[c]);
+  }
+  EXPECT_EQ(statistics[2].maximum_absolute_error, 1023);
+}
+
+
 int main(int argc, char* argv[]) {
   testing::InitGoogleTest(&argc, argv);
   //this is to enable ctest to run the test passing the path to the resources
@@ -0,0 +1,94 @@
+/* The copyright in this software is being made available under the BSD
+ * License, included below. This software may be subject to other third party
+ * and contributor rights, including patent rights, and no such rights are
+ * granted under this license.
+ *
+ * Copyright (c) 2010-2019, ITU/ISO/IEC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *  * Neither the name of the ITU/ISO/IEC nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** \file     RasterToolsTests.cpp
+ *  \brief    Test of the raster sample kernels.
+ *  \details  
+ *  \date     2026-10-19
+ */
+
+#include <vector>
+#include "Lib/Utils/Image/RasterTools.h"
+#include "gtest/gtest.h"
+
+
+TEST(RasterToolsTest, ByteSwapOf16BitSample) {
+  EXPECT_EQ(RasterTools::byte_swap(uint16_t(0x1234)), 0x3412);
+}
+
+
+TEST(RasterToolsTest, ByteSwapOf32BitSample) {
+  EXPECT_EQ(RasterTools::byte_swap(uint32_t(0x12345678)), 0x78563412);
+}
+
+
+TEST(RasterToolsTest, ByteSwapOfSignedSample) {
+  EXPECT_EQ(RasterTools::byte_swap(int16_t(-2)), int16_t(0xFEFF));
+}
+
+
+TEST(RasterToolsTest, DeinterleaveSplitsSamples) {
+  std::vector<uint8_t> interleaved = {1, 2, 3, 4, 5, 6, 7, 8, 9};
+  std::vector<uint8_t> first(3), second(3), third(3);
+  RasterTools::deinterleave_three_channels<uint8_t, false>(interleaved.data(),
+      first.data(), second.data(), third.data(), 3);
+  EXPECT_EQ(first, std::vector<uint8_t>({1, 4, 7}));
+  EXPECT_EQ(second, std::vector<uint8_t>({2, 5, 8}));
+  EXPECT_EQ(third, std::vector<uint8_t>({3, 6, 9}));
+}
+
+
+TEST(RasterToolsTest, DeinterleaveSwappingBytes) {
+  std::vector<uint16_t> interleaved = {0x0100, 0x0200, 0x0300};
+  std::vector<uint16_t> first(1), second(1), third(1);
+  RasterTools::deinterleave_three_channels<uint16_t, true>(interleaved.data(),
+      first.data(), second.data(), third.data(), 1);
+  EXPECT_EQ(first[0], 1);
+  EXPECT_EQ(second[0], 2);
+  EXPECT_EQ(third[0], 3);
+}
+
+
+TEST(RasterToolsTest, InterleaveIsTheInverseOfDeinterleave) {
+  std::vector<uint16_t> interleaved(3 * 37);
+  for (auto i = 0; i < 3 * 37; ++i) {
+    interleaved[i] = static_cast<uint16_t>(i * 997);
+  }
+  std::vector<uint16_t> first(37), second(37), third(37);
+  RasterTools::deinterleave_three_channels<uint16_t, true>(interleaved.data(),
+      first.data(), second.data(), third.data(), 37);
+  std::vector<uint16_t> result(3 * 37);
+  RasterTools::interleave_three_channels<uint16_t, true>(
+      first.data(), second.data(), third.data(), result.data(), 37);
+  EXPECT_EQ(result, interleaved);
+}
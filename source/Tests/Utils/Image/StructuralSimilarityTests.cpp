@@ -0,0 +1,235 @@
+/* The copyright in this software is being made available under the BSD
+ * License, included below. This software may be subject to other third party
+ * and contributor rights, including patent rights, and no such rights are
+ * granted under this license.
+ *
+ * Copyright (c) 2010-2019, ITU/ISO/IEC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *  * Neither the name of the ITU/ISO/IEC nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** \file     StructuralSimilarityTests.cpp
+ *  \brief    Tests of the SSIM and MS-SSIM metrics.
+ *  \details
+ *  \date     2026-10-19
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include "Lib/Utils/Image/ImageMetrics.h"
+#include "Lib/Utils/Image/RGBImage.h"
+#include "Lib/Utils/Image/StructuralSimilarity.h"
+#include "gtest/gtest.h"
+
+
+namespace {
+
+StructuralSimilarity::Plane get_random_plane(
+    std::size_t width, std::size_t height, unsigned int seed) {
+  auto generator = std::mt19937(seed);
+  auto distribution = std::uniform_int_distribution<int>(0, 1023);
+  StructuralSimilarity::Plane plane;
+  plane.width = width;
+  plane.height = height;
+  for (std::size_t i = 0; i < width * height; ++i) {
+    plane.samples.push_back(distribution(generator));
+  }
+  return plane;
+}
+
+
+StructuralSimilarity::Plane get_noisy_copy(
+    const StructuralSimilarity::Plane& plane, unsigned int seed) {
+  auto generator = std::mt19937(seed);
+  auto distribution = std::uniform_int_distribution<int>(-40, 40);
+  auto copy = plane;
+  for (auto& sample : copy.samples) {
+    sample = std::clamp(sample + distribution(generator), 0.0, 1023.0);
+  }
+  return copy;
+}
+
+
+//direct (non separable) evaluation of the mean SSIM, as in Wang et al.
+double get_reference_ssim(const StructuralSimilarity::Plane& x,
+    const StructuralSimilarity::Plane& y, double max_value) {
+  constexpr auto size = StructuralSimilarity::window_size;
+  const auto sigma = StructuralSimilarity::window_standard_deviation;
+  double window[size][size];
+  auto window_sum = 0.0;
+  for (std::size_t i = 0; i < size; ++i) {
+    for (std::size_t j = 0; j < size; ++j) {
+      auto di = static_cast<double>(i) - static_cast<double>(size / 2);
+      auto dj = static_cast<double>(j) - static_cast<double>(size / 2);
+      window[i][j] = std::exp(-(di * di + dj * dj) / (2.0 * sigma * sigma));
+      window_sum += window[i][j];
+    }
+  }
+  const auto c1 = std::pow(StructuralSimilarity::k1 * max_value, 2.0);
+  const auto c2 = std::pow(StructuralSimilarity::k2 * max_value, 2.0);
+  auto sum = 0.0;
+  for (std::size_t r = 0; r + size <= x.height; ++r) {
+    for (std::size_t c = 0; c + size <= x.width; ++c) {
+      double mx = 0, my = 0, mxx = 0, myy = 0, mxy = 0;
+      for (std::size_t i = 0; i < size; ++i) {
+        for (std::size_t j = 0; j < size; ++j) {
+          auto w = window[i][j] / window_sum;
+          auto a = x.samples[(r + i) * x.width + c + j];
+          auto b = y.samples[(r + i) * y.width + c + j];
+          mx += w * a;
+          my += w * b;
+          mxx += w * a * a;
+          myy += w * b * b;
+          mxy += w * a * b;
+        }
+      }
+      auto vx = mxx - mx * mx;
+      auto vy = myy - my * my;
+      auto cov = mxy - mx * my;
+      sum += ((2 * mx * my + c1) * (2 * cov + c2)) /
+             ((mx * mx + my * my + c1) * (vx + vy + c2));
+    }
+  }
+  auto number_of_positions = (x.width - size + 1) * (x.height - size + 1);
+  return sum / static_cast<double>(number_of_positions);
+}
+
+}  // namespace
+
+
+TEST(StructuralSimilarity, SSIMOfSamePlaneIsOne) {
+  auto plane = get_random_plane(40, 30, 1);
+  EXPECT_NEAR(
+      StructuralSimilarity::get_structural_similarity(plane, plane, 1023.0),
+      1.0, 1e-12);
+}
+
+
+TEST(StructuralSimilarity, SSIMMatchesTheDirectEvaluation) {
+  auto original = get_random_plane(37, 23, 2);
+  auto encoded = get_noisy_copy(original, 3);
+  auto ssim =
+      StructuralSimilarity::get_structural_similarity(original, encoded, 1023);
+  EXPECT_NEAR(ssim, get_reference_ssim(original, encoded, 1023.0), 1e-9);
+  EXPECT_LT(ssim, 1.0);
+  EXPECT_GT(ssim, 0.0);
+}
+
+
+TEST(StructuralSimilarity, SSIMDecreasesWithTheDistortion) {
+  auto original = get_random_plane(32, 32, 4);
+  auto slightly_distorted = original;
+  for (auto& sample : slightly_distorted.samples) {
+    sample = std::min(sample + 5.0, 1023.0);
+  }
+  auto distorted = get_noisy_copy(original, 5);
+  EXPECT_GT(StructuralSimilarity::get_structural_similarity(
+                original, slightly_distorted, 1023.0),
+      StructuralSimilarity::get_structural_similarity(
+          original, distorted, 1023.0));
+}
+
+
+TEST(StructuralSimilarity, SSIMThrowsForPlanesSmallerThanTheWindow) {
+  auto plane = get_random_plane(10, 30, 6);
+  EXPECT_THROW(
+      StructuralSimilarity::get_structural_similarity(plane, plane, 1023.0),
+      MetricsExceptions::ImageTooSmallForMetricException);
+}
+
+
+TEST(StructuralSimilarity, SSIMThrowsForPlanesOfDifferentSizes) {
+  auto plane = get_random_plane(20, 20, 7);
+  auto other = get_random_plane(20, 21, 7);
+  EXPECT_THROW(
+      StructuralSimilarity::get_structural_similarity(plane, other, 1023.0),
+      MetricsExceptions::DifferentSizeImagesException);
+}
+
+
+TEST(StructuralSimilarity, DownsampleAveragesGroupsOfFourSamples) {
+  StructuralSimilarity::Plane plane;
+  plane.width = 5;
+  plane.height = 3;
+  for (std::size_t i = 0; i < 15; ++i) {
+    plane.samples.push_back(static_cast<double>(i));
+  }
+  auto downsampled = StructuralSimilarity::downsample(plane);
+  ASSERT_EQ(downsampled.width, 2);
+  ASSERT_EQ(downsampled.height, 1);
+  EXPECT_DOUBLE_EQ(downsampled.samples[0], (0.0 + 1.0 + 5.0 + 6.0) / 4.0);
+  EXPECT_DOUBLE_EQ(downsampled.samples[1], (2.0 + 3.0 + 7.0 + 8.0) / 4.0);
+}
+
+
+TEST(StructuralSimilarity, MSSSIMOfSamePlaneIsOne) {
+  auto plane = get_random_plane(180, 176, 8);
+  EXPECT_NEAR(StructuralSimilarity::get_multiscale_structural_similarity(
+                  plane, plane, 1023.0),
+      1.0, 1e-12);
+}
+
+
+TEST(StructuralSimilarity, MSSSIMIsBetweenZeroAndOneForDistortedPlanes) {
+  auto original = get_random_plane(180, 176, 9);
+  auto encoded = get_noisy_copy(original, 10);
+  auto ms_ssim = StructuralSimilarity::get_multiscale_structural_similarity(
+      original, encoded, 1023.0);
+  EXPECT_LT(ms_ssim, 1.0);
+  EXPECT_GT(ms_ssim, 0.0);
+}
+
+
+TEST(StructuralSimilarity, MSSSIMThrowsIfTheLastScaleIsSmallerThanTheWindow) {
+  auto plane = get_random_plane(200, 175, 11);
+  EXPECT_THROW(StructuralSimilarity::get_multiscale_structural_similarity(
+                   plane, plane, 1023.0),
+      MetricsExceptions::ImageTooSmallForMetricException);
+}
+
+
+TEST(StructuralSimilarity, ImageSSIMIsComputedPerChannel) {
+  auto original = RGBImage<uint16_t>(16, 12, 10);
+  for (std::size_t i = 0; i < 12; ++i) {
+    for (std::size_t j = 0; j < 16; ++j) {
+      auto value = static_cast<uint16_t>((i * 67 + j * 29) % 1024);
+      original.set_pixel_at({value, value, value}, i, j);
+    }
+  }
+  auto encoded = original;
+  encoded.set_pixel_at({0, 1023, 0}, 5, 7);
+  encoded.set_pixel_at({1023, 1023, 0}, 6, 7);
+
+  auto ssims = ImageMetrics::get_structural_similarity(original, encoded);
+  ASSERT_EQ(ssims.size(), 3);
+  EXPECT_LT(ssims[0], 1.0);
+  EXPECT_LT(ssims[1], 1.0);
+  EXPECT_LT(ssims[2], 1.0);
+  EXPECT_NE(ssims[0], ssims[1]);
+  EXPECT_DOUBLE_EQ(
+      ImageMetrics::get_structural_similarity(original, original)[0], 1.0);
+}
@@ -0,0 +1,89 @@
+/* The copyright in this software is being made available under the BSD
+ * License, included below. This software may be subject to other third party
+ * and contributor rights, including patent rights, and no such rights are
+ * granted under this license.
+ *
+ * Copyright (c) 2010-2019, ITU/ISO/IEC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *  * Neither the name of the ITU/ISO/IEC nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** \file     ParallelForTests.cpp
+ *  \brief    Test of the bounded parallel loop.
+ *  \details  
+ *  \date     2026-10-19
+ */
+
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+#include "Lib/Utils/Parallel/ParallelFor.h"
+#include "gtest/gtest.h"
+
+
+TEST(ParallelForTest, ZeroRequestedThreadsGivesAtLeastOneThread) {
+  EXPECT_GE(Parallel::get_number_of_threads(0), 1);
+}
+
+
+TEST(ParallelForTest, RequestedNumberOfThreadsIsKept) {
+  EXPECT_EQ(Parallel::get_number_of_threads(5), 5);
+}
+
+
+TEST(ParallelForTest, EveryIterationRunsOnce) {
+  std::vector<std::atomic<int>> counters(1000);
+  Parallel::parallel_for(
+      0, counters.size(), 4, [&counters](auto i) { ++counters[i]; });
+  for (const auto& counter : counters) {
+    EXPECT_EQ(counter, 1);
+  }
+}
+
+
+TEST(ParallelForTest, RangeWithNonZeroBegin) {
+  std::atomic<std::size_t> sum(0);
+  Parallel::parallel_for(10, 20, 3, [&sum](auto i) { sum += i; });
+  EXPECT_EQ(sum, 145);
+}
+
+
+TEST(ParallelForTest, SingleThreadRunsInOrder) {
+  std::vector<std::size_t> order;
+  Parallel::parallel_for(0, 5, 1, [&order](auto i) { order.push_back(i); });
+  EXPECT_EQ(order, std::vector<std::size_t>({0, 1, 2, 3, 4}));
+}
+
+
+TEST(ParallelForTest, ExceptionIsRethrownInCallingThread) {
+  EXPECT_THROW(Parallel::parallel_for(0, 100, 4,
+                   [](auto i) {
+                     if (i == 42) {
+                       throw std::runtime_error("iteration failed");
+                     }
+                   }),
+      std::runtime_error);
+}
@@ -0,0 +1,134 @@
+/* The copyright in this software is being made available under the BSD
+ * License, included below. This software may be subject to other third party
+ * and contributor rights, including patent rights, and no such rights are
+ * granted under this license.
+ *
+ * Copyright (c) 2010-2019, ITU/ISO/IEC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *  * Neither the name of the ITU/ISO/IEC nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** \file     TaskSchedulerTests.cpp
+ *  \brief    Test of the work-stealing task scheduler.
+ *  \details  
+ *  \date     2026-10-19
+ */
+
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+#include "Lib/Utils/Parallel/TaskScheduler.h"
+#include "gtest/gtest.h"
+
+
+TEST(TaskSchedulerTest, NumberOfThreadsIncludesTheWaitingThread) {
+  auto scheduler = Parallel::TaskScheduler(4);
+  EXPECT_EQ(scheduler.get_number_of_threads(), 4);
+}
+
+
+TEST(TaskSchedulerTest, EveryTaskRunsOnce) {
+  auto scheduler = Parallel::TaskScheduler(4);
+  std::vector<std::atomic<int>> counters(1000);
+  auto group = Parallel::TaskGroup(scheduler);
+  for (auto& counter : counters) {
+    group.run([&counter]() { ++counter; });
+  }
+  group.wait();
+  for (const auto& counter : counters) {
+    EXPECT_EQ(counter, 1);
+  }
+}
+
+
+TEST(TaskSchedulerTest, SingleThreadRunsTheTasksWhileWaiting) {
+  auto scheduler = Parallel::TaskScheduler(1);
+  std::vector<int> values;
+  auto group = Parallel::TaskGroup(scheduler);
+  group.run([&values]() { values.push_back(1); });
+  group.run([&values]() { values.push_back(2); });
+  group.wait();
+  EXPECT_EQ(values.size(), 2);
+}
+
+
+namespace {
+
+long fibonacci(Parallel::TaskScheduler& scheduler, int n) {
+  if (n < 2) {
+    return n;
+  }
+  long a = 0;
+  long b = 0;
+  auto group = Parallel::TaskGroup(scheduler);
+  group.run([&]() { a = fibonacci(scheduler, n - 1); });
+  group.run([&]() { b = fibonacci(scheduler, n - 2); });
+  group.wait();
+  return a + b;
+}
+
+}  // namespace
+
+
+TEST(TaskSchedulerTest, NestedGroupsDoNotDeadlock) {
+  auto scheduler = Parallel::TaskScheduler(3);
+  EXPECT_EQ(fibonacci(scheduler, 16), 987);
+}
+
+
+TEST(TaskSchedulerTest, NestedGroupsInSingleThread) {
+  auto scheduler = Parallel::TaskScheduler(1);
+  EXPECT_EQ(fibonacci(scheduler, 10), 55);
+}
+
+
+TEST(TaskSchedulerTest, ExceptionOfATaskIsRethrownByWait) {
+  auto scheduler = Parallel::TaskScheduler(4);
+  std::atomic<int> number_of_finished_tasks(0);
+  auto group = Parallel::TaskGroup(scheduler);
+  for (auto i = 0; i < 10; ++i) {
+    group.run([i, &number_of_finished_tasks]() {
+      if (i == 5) {
+        throw std::runtime_error("task failed");
+      }
+      ++number_of_finished_tasks;
+    });
+  }
+  EXPECT_THROW(group.wait(), std::runtime_error);
+  EXPECT_EQ(number_of_finished_tasks, 9);
+}
+
+
+TEST(TaskSchedulerTest, GroupCanBeReusedAfterWait) {
+  auto scheduler = Parallel::TaskScheduler(2);
+  std::atomic<int> counter(0);
+  auto group = Parallel::TaskGroup(scheduler);
+  group.run([&counter]() { ++counter; });
+  group.wait();
+  group.run([&counter]() { ++counter; });
+  group.wait();
+  EXPECT_EQ(counter, 2);
+}
@@ -0,0 +1,144 @@
+/* The copyright in this software is being made available under the BSD
+ * License, included below. This software may be subject to other third party
+ * and contributor rights, including patent rights, and no such rights are
+ * granted under this license.
+ *
+ * Copyright (c) 2010-2019, ITU/ISO/IEC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *  * Neither the name of the ITU/ISO/IEC nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/** \file     MemoryAccountingTests.cpp
+ *  \brief    Test of the memory accounting of the codec buffers.
+ *  \details  
+ *  \date     2026-10-19
+ */
+
+#include <sstream>
+#include <utility>
+#include "Lib/Utils/Image/ImageChannel.h"
+#include "Lib/Utils/Stats/MemoryAccounting.h"
+#include "gtest/gtest.h"
+
+using MemoryAccounting::Category;
+using MemoryAccounting::TrackedBytes;
+
+
+TEST(MemoryAccountingTest, TrackedBytesAreAccountedWhileAlive) {
+  const auto initial =
+      MemoryAccounting::get_current_bytes(Category::codestream);
+  {
+    auto tracked = TrackedBytes(Category::codestream, 1000);
+    EXPECT_EQ(MemoryAccounting::get_current_bytes(Category::codestream),
+        initial + 1000);
+    tracked.set(250);
+    EXPECT_EQ(MemoryAccounting::get_current_bytes(Category::codestream),
+        initial + 250);
+  }
+  EXPECT_EQ(
+      MemoryAccounting::get_current_bytes(Category::codestream), initial);
+}
+
+
+TEST(MemoryAccountingTest, PeakKeepsTheMaximum) {
+  MemoryAccounting::reset_peaks();
+  const auto initial =
+      MemoryAccounting::get_current_bytes(Category::blocks_4d);
+  {
+    auto tracked = TrackedBytes(Category::blocks_4d, 4096);
+    tracked.set(16);
+  }
+  EXPECT_EQ(
+      MemoryAccounting::get_current_bytes(Category::blocks_4d), initial);
+  EXPECT_EQ(
+      MemoryAccounting::get_peak_bytes(Category::blocks_4d), initial + 4096);
+  EXPECT_GE(MemoryAccounting::get_peak_total_bytes(), 4096);
+  MemoryAccounting::reset_peaks();
+  EXPECT_EQ(MemoryAccounting::get_peak_bytes(Category::blocks_4d), initial);
+}
+
+
+TEST(MemoryAccountingTest, CopiesAccountAgainAndMovesTransfer) {
+  const auto initial =
+      MemoryAccounting::get_current_bytes(Category::parsed_boxes);
+  auto tracked = TrackedBytes(Category::parsed_boxes, 100);
+  auto copy = tracked;
+  EXPECT_EQ(MemoryAccounting::get_current_bytes(Category::parsed_boxes),
+      initial + 200);
+  auto moved = std::move(copy);
+  EXPECT_EQ(copy.get(), 0);
+  EXPECT_EQ(moved.get(), 100);
+  EXPECT_EQ(MemoryAccounting::get_current_bytes(Category::parsed_boxes),
+      initial + 200);
+  moved = TrackedBytes(Category::parsed_boxes, 10);
+  EXPECT_EQ(MemoryAccounting::get_current_bytes(Category::parsed_boxes),
+      initial + 110);
+}
+
+
+TEST(MemoryAccountingTest, ImageChannelsAreAccountedAsImages) {
+  const auto initial = MemoryAccounting::get_current_bytes(Category::images);
+  {
+    auto channel = ImageChannel<uint16_t>(10, 20, 10);
+    const auto bytes = std::size_t{10 * 20 * sizeof(uint16_t)};
+    EXPECT_EQ(MemoryAccounting::get_current_bytes(Category::images),
+        initial + bytes);
+    auto copy = channel;
+    EXPECT_EQ(MemoryAccounting::get_current_bytes(Category::images),
+        initial + 2 * bytes);
+    auto moved = std::move(channel);
+    EXPECT_EQ(MemoryAccounting::get_current_bytes(Category::images),
+        initial + 2 * bytes);
+  }
+  EXPECT_EQ(MemoryAccounting::get_current_bytes(Category::images), initial);
+}
+
+
+TEST(MemoryAccountingTest, BudgetIsExceededOnlyWhenSet) {
+  auto tracked = TrackedBytes(Category::images, 1024);
+  MemoryAccounting::set_budget(0);
+  EXPECT_FALSE(MemoryAccounting::has_budget());
+  EXPECT_FALSE(MemoryAccounting::is_over_budget());
+  MemoryAccounting::set_budget(
+      MemoryAccounting::get_current_total_bytes() + 1);
+  EXPECT_TRUE(MemoryAccounting::has_budget());
+  EXPECT_FALSE(MemoryAccounting::is_over_budget());
+  tracked.set(1026);
+  EXPECT_TRUE(MemoryAccounting::is_over_budget());
+  MemoryAccounting::set_budget(0);
+  EXPECT_FALSE(MemoryAccounting::is_over_budget());
+}
+
+
+TEST(MemoryAccountingTest, TableShowsEveryCategory) {
+  auto stream = std::ostringstream();
+  MemoryAccounting::show_table(stream);
+  for (auto i = std::size_t{0}; i < MemoryAccounting::number_of_categories;
+       ++i) {
+    EXPECT_NE(stream.str().find(MemoryAccounting::get_category_name(
+                  static_cast<Category>(i))),
+        std::string::npos);
+  }
+}
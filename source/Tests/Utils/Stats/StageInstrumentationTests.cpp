@@ -0,0 +1,154 @@
+/* The copyright in this software is being made available under the BSD
+ * License, included below. This software may be subject to other third party
+ * and contributor rights, including patent rights, and no such rights are
+ * granted under this license.
+ *
+ * Copyright (c) 2010-2019, ITU/ISO/IEC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *  * Neither the name of the ITU/ISO/IEC nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** \file     StageInstrumentationTests.cpp
+ *  \brief    Test of the per stage timers and counters.
+ *  \details  The classes are tested directly, so that the tests do not depend
+ *            on the JPLM_INSTRUMENTATION build option.
+ *  \date     2026-10-19
+ */
+
+#include <sstream>
+#include <thread>
+#include "Lib/Utils/Stats/StageInstrumentation.h"
+#include "gtest/gtest.h"
+
+using StageInstrumentation::Stage;
+
+
+namespace {
+
+const StageInstrumentation::StageCounters& get_total(Stage stage) {
+  static StageInstrumentation::ThreadCounters total;
+  total = StageInstrumentation::get_total_counters();
+  return total[static_cast<std::size_t>(stage)];
+}
+
+}  // namespace
+
+
+TEST(StageInstrumentationTest, ScopedTimerCountsCallsAndTime) {
+  StageInstrumentation::reset();
+  for (auto i = 0; i < 3; ++i) {
+    auto timer = StageInstrumentation::ScopedStageTimer(Stage::forward_dct);
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  const auto& counters = get_total(Stage::forward_dct);
+  EXPECT_EQ(counters.calls, 3);
+  EXPECT_GE(counters.nanoseconds, 3000000);
+  EXPECT_EQ(get_total(Stage::inverse_dct).calls, 0);
+}
+
+
+TEST(StageInstrumentationTest, ItemsAreAccumulated) {
+  StageInstrumentation::reset();
+  StageInstrumentation::add_items(Stage::block_gather, 10);
+  StageInstrumentation::add_items(Stage::block_gather, 32);
+  EXPECT_EQ(get_total(Stage::block_gather).items, 42);
+  EXPECT_EQ(get_total(Stage::block_gather).calls, 0);
+}
+
+
+TEST(StageInstrumentationTest, ResetZeroesAllCounters) {
+  StageInstrumentation::add_time(Stage::output, 100);
+  EXPECT_TRUE(StageInstrumentation::has_any_record());
+  StageInstrumentation::reset();
+  EXPECT_FALSE(StageInstrumentation::has_any_record());
+}
+
+
+TEST(StageInstrumentationTest, ThreadsAggregateInTheTotal) {
+  StageInstrumentation::reset();
+  StageInstrumentation::add_time(Stage::abac_encode, 1);
+  auto threads = std::vector<std::thread>();
+  for (auto i = 0; i < 4; ++i) {
+    threads.emplace_back(
+        []() { StageInstrumentation::add_time(Stage::abac_encode, 1); });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  EXPECT_EQ(get_total(Stage::abac_encode).calls, 5);
+  EXPECT_EQ(get_total(Stage::abac_encode).nanoseconds, 5);
+  EXPECT_GE(StageInstrumentation::get_per_thread_counters().size(), 2);
+}
+
+
+TEST(StageInstrumentationTest, RecordsOfFinishedThreadsAreReused) {
+  //makes sure this thread is registered
+  StageInstrumentation::add_time(Stage::output, 1);
+  auto run_in_new_thread = []() {
+    std::thread([]() {
+      StageInstrumentation::add_time(Stage::output, 1);
+    }).join();
+  };
+  run_in_new_thread();
+  const auto number_of_records =
+      StageInstrumentation::get_per_thread_counters().size();
+  run_in_new_thread();
+  run_in_new_thread();
+  EXPECT_EQ(StageInstrumentation::get_per_thread_counters().size(),
+      number_of_records);
+}
+
+
+TEST(StageInstrumentationTest, JsonHasOnlyTheUsedStages) {
+  StageInstrumentation::reset();
+  StageInstrumentation::add_time(Stage::hexadecatree_rd, 2000000);
+  StageInstrumentation::add_items(Stage::hexadecatree_rd, 7);
+  auto json = StageInstrumentation::to_json();
+  ASSERT_TRUE(json["stages"].contains("hexadecatree_rd"));
+  EXPECT_FALSE(json["stages"].contains("view_loading"));
+  EXPECT_EQ(json["stages"]["hexadecatree_rd"]["calls"], 1);
+  EXPECT_EQ(json["stages"]["hexadecatree_rd"]["items"], 7);
+  EXPECT_DOUBLE_EQ(
+      json["stages"]["hexadecatree_rd"]["time_ms"].get<double>(), 2.0);
+  EXPECT_TRUE(json["threads"].is_array());
+}
+
+
+TEST(StageInstrumentationTest, TableShowsTheUsedStages) {
+  StageInstrumentation::reset();
+  StageInstrumentation::add_time(Stage::partition_search, 1);
+  auto stream = std::ostringstream();
+  StageInstrumentation::show_table(stream);
+  EXPECT_NE(stream.str().find("partition_search"), std::string::npos);
+  EXPECT_EQ(stream.str().find("abac_decode"), std::string::npos);
+}
+
+
+TEST(StageInstrumentationTest, StageNames) {
+  EXPECT_EQ(StageInstrumentation::get_stage_name(Stage::view_loading),
+      "view_loading");
+  EXPECT_EQ(StageInstrumentation::get_stage_name(Stage::output), "output");
+}
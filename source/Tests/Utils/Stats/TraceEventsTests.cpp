@@ -0,0 +1,150 @@
+/* The copyright in this software is being made available under the BSD
+ * License, included below. This software may be subject to other third party
+ * and contributor rights, including patent rights, and no such rights are
+ * granted under this license.
+ *
+ * Copyright (c) 2010-2019, ITU/ISO/IEC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *  * Neither the name of the ITU/ISO/IEC nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** \file     TraceEventsTests.cpp
+ *  \brief    Test of the Chrome trace-event timeline.
+ *  \details  
+ *  \date     2026-10-19
+ */
+
+#include <filesystem>
+#include <fstream>
+#include <thread>
+#include "Lib/Utils/Stats/TraceEvents.h"
+#include "gtest/gtest.h"
+
+
+namespace {
+
+std::vector<nlohmann::json> get_complete_events() {
+  auto complete_events = std::vector<nlohmann::json>();
+  const auto json = TraceEvents::to_json();
+  for (const auto& event : json["traceEvents"]) {
+    if (event["ph"] == "X") {
+      complete_events.push_back(event);
+    }
+  }
+  return complete_events;
+}
+
+}  // namespace
+
+
+TEST(TraceEventsTest, NothingIsRecordedWhenNotStarted) {
+  TraceEvents::start();
+  TraceEvents::stop();
+  {
+    auto event = TraceEvents::ScopedEvent("block", "codec");
+    EXPECT_FALSE(event.is_recording());
+  }
+  EXPECT_EQ(TraceEvents::get_number_of_events(), 0);
+}
+
+
+TEST(TraceEventsTest, ScopedEventIsRecordedAsCompleteEvent) {
+  TraceEvents::start();
+  {
+    auto event = TraceEvents::ScopedEvent("block", "codec");
+    event.add_argument("channel", 2);
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  TraceEvents::stop();
+
+  const auto events = get_complete_events();
+  ASSERT_EQ(events.size(), 1);
+  EXPECT_EQ(events[0]["name"], "block");
+  EXPECT_EQ(events[0]["cat"], "codec");
+  EXPECT_EQ(events[0]["args"]["channel"], 2);
+  EXPECT_GE(events[0]["ts"].get<double>(), 0.0);
+  EXPECT_GE(events[0]["dur"].get<double>(), 1000.0);
+}
+
+
+TEST(TraceEventsTest, EventWithFalseConditionIsNotRecorded) {
+  TraceEvents::start();
+  {
+    auto event = TraceEvents::ScopedEvent("partition_node", "search", false);
+    EXPECT_FALSE(event.is_recording());
+  }
+  TraceEvents::stop();
+  EXPECT_EQ(TraceEvents::get_number_of_events(), 0);
+}
+
+
+TEST(TraceEventsTest, StartDiscardsPreviousEvents) {
+  TraceEvents::start();
+  { const auto event = TraceEvents::ScopedEvent("first", "test"); }
+  TraceEvents::start();
+  { const auto event = TraceEvents::ScopedEvent("second", "test"); }
+  TraceEvents::stop();
+  const auto events = get_complete_events();
+  ASSERT_EQ(events.size(), 1);
+  EXPECT_EQ(events[0]["name"], "second");
+}
+
+
+TEST(TraceEventsTest, ThreadsHaveDistinctIdsAndNames) {
+  TraceEvents::start();
+  { const auto event = TraceEvents::ScopedEvent("main", "test"); }
+  std::thread([]() {
+    const auto event = TraceEvents::ScopedEvent("worker", "test");
+  }).join();
+  TraceEvents::stop();
+
+  const auto events = get_complete_events();
+  ASSERT_EQ(events.size(), 2);
+  EXPECT_NE(events[0]["tid"], events[1]["tid"]);
+
+  auto number_of_thread_names = 0;
+  const auto json = TraceEvents::to_json();
+  for (const auto& event : json["traceEvents"]) {
+    if (event["ph"] == "M" && event["name"] == "thread_name") {
+      ++number_of_thread_names;
+    }
+  }
+  EXPECT_EQ(number_of_thread_names, 2);
+}
+
+
+TEST(TraceEventsTest, WrittenFileIsValidJson) {
+  TraceEvents::start();
+  { const auto event = TraceEvents::ScopedEvent("block", "codec"); }
+  TraceEvents::stop();
+  const auto path =
+      std::filesystem::temp_directory_path() / "jplm_trace_events_test.json";
+  TraceEvents::write(path);
+  auto file = std::ifstream(path);
+  const auto json = nlohmann::json::parse(file);
+  EXPECT_TRUE(json["traceEvents"].is_array());
+  std::filesystem::remove(path);
+}